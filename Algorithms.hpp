@@ -0,0 +1,513 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Paged.hpp"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Algorithms.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_ALGORITHMS Algorithms
+///
+/// \c substr, \c find, \c split and friends for \c string_to_type strings, producing the same
+/// \c std::integer_sequence types that \c string_to_type does.
+///
+/// None of these recurse one character at a time.  The searching happens in ordinary \c constexpr loops over
+/// a copy of the characters, and new sequences are made by expanding a single \c std::make_index_sequence over an array,
+/// so the template depth doesn't grow with the length of the string and strings of \c CTSTR_MAX_STRING_SIZE 0x10000 work fine.
+///
+/// Each operation comes in two spellings: \c substr_t<S, 1, 2> and \c find_v<S, Needle> work on types,
+/// and <tt>substr<1, 2>(s)</tt> and <tt>find(s, needle)</tt> on values, the same way \c to_string() does.
+/// Strings used together must have the same character type.  Any of them can also be a \c ctstr::paged string from \c Paged.hpp.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief "No position"/"to the end", the same as \c std::string::npos
+////////////////////////////////////////////////////////////
+constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	template <typename SeqType, typename...Others>
+	constexpr bool same_char_type()
+	{
+		return (std::is_same<typename sequence_type<SeqType>::type, typename sequence_type<Others>::type>::value && ...);
+	}
+
+	// The characters, plus a terminator so empty strings still make an array.
+	// GCC copies the whole of a constexpr variable each time a constant expression reads from it, so looping over data<SeqType>
+	// takes time proportional to the square of the length.  The loops below all work on one of these local copies instead.
+	template <typename T, T...t>
+	constexpr std::array<T, sizeof...(t) + 1> chars(std::integer_sequence<T, t...>)
+	{
+		return {{ t..., T() }};
+	}
+
+	// One shared copy of the characters, for pieces of the string to be cut out of.
+	template <typename SeqType>
+	struct stored
+	{
+		static constexpr auto value = chars(SeqType{});
+	};
+
+	// Builder::value[Pos] onwards, from a constexpr std::array, as a sequence.  Every character is a separate (and cheap)
+	// constant expression, which is much quicker for the compiler than copying out the piece in a loop first.
+	template <typename T, typename Builder, std::size_t Pos, typename Indices>
+	struct array_slice;
+
+	template <typename T, typename Builder, std::size_t Pos, std::size_t...I>
+	struct array_slice<T, Builder, Pos, std::index_sequence<I...>>
+	{
+		using type = std::integer_sequence<T, Builder::value[Pos + I]...>;
+	};
+
+	// All of Builder::value as a sequence.
+	template <typename T, typename Builder>
+	using array_to_sequence_t = typename array_slice<T, Builder, 0, std::make_index_sequence<Builder::value.size()>>::type;
+
+	// Length characters of SeqType starting at Pos, with no bounds checking.
+	template <typename SeqType, std::size_t Pos, std::size_t Length>
+	using slice_t = typename array_slice<typename sequence_type<SeqType>::type, stored<SeqType>, Pos, std::make_index_sequence<Length>>::type;
+
+	template <typename SeqType, std::size_t Pos, std::size_t Length>
+	struct substr
+	{
+		static_assert(Pos <= size<SeqType>, "substr position is past the end of the string.");
+		static constexpr std::size_t length = Length < size<SeqType> - Pos? Length : size<SeqType> - Pos;
+		using type = slice_t<SeqType, Pos, length>;
+	};
+
+	template <typename T>
+	constexpr bool matches_at(const T* str, std::size_t pos, const T* needle, std::size_t needle_length)
+	{
+		for (std::size_t i = 0; i < needle_length; ++i)
+			if (str[pos + i] != needle[i])
+				return false;
+		return true;
+	}
+
+	template <typename T>
+	constexpr std::size_t find(const T* str, std::size_t length, const T* needle, std::size_t needle_length, std::size_t pos)
+	{
+		if (pos > length || needle_length > length - pos)
+			return npos;
+		for (std::size_t i = pos; i <= length - needle_length; ++i)
+			if (matches_at(str, i, needle, needle_length))
+				return i;
+		return npos;
+	}
+
+	template <typename T>
+	constexpr std::size_t rfind(const T* str, std::size_t length, const T* needle, std::size_t needle_length, std::size_t pos)
+	{
+		if (needle_length > length)
+			return npos;
+		std::size_t i = length - needle_length < pos? length - needle_length : pos;
+		for (;; --i)
+		{
+			if (matches_at(str, i, needle, needle_length))
+				return i;
+			if (i == 0)
+				return npos;
+		}
+	}
+
+	template <typename SeqType, typename Needle>
+	constexpr std::size_t find_in(std::size_t pos)
+	{
+		static_assert(same_char_type<SeqType, Needle>(), "The string and the needle must have the same character type.");
+		const auto str = chars(SeqType{});
+		const auto needle = chars(Needle{});
+		return find(str.data(), size<SeqType>, needle.data(), size<Needle>, pos);
+	}
+
+	template <typename SeqType, typename Needle>
+	constexpr std::size_t rfind_in(std::size_t pos)
+	{
+		static_assert(same_char_type<SeqType, Needle>(), "The string and the needle must have the same character type.");
+		const auto str = chars(SeqType{});
+		const auto needle = chars(Needle{});
+		return rfind(str.data(), size<SeqType>, needle.data(), size<Needle>, pos);
+	}
+
+	// Counts the non-overlapping occurrences of the needle, left to right.  If starts isn't null, also stores where they are.
+	template <typename T>
+	constexpr std::size_t find_all(const T* str, std::size_t length, const T* needle, std::size_t needle_length, std::size_t* starts)
+	{
+		std::size_t count = 0;
+		for (std::size_t i = find(str, length, needle, needle_length, 0); i != npos; i = find(str, length, needle, needle_length, i + needle_length))
+		{
+			if (starts)
+				starts[count] = i;
+			++count;
+		}
+		return count;
+	}
+
+	template <typename SeqType, typename Delimiter>
+	struct split
+	{
+		static_assert(same_char_type<SeqType, Delimiter>(), "The string and the delimiter must have the same character type.");
+		static_assert(size<Delimiter> > 0, "Can't split on an empty delimiter.");
+
+		static constexpr std::size_t count_delimiters()
+		{
+			const auto str = chars(SeqType{});
+			const auto delimiter = chars(Delimiter{});
+			return find_all(str.data(), size<SeqType>, delimiter.data(), size<Delimiter>, nullptr);
+		}
+
+		static constexpr std::size_t count = count_delimiters() + 1;
+
+		// Where each piece starts and how long it is.
+		struct pieces
+		{
+			std::array<std::size_t, count> starts{};
+			std::array<std::size_t, count> lengths{};
+
+			constexpr pieces()
+			{
+				const auto str = chars(SeqType{});
+				const auto delimiter = chars(Delimiter{});
+				std::array<std::size_t, count> delimiters{};
+				find_all(str.data(), size<SeqType>, delimiter.data(), size<Delimiter>, delimiters.data());
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					starts[i] = i == 0? 0 : delimiters[i - 1] + size<Delimiter>;
+					lengths[i] = (i + 1 < count? delimiters[i] : size<SeqType>) - starts[i];
+				}
+			}
+		};
+
+		static constexpr pieces value{};
+
+		template <std::size_t...I>
+		static auto make(std::index_sequence<I...>) -> std::tuple<slice_t<SeqType, value.starts[I], value.lengths[I]>...>;
+
+		using type = decltype(make(std::make_index_sequence<count>{}));
+	};
+
+	template <typename SeqType, typename From, typename To>
+	struct replace
+	{
+		static_assert(same_char_type<SeqType, From, To>(), "The string and its replacements must have the same character type.");
+		static_assert(size<From> > 0, "Can't replace an empty string.");
+
+		using T = typename sequence_type<SeqType>::type;
+
+		static constexpr std::size_t count_matches()
+		{
+			const auto str = chars(SeqType{});
+			const auto from = chars(From{});
+			return find_all(str.data(), size<SeqType>, from.data(), size<From>, nullptr);
+		}
+
+		static constexpr std::size_t count = count_matches();
+
+		static constexpr std::array<T, size<SeqType> + count * size<To> - count * size<From>> make()
+		{
+			const auto str = chars(SeqType{});
+			const auto from = chars(From{});
+			const auto to = chars(To{});
+			std::array<T, size<SeqType> + count * size<To> - count * size<From>> out{};
+			std::size_t o = 0;
+			std::size_t i = 0;
+			while (i < size<SeqType>)
+			{
+				if (i + size<From> <= size<SeqType> && matches_at(str.data(), i, from.data(), size<From>))
+				{
+					for (std::size_t j = 0; j < size<To>; ++j)
+						out[o++] = to[j];
+					i += size<From>;
+				}
+				else
+					out[o++] = str[i++];
+			}
+			return out;
+		}
+
+		static constexpr auto value = make();
+		using type = array_to_sequence_t<T, replace>;
+	};
+
+	template <typename T>
+	constexpr bool is_space(T c)
+	{
+		return c == T(' ') || c == T('\t') || c == T('\n') || c == T('\v') || c == T('\f') || c == T('\r');
+	}
+
+	template <typename SeqType>
+	struct trim
+	{
+		static constexpr std::size_t find_first()
+		{
+			const auto str = chars(SeqType{});
+			std::size_t i = 0;
+			while (i < size<SeqType> && is_space(str[i]))
+				++i;
+			return i;
+		}
+
+		static constexpr std::size_t first = find_first();
+
+		static constexpr std::size_t find_last()
+		{
+			const auto str = chars(SeqType{});
+			std::size_t i = size<SeqType>;
+			while (i > first && is_space(str[i - 1]))
+				--i;
+			return i;
+		}
+
+		using type = slice_t<SeqType, first, find_last() - first>;
+	};
+
+	template <typename T>
+	constexpr T ascii_upper(T c) { return c >= T('a') && c <= T('z')? static_cast<T>(c - T('a') + T('A')) : c; }
+
+	template <typename T>
+	constexpr T ascii_lower(T c) { return c >= T('A') && c <= T('Z')? static_cast<T>(c - T('A') + T('a')) : c; }
+
+	template <typename SeqType>
+	struct case_convert;
+
+	template <typename T, T...t>
+	struct case_convert<std::integer_sequence<T, t...>>
+	{
+		using upper = std::integer_sequence<T, ascii_upper(t)...>;
+		using lower = std::integer_sequence<T, ascii_lower(t)...>;
+	};
+
+	// Case conversion doesn't move anything, so each page can be converted on its own.
+	template <typename T, typename...Pages>
+	struct case_convert<paged<T, Pages...>>
+	{
+		using upper = paged<T, typename case_convert<Pages>::upper...>;
+		using lower = paged<T, typename case_convert<Pages>::lower...>;
+	};
+
+	template <typename SeqType, typename...Others>
+	struct concat
+	{
+		static_assert(same_char_type<SeqType, Others...>(), "Only strings with the same character type can be concatenated.");
+
+		using T = typename sequence_type<SeqType>::type;
+		static constexpr std::size_t length = (size<SeqType> + ... + size<Others>);
+
+		static constexpr std::array<T, length> make()
+		{
+			std::array<T, length> out{};
+			std::size_t o = 0;
+			auto append = [&](auto sequence) {
+				const auto str = chars(sequence);
+				for (std::size_t i = 0; i < sequence.size(); ++i)
+					out[o++] = str[i];
+			};
+			append(SeqType{});
+			(append(Others{}), ...);
+			return out;
+		}
+
+		static constexpr auto value = make();
+		using type = array_to_sequence_t<T, concat>;
+	};
+
+	// Two strings are just one pack expansion; no need to go through an array.
+	template <typename T, T...t1, T...t2>
+	struct concat<std::integer_sequence<T, t1...>, std::integer_sequence<T, t2...>>
+	{
+		using type = std::integer_sequence<T, t1..., t2...>;
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief The \c Length characters of \c SeqType starting at \c Pos, or as many as there are
+///
+/// \code
+/// static_assert(std::is_same<ctstr::substr_t<string_to_type("hello"), 1, 3>, string_to_type("ell")>::value, "");
+/// \endcode
+///
+/// Like \c std::string::substr, except a \c Pos past the end is a compile error.
+////////////////////////////////////////////////////////////
+template <typename SeqType, std::size_t Pos, std::size_t Length = npos>
+using substr_t = typename detail::substr<SeqType, Pos, Length>::type;
+
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief <tt>substr_t<SeqType, Pos, Length>{}</tt>
+template <std::size_t Pos, std::size_t Length = npos, typename SeqType>
+constexpr substr_t<SeqType, Pos, Length> substr(SeqType) { return {}; }
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief Where \c Needle first appears in \c SeqType at or after \c Pos, or \c npos
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename Needle, std::size_t Pos = 0>
+constexpr std::size_t find_v = detail::find_in<SeqType, Needle>(Pos);
+
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief <tt>find_v<SeqType, Needle></tt>, but \c pos doesn't have to be a constant
+template <typename SeqType, typename Needle>
+constexpr std::size_t find(SeqType, Needle, std::size_t pos = 0)
+{
+	static_assert(detail::same_char_type<SeqType, Needle>(), "The string and the needle must have the same character type.");
+	return detail::find(data<SeqType>, size<SeqType>, data<Needle>, size<Needle>, pos);
+}
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief Where \c Needle last appears in \c SeqType, starting at or before \c Pos, or \c npos
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename Needle, std::size_t Pos = npos>
+constexpr std::size_t rfind_v = detail::rfind_in<SeqType, Needle>(Pos);
+
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief <tt>rfind_v<SeqType, Needle></tt>, but \c pos doesn't have to be a constant
+template <typename SeqType, typename Needle>
+constexpr std::size_t rfind(SeqType, Needle, std::size_t pos = npos)
+{
+	static_assert(detail::same_char_type<SeqType, Needle>(), "The string and the needle must have the same character type.");
+	return detail::rfind(data<SeqType>, size<SeqType>, data<Needle>, size<Needle>, pos);
+}
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief \c SeqType cut up at every \c Delimiter, as an \c std::tuple of strings
+///
+/// \code
+/// using parts = ctstr::split_t<string_to_type("a,,b"), string_to_type(",")>;
+/// // std::tuple<string_to_type("a"), string_to_type(""), string_to_type("b")>
+/// \endcode
+///
+/// Empty pieces are kept, so there's always one more piece than there are delimiters.
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename Delimiter>
+using split_t = typename detail::split<SeqType, Delimiter>::type;
+
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief <tt>split_t<SeqType, Delimiter>{}</tt>
+template <typename SeqType, typename Delimiter>
+constexpr split_t<SeqType, Delimiter> split(SeqType, Delimiter) { return {}; }
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief \c SeqType with every occurrence of \c From replaced by \c To
+///
+/// Occurrences are found left to right and don't overlap, as with a "replace all" in a text editor.
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename From, typename To>
+using replace_t = typename detail::replace<SeqType, From, To>::type;
+
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief <tt>replace_t<SeqType, From, To>{}</tt>
+template <typename SeqType, typename From, typename To>
+constexpr replace_t<SeqType, From, To> replace(SeqType, From, To) { return {}; }
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief \c SeqType without whitespace (space, \c \\t, \c \\n, \c \\v, \c \\f or \c \\r) at either end
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+using trim_t = typename detail::trim<SeqType>::type;
+
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief <tt>trim_t<SeqType>{}</tt>
+template <typename SeqType>
+constexpr trim_t<SeqType> trim(SeqType) { return {}; }
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief \c SeqType with \c a to \c z changed to \c A to \c Z
+///
+/// Only ASCII letters are changed; everything else, including any non-ASCII letters, is left as it is.
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+using to_upper_t = typename detail::case_convert<SeqType>::upper;
+
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief <tt>to_upper_t<SeqType>{}</tt>
+template <typename SeqType>
+constexpr to_upper_t<SeqType> to_upper(SeqType) { return {}; }
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief \c SeqType with \c A to \c Z changed to \c a to \c z
+///
+/// \see to_upper_t
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+using to_lower_t = typename detail::case_convert<SeqType>::lower;
+
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief <tt>to_lower_t<SeqType>{}</tt>
+template <typename SeqType>
+constexpr to_lower_t<SeqType> to_lower(SeqType) { return {}; }
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief All of the strings, one after the other
+///
+/// Takes any number of strings at once without nesting one \c str_cat inside another.
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename...Others>
+using concat_t = typename detail::concat<SeqType, Others...>::type;
+
+/// \ingroup CTSTR_ALGORITHMS
+/// \brief <tt>concat_t<SeqType, Others...>{}</tt>
+template <typename SeqType, typename...Others>
+constexpr concat_t<SeqType, Others...> concat(SeqType, Others...) { return {}; }
+
+}
@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Format.hpp"
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Build.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_BUILD Building strings
+///
+/// Joining \c string_to_type strings and runtime values into one string, the way
+/// <tt>"svc." + name + ".latency.p99"</tt> would, but with a single allocation.
+///
+/// \code
+/// std::string key = ctstr::build(string_to_type("svc."){}, name, string_to_type(".latency.p99"){});
+/// \endcode
+///
+/// Each piece can be anything \c ctstr::format accepts as an argument: a \c string_to_type string, a string
+/// (anything convertible to \c std::basic_string_view), a single character, an integer, a floating point number
+/// (shortest round-trip form, written with \c std::to_chars) or a \c bool.  Neighbouring \c string_to_type strings are
+/// joined into one at compile time, so each run of them costs a single fixed-size \c memcpy.
+///
+/// The character type is that of the first \c string_to_type string, or \c char if there isn't one.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	// The pieces after merging: a run of string_to_type strings, or the runtime value that was argument I.
+	template <typename SeqType>
+	struct build_literal {};
+
+	template <std::size_t I>
+	struct build_value {};
+
+	template <typename...Pieces>
+	struct build_list {};
+
+	// Walks the argument types, holding on to a run of sequences (Pending, or void) until a runtime value ends it.
+	template <typename Done, typename Pending, std::size_t I, typename...Args>
+	struct build_plan;
+
+	template <typename...Done, typename Pending, std::size_t I>
+	struct build_plan<build_list<Done...>, Pending, I>
+	{
+		using type = std::conditional_t<std::is_void<Pending>::value, build_list<Done...>, build_list<Done..., build_literal<Pending>>>;
+	};
+
+	template <typename...Done, typename Pending, std::size_t I, typename Arg, typename...Args>
+	struct build_plan<build_list<Done...>, Pending, I, Arg, Args...>
+	{
+		template <typename Next, bool = is_sequence<Next>::value, bool = std::is_void<Pending>::value>
+		struct step;
+
+		// Another sequence: start a run with it, or add it to the end of this one.
+		template <typename Next>
+		struct step<Next, true, true> { using type = typename build_plan<build_list<Done...>, Next, I + 1, Args...>::type; };
+
+		template <typename Next>
+		struct step<Next, true, false> { using type = typename build_plan<build_list<Done...>, str_cat_t<Pending, Next>, I + 1, Args...>::type; };
+
+		// A runtime value: finish the run, if there is one.
+		template <typename Next>
+		struct step<Next, false, true> { using type = typename build_plan<build_list<Done..., build_value<I>>, void, I + 1, Args...>::type; };
+
+		template <typename Next>
+		struct step<Next, false, false> { using type = typename build_plan<build_list<Done..., build_literal<Pending>, build_value<I>>, void, I + 1, Args...>::type; };
+
+		using type = typename step<Arg>::type;
+	};
+
+	template <typename...Args>
+	using build_plan_t = typename build_plan<build_list<>, void, 0, std::decay_t<Args>...>::type;
+
+	template <typename...Args>
+	struct build_char_type { using type = char; };
+
+	template <typename Arg, typename...Args>
+	struct build_char_type<Arg, Args...>
+	{
+		using type = typename std::conditional_t<is_sequence<Arg>::value, sequence_type<Arg>, build_char_type<Args...>>::type;
+	};
+
+	template <typename CharType, typename Arg>
+	constexpr bool build_char_matches()
+	{
+		if constexpr (is_sequence<Arg>::value)
+			return std::is_same<typename sequence_type<Arg>::type, CharType>::value;
+		else
+			return true;
+	}
+
+	template <typename CharType, typename...Args>
+	constexpr bool build_check()
+	{
+		constexpr bool same = (build_char_matches<CharType, std::decay_t<Args>>() && ...);
+		static_assert(same, "Every string_to_type string given to build must have the same character type.");
+		return same;
+	}
+
+	template <typename CharType, typename Tuple, typename SeqType>
+	constexpr std::size_t build_max_size(const Tuple&, build_literal<SeqType>) { return size<SeqType>; }
+
+	template <typename CharType, typename Tuple, std::size_t I>
+	constexpr std::size_t build_max_size(const Tuple& args, build_value<I>) { return format_max_size<CharType>(std::get<I>(args)); }
+
+	template <typename CharType, typename Tuple, typename SeqType>
+	CharType* build_write(CharType* out, const Tuple&, build_literal<SeqType>) { return format_copy(out, data<SeqType>, size<SeqType>); }
+
+	template <typename CharType, typename Tuple, std::size_t I>
+	CharType* build_write(CharType* out, const Tuple& args, build_value<I>) { return format_write<CharType>(out, std::get<I>(args)); }
+
+	template <typename CharType, typename Tuple, typename...Pieces>
+	constexpr std::size_t build_size(const Tuple& args, build_list<Pieces...>)
+	{
+		static_cast<void>(args);
+		return (std::size_t{ 0 } + ... + build_max_size<CharType>(args, Pieces{}));
+	}
+
+	template <typename CharType, typename Tuple, typename...Pieces>
+	CharType* build_pieces(CharType* out, const Tuple& args, build_list<Pieces...>)
+	{
+		static_cast<void>(args);
+		((out = build_write<CharType>(out, args, Pieces{})), ...);
+		return out;
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_BUILD
+/// \brief The character type that \c build() makes strings of, given these pieces
+////////////////////////////////////////////////////////////
+template <typename...Args>
+using build_char_t = typename detail::build_char_type<std::decay_t<Args>...>::type;
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_BUILD
+/// \brief The most characters \c build_to() can write for these pieces
+///
+/// The \c string_to_type strings are counted at compile time; strings add their length,
+/// and numbers add a fixed worst case.
+////////////////////////////////////////////////////////////
+template <typename...Args>
+constexpr std::size_t build_size_bound(const Args&...args)
+{
+	if constexpr (detail::build_check<build_char_t<Args...>, Args...>())
+		return detail::build_size<build_char_t<Args...>>(std::forward_as_tuple(args...), detail::build_plan_t<Args...>{});
+	else
+		return 0;
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_BUILD
+/// \brief Writes the pieces one after another to \c out, which must have room for at least \c build_size_bound() characters
+///
+/// No null terminator is written.
+///
+/// \return A pointer just past the last character written
+////////////////////////////////////////////////////////////
+template <typename...Args>
+build_char_t<Args...>* build_to(build_char_t<Args...>* out, const Args&...args)
+{
+	if constexpr (detail::build_check<build_char_t<Args...>, Args...>())
+		return detail::build_pieces(out, std::forward_as_tuple(args...), detail::build_plan_t<Args...>{});
+	else
+		return out;
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_BUILD
+/// \brief Joins the pieces into a new string, with exactly one allocation
+///
+/// \code
+/// ctstr::build(string_to_type("svc."){}, name, string_to_type(".latency.p"){}, 99);
+/// \endcode
+////////////////////////////////////////////////////////////
+template <typename...Args>
+std::basic_string<build_char_t<Args...>> build(const Args&...args)
+{
+	std::basic_string<build_char_t<Args...>> result;
+	result.resize(build_size_bound(args...));
+	result.resize(static_cast<std::size_t>(build_to(&result[0], args...) - result.data()));
+	return result;
+}
+
+}
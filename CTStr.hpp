@@ -26,8 +26,13 @@
 
 #include <cstdint>
 #include <string>
+#include <type_traits>
 #include <utility>
 
+#if (defined(_MSVC_LANG) ? _MSVC_LANG : __cplusplus) >= 201703L
+#include <string_view>
+#endif
+
 ////////////////////////////////////////////////////////////
 /// \file
 ////////////////////////////////////////////////////////////
@@ -74,6 +79,40 @@
 #define CTSTR_SEQUENCE_TYPE std::integer_sequence
 #endif
 
+#ifndef CTSTR_USE_NTTP
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR
+/// \brief Selects the C++20 engine behind \c string_to_type
+///
+/// By default \c string_to_type is built out of a macro tree that is always \c CTSTR_MAX_STRING_SIZE
+/// characters wide, so even \c "foo" costs as much to compile as the longest string you allow.
+/// \c #define this to 1 on a C++20 compiler and the string is instead passed as a class-type
+/// non-type template argument, which makes the compile cost proportional to the actual length of the string.
+///
+/// Both engines produce exactly the same \c std::integer_sequence types, so they can be mixed freely
+/// between translation units.  \c CTSTR_MAX_STRING_SIZE is ignored when this is enabled.
+////////////////////////////////////////////////////////////
+#define CTSTR_USE_NTTP 0
+#endif
+
+#ifndef CTSTR_PREGENERATED_HEADER
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR
+/// \brief A header of ready-made sequences for \c string_to_type to look strings up in
+///
+/// Not defined by default.  \c tools/pregenerate.py finds every \c string_to_type literal in your sources and writes
+/// out the \c std::integer_sequence for each one; \c #define this to that header's name (quotes and all, as in
+/// <tt>-DCTSTR_PREGENERATED_HEADER='"ctstr_literals.hpp"'</tt>) and \c string_to_type finds its strings there by a
+/// 128-bit hash instead of building them.  That skips both the macro tree and the \c str_cat_t chain, and
+/// \c CTSTR_MAX_STRING_SIZE no longer applies.
+///
+/// The types are exactly the same either way.  A string that isn't in the header is a compile error, unless
+/// \c CTSTR_USE_NTTP is on, in which case it's built in the usual way.
+////////////////////////////////////////////////////////////
+#define CTSTR_PREGENERATED_HEADER
+#undef CTSTR_PREGENERATED_HEADER
+#endif
+
 
 
 ////////////////////////////////////////////////////////////
@@ -88,8 +127,26 @@
 #define CTSTR_INVALID_CHAR static_cast<CTSTR_EXPANDED_CHAR_TYPE>(-1)
 // Determines the number of characters in a string, excluding the null terminator
 #define CTSTR_STRLEN(str) ((sizeof(str) - 1) / (sizeof(*str)))
+// The language version being compiled against.  MSVC leaves __cplusplus at 199711L unless told otherwise.
+#if defined(_MSVC_LANG)
+#define CTSTR_CPLUSPLUS _MSVC_LANG
+#else
+#define CTSTR_CPLUSPLUS __cplusplus
+#endif
+
+
+
+#if CTSTR_USE_NTTP
 
+#if CTSTR_CPLUSPLUS <= 201703L
+#error CTSTR_USE_NTTP requires C++20 (class types as non-type template parameters)
+#endif
+
+// The string literal itself becomes the template argument, so there's only one instantiation per string
+// and std::make_index_sequence takes care of exploding it into the individual characters.
+#define string_to_type(str) ::ctstr::detail::literal_to_sequence_t<::ctstr::detail::string_literal{str}>
 
+#else
 
 // These macros are used as helpers to build the "final" string_to_type macro
 
@@ -166,6 +223,26 @@ typename ::ctstr::detail::make_helper							\
 #error CTSTR_MAX_STRING_SIZE must be a power of 2
 #endif
 
+#endif
+
+#ifdef CTSTR_PREGENERATED_HEADER
+
+// The key tools/pregenerate.py files each string under: its character type, two different 64-bit hashes of its characters, and its length.
+#define CTSTR_PREGENERATED_KEY(str) 										\
+	std::decay_t<decltype(*str)>,										\
+	::ctstr::detail::pregenerated_hash(str, CTSTR_STRLEN(str), 0xcbf29ce484222325ull, 0x100000001b3ull),	\
+	::ctstr::detail::pregenerated_hash(str, CTSTR_STRLEN(str), 0x84222325cbf29ce4ull, 0x9e3779b97f4a7c15ull),	\
+	CTSTR_STRLEN(str)
+
+#undef string_to_type
+#if CTSTR_USE_NTTP
+#define string_to_type(str) typename ::ctstr::detail::pregenerated_or_literal<::ctstr::detail::pregenerated<CTSTR_PREGENERATED_KEY(str)>, ::ctstr::detail::string_literal{str}>::type
+#else
+#define string_to_type(str) typename ::ctstr::detail::pregenerated_lookup<::ctstr::detail::pregenerated<CTSTR_PREGENERATED_KEY(str)>>::type
+#endif
+
+#endif
+
 ////////////////////////////////////////////////////////////
 /// \endcond
 ////////////////////////////////////////////////////////////
@@ -176,6 +253,9 @@ namespace ctstr
 ////////////////////////////////////////////////////////////
 /// \cond INTERNAL
 ////////////////////////////////////////////////////////////
+template <typename T>
+struct sequence_type;
+
 namespace detail
 {
 	template <typename Seq1, typename Seq2>
@@ -204,7 +284,7 @@ namespace detail
 	struct make_helper
 	{
 		static_assert(Valid, "This string is too long; it won't fit in MAX_STRING_SIZE.  Increase MAX_STRING_SIZE or shorten this string.");
-		using type = std::integer_sequence<T, Value>;
+		using type = std::integer_sequence<T, static_cast<T>(Value)>;
 	};
 
 	// Same as above, but specialized for 0 to make std::integer_sequence<T, 0> go to std::integer_sequence<T>
@@ -219,9 +299,101 @@ namespace detail
 	template <typename CharType>
 	constexpr CTSTR_EXPANDED_CHAR_TYPE c_str_lit_at_or_eol(const CharType* str, std::size_t strLength, std::size_t index)
 	{
-		return index >= strLength? CTSTR_INVALID_CHAR : static_cast<CTSTR_EXPANDED_CHAR_TYPE>(str[index]);
+		// Going through the unsigned type first keeps negative chars (anything non-ASCII where char is signed) from turning into CTSTR_INVALID_CHAR.
+		return index >= strLength? CTSTR_INVALID_CHAR : static_cast<CTSTR_EXPANDED_CHAR_TYPE>(static_cast<std::make_unsigned_t<CharType>>(str[index]));
 	}
 
+#if CTSTR_USE_NTTP
+	// Holds a copy of a string literal so that it can be used as a template argument.
+	// The null terminator is kept in the array but not counted in size, same as CTSTR_STRLEN.
+	template <typename CharType, std::size_t N>
+	struct string_literal
+	{
+		constexpr string_literal(const CharType (&str)[N])
+		{
+			for (std::size_t i = 0; i < N; ++i)
+				chars[i] = str[i];
+		}
+
+		static constexpr std::size_t size = N - 1;
+		CharType chars[N];
+	};
+
+	template <auto Literal, typename Indices = std::make_index_sequence<decltype(Literal)::size>>
+	struct literal_to_sequence;
+
+	template <auto Literal, std::size_t...I>
+	struct literal_to_sequence<Literal, std::index_sequence<I...>>
+	{
+		using type = std::integer_sequence<std::decay_t<decltype(*Literal.chars)>, Literal.chars[I]...>;
+	};
+
+	template <auto Literal>
+	using literal_to_sequence_t = typename literal_to_sequence<Literal>::type;
+#endif
+
+	// FNV-1a over whole characters, with the basis and prime as parameters so two different hashes can come out of it.
+	// tools/pregenerate.py works out the same thing in Python.
+	template <typename CharType>
+	constexpr std::uint64_t pregenerated_hash(const CharType* str, std::size_t length, std::uint64_t basis, std::uint64_t prime)
+	{
+		std::uint64_t hash = basis;
+		for (std::size_t i = 0; i < length; ++i)
+			hash = (hash ^ static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<CharType>>(str[i]))) * prime;
+		return hash;
+	}
+
+	// Specialized by CTSTR_PREGENERATED_HEADER for every string it holds, with a str() that returns it.  The header
+	// holds literals rather than sequences so that it's cheap to parse; only the strings a translation unit uses are
+	// turned into sequences.
+	template <typename T, std::uint64_t Hash1, std::uint64_t Hash2, std::size_t Length>
+	struct pregenerated
+	{
+		static constexpr bool found = false;
+	};
+
+	struct pregenerated_entry
+	{
+		static constexpr bool found = true;
+	};
+
+	template <typename T, typename Entry, typename Indices>
+	struct pregenerated_sequence;
+
+	template <typename T, typename Entry, std::size_t...I>
+	struct pregenerated_sequence<T, Entry, std::index_sequence<I...>>
+	{
+		using type = std::integer_sequence<T, Entry::str()[I]...>;
+	};
+
+	template <typename Entry, bool Found = Entry::found>
+	struct pregenerated_lookup;
+
+	template <typename T, std::uint64_t Hash1, std::uint64_t Hash2, std::size_t Length>
+	struct pregenerated_lookup<pregenerated<T, Hash1, Hash2, Length>, true>
+		: pregenerated_sequence<T, pregenerated<T, Hash1, Hash2, Length>, std::make_index_sequence<Length>> {};
+
+	template <typename Entry>
+	struct pregenerated_lookup<Entry, false>
+	{
+		static_assert(sizeof(Entry) == 0, "This string isn't in CTSTR_PREGENERATED_HEADER.  Run tools/pregenerate.py over your sources again.");
+		using type = std::integer_sequence<char>;
+	};
+
+#if CTSTR_USE_NTTP
+	template <typename Entry, auto Literal, bool Found = Entry::found>
+	struct pregenerated_or_literal
+	{
+		using type = typename pregenerated_lookup<Entry>::type;
+	};
+
+	template <typename Entry, auto Literal>
+	struct pregenerated_or_literal<Entry, Literal, false>
+	{
+		using type = literal_to_sequence_t<Literal>;
+	};
+#endif
+
 
 
 	//template <typename SeqType>
@@ -236,18 +408,34 @@ namespace detail
 	//	}
 	//};
 
-	template <typename T, T...t>
-	auto to_string_helper(std::integer_sequence<T, t...>)
+	// The null-terminated characters of a sequence, as a constexpr array in read-only memory.
+	// Static data members of class templates are merged by the linker, so there's only ever one copy of each
+	// no matter how many translation units use it.  Alignment 0 means "whatever T normally needs".
+	template <typename SeqType, std::size_t Alignment>
+	struct sequence_storage;
+
+	template <typename T, T...t, std::size_t Alignment>
+	struct sequence_storage<std::integer_sequence<T, t...>, Alignment>
+	{
+		static_assert(Alignment == 0 || (Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0), "Alignment must be 0 or a power of 2 no smaller than alignof(T).");
+		alignas(Alignment == 0? alignof(T) : Alignment) static constexpr T array[] = { t..., T() };
+	};
+
+	template <typename T, T...t, std::size_t Alignment>
+	constexpr T sequence_storage<std::integer_sequence<T, t...>, Alignment>::array[];
+
+	// Anything with a sequence_storage and a size() works here, not just std::integer_sequence (see Paged.hpp).
+	template <typename SeqType>
+	auto to_string_helper(SeqType)
 	{
-		return std::basic_string<T>({ t... });
+		return std::basic_string<typename sequence_type<SeqType>::type>(sequence_storage<SeqType, 0>::array, SeqType::size());
 	}
 
 
-	template <typename T, T...t>
-	auto to_c_string_helper(std::integer_sequence<T, t...>)
+	template <typename SeqType>
+	auto to_c_string_helper(SeqType)
 	{
-		const static T array[] = { t..., '\0' };
-		return array;
+		return static_cast<const typename sequence_type<SeqType>::type*>(sequence_storage<SeqType, 0>::array);
 	}
 	}
 
@@ -256,6 +444,11 @@ struct sequence_type;
 template <typename T, T...t>
 struct sequence_type<std::integer_sequence<T, t...>> { using type = T; };
 
+template <typename T>
+struct is_sequence : std::false_type {};
+template <typename T, T...t>
+struct is_sequence<std::integer_sequence<T, t...>> : std::true_type {};
+
 ////////////////////////////////////////////////////////////
 /// \endcond
 ////////////////////////////////////////////////////////////
@@ -308,7 +501,62 @@ auto to_c_string(SeqType sequence = SeqType{})
 }
 
 
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR
+/// \brief Pointer to the null-terminated characters of a string returned from \c string_to_type
+///
+/// Same memory that \c to_c_string() returns, but available as a constant expression, so
+/// <tt>static_assert(ctstr::data<string_to_type("foo")>[0] == 'f', "")</tt> works.
+/// The array lives in read-only memory and is shared between all translation units.
+///
+/// If you want to use the array as the source of aligned (e.g. SIMD) loads,
+/// pass the alignment you need as \c Alignment.  Each alignment gets its own copy of the array.
+///
+/// \see size, to_string_view()
+////////////////////////////////////////////////////////////
+template <typename SeqType, std::size_t Alignment = 0>
+constexpr const typename sequence_type<SeqType>::type* data = detail::sequence_storage<SeqType, Alignment>::array;
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR
+/// \brief The number of characters in a string returned from \c string_to_type, excluding the null terminator
+///
+/// \see data
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+constexpr std::size_t size = SeqType::size();
+
+
+#if CTSTR_CPLUSPLUS >= 201703L
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR
+/// \brief Turns a string returned from \c string_to_type into an \c std::string_view
+///
+/// Like \c to_string(), but nothing is ever allocated or copied; the view points into
+/// the same read-only array as \c data, and the whole thing can be used in constant expressions.
+/// Only available in C++17 and up.
+///
+/// \see to_string(), data
+///
+/// \param sequence Optional.  Used solely to avoid explicity typing the template argument.
+///
+/// \return An \c std::basic_string_view of your characters
+////////////////////////////////////////////////////////////
+template <typename SeqType, std::size_t Alignment = 0>
+constexpr auto to_string_view(SeqType sequence = SeqType{})
+{
+	static_cast<void>(sequence);
+	return std::basic_string_view<typename sequence_type<SeqType>::type>(data<SeqType, Alignment>, size<SeqType>);
 }
+#endif
+
+
+}
+
+#ifdef CTSTR_PREGENERATED_HEADER
+#include CTSTR_PREGENERATED_HEADER
+#endif
 
 
 
@@ -545,13 +793,16 @@ auto to_c_string(SeqType sequence = SeqType{})
 ///
 ///  - Use <tt>string_to_type("string")</tt> to create an \c std::integer_sequence that contains the same characters as \c "string".
 ///  - All string types are supported, so <tt>string_to_type(U"string")</tt> works too.
-///  - This library only creates the strings.  If you want things like string splitting, finding, etc. you'll want a library that operates on <tt>std::integer_sequence</tt>s.
-/// This is mostly a matter of practicality; there's no point in reinventing the wheel when other solutions exist already.
+///  - Use \c to_string_view() (C++17), or \c data and \c size, to get at the characters without allocating anything.
+///  - \c CTStr.hpp only creates the strings.  For splitting, finding and so on, \c Algorithms.hpp works on the same <tt>std::integer_sequence</tt>s without recursing a character at a time,
+/// so it copes with strings right up to \c CTSTR_MAX_STRING_SIZE 0x10000.
 ///  - If your compiler/library doesn't support C++14 and so doesn't have \c std::integer_sequence, make your own and \c #define \c CTSTR_SEQUENCE_TYPE to be your custom type.
 ///  - *Be careful if you're using Unicode characters in your strings!* Seriously.  
 /// If you don't know what Unicode Normalization Forms are, all you need to know that it's *not* safe to just compare two Unicode string together without some additional preprocessing.
 /// Save yourself the trouble of wondering why <tt>static_assert(std::is_same<string_to_type(U"á"), string_to_type(U"á")>::value)</tt> is failing and just stay away.
 /// (Protip: The first is <tt>std::integer_sequence<char32_t, 97, 769></tt> and the second is <tt>std::integer_sequence<char32_t, 225></tt>. Both are considered canonically equivilant but \c is_same doesn't know that.)
+///  - On a C++20 compiler, \c #define \c CTSTR_USE_NTTP to 1 to make compile cost proportional to the length of each string instead of \c CTSTR_MAX_STRING_SIZE.
+/// The resulting types are identical either way.
 ////////////////////////////////////////////////////////////
 
 
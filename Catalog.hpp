@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Catalog.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_CATALOG Catalog
+///
+/// Translation tables built out of \c string_to_type strings.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	// A translation can be given as anything a string_view can be made from, or as another string_to_type string.
+	template <typename CharType, typename T>
+	constexpr std::basic_string_view<CharType> catalog_view(const T& value)
+	{
+		if constexpr (is_sequence<T>::value)
+			return to_string_view<T>();
+		else
+			return std::basic_string_view<CharType>(value);
+	}
+
+	template <typename...Languages, std::size_t...I>
+	constexpr bool catalog_languages_in_order(std::index_sequence<I...>)
+	{
+		return ((static_cast<std::size_t>(Languages::value) == I) && ...);
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_CATALOG
+/// \brief Looks up a translation of a \c string_to_type string with a single array access
+///
+/// \c Translations is a class with an overloaded, \c constexpr, static \c get function for each combination of string and language,
+/// the same way \c get_translation is overloaded in the example.  Each one returns the translated text
+/// (a string literal, an \c std::string_view, or another \c string_to_type string).  To stop at a null character
+/// like \c to_c_string() does, return <tt>ctstr::data<decltype(s)></tt>.
+///
+/// \c Languages are tag types with a \c value that is their index, like <tt>std::integral_constant<int, 0></tt>, and so on.
+///
+/// For every string that's looked up, the catalog makes one array in read-only memory with a \c std::string_view for each language,
+/// so \c get() is a single indexed load and never allocates.  Just like with the overloaded functions,
+/// looking up a string that's missing a translation for any of the languages is a compile error.
+///
+/// \code
+/// struct translations
+/// {
+///     static constexpr auto get(string_to_type(u8"Hello!") s, english)  { return s; }
+///     static constexpr auto get(string_to_type(u8"Hello!"),   japanese) { return u8"こんにちは！"; }
+/// };
+/// using catalog = ctstr::catalog<translations, english, japanese>;
+///
+/// std::string_view text = catalog::get<string_to_type(u8"Hello!")>(language::japanese);
+/// \endcode
+////////////////////////////////////////////////////////////
+template <typename Translations, typename...Languages>
+struct catalog
+{
+	static_assert(detail::catalog_languages_in_order<Languages...>(std::index_sequence_for<Languages...>{}), "Each language's value must be its position in the list of languages (0, 1, 2, ...).");
+
+	/// Number of languages.
+	static constexpr std::size_t language_count = sizeof...(Languages);
+
+	/// The translations of \c String, indexed by language.
+	template <typename String>
+	static constexpr std::basic_string_view<typename sequence_type<String>::type> table[sizeof...(Languages)] =
+	{
+		detail::catalog_view<typename sequence_type<String>::type>(Translations::get(String{}, Languages{}))...
+	};
+
+	////////////////////////////////////////////////////////////
+	/// \brief The translation of \c String into \c language
+	///
+	/// \param language The language's value; an enum or an integer
+	////////////////////////////////////////////////////////////
+	template <typename String, typename Language>
+	static constexpr std::basic_string_view<typename sequence_type<String>::type> get(Language language)
+	{
+		assert(static_cast<std::size_t>(language) < sizeof...(Languages) && "Unknown language!");
+		return table<String>[static_cast<std::size_t>(language)];
+	}
+
+	/// Same as <tt>get<String>(language)</tt>, with the string passed as an argument.
+	template <typename String, typename Language>
+	static constexpr std::basic_string_view<typename sequence_type<String>::type> get(String, Language language)
+	{
+		return get<String>(language);
+	}
+};
+
+}
@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Compare.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \cond IGNORE
+////////////////////////////////////////////////////////////
+
+#if !defined(CTSTR_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define CTSTR_SSE2 1
+#include <emmintrin.h>
+#else
+#define CTSTR_SSE2 0
+#endif
+
+#if !defined(CTSTR_NO_SIMD) && defined(__AVX2__)
+#define CTSTR_AVX2 1
+#include <immintrin.h>
+#else
+#define CTSTR_AVX2 0
+#endif
+
+#if defined(_MSC_VER)
+#define CTSTR_FORCEINLINE __forceinline
+#else
+#define CTSTR_FORCEINLINE inline __attribute__((always_inline))
+#endif
+
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_COMPARE Comparison
+///
+/// Comparing runtime strings against strings made with \c string_to_type.
+///
+/// Since the length and characters of the \c string_to_type string are constants, the comparison is
+/// unrolled completely at compile time: first the length is checked, then the bytes are compared
+/// 32 at a time (AVX2), 16 at a time (SSE2), and then with 8/4/2/1-byte integer loads for the remainder.
+/// There are no loops and nothing ever looks for a null terminator.  Strings longer than 256 bytes, which unrolling
+/// would only bloat, are compared with \c std::memcmp instead, so there's no limit on how long they can be.
+///
+/// \c #define \c CTSTR_NO_SIMD to use only the integer loads.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	template <typename T>
+	CTSTR_FORCEINLINE T load(const unsigned char* p)
+	{
+		T value;
+		std::memcpy(&value, p, sizeof(T));
+		return value;
+	}
+
+	// True if the Length bytes starting at a + Offset equal those at b + Offset.
+	// b is a sequence_storage array aligned to 32 bytes, and the SIMD chunks come first, so they can use aligned loads for it.
+	template <std::size_t Offset, std::size_t Length>
+	CTSTR_FORCEINLINE bool equal_bytes(const unsigned char* a, const unsigned char* b)
+	{
+		if constexpr (Length == 0)
+			return true;
+#if CTSTR_AVX2
+		else if constexpr (Length >= 32)
+		{
+			__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + Offset));
+			__m256i y = _mm256_load_si256(reinterpret_cast<const __m256i*>(b + Offset));
+			return _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)) == -1 && equal_bytes<Offset + 32, Length - 32>(a, b);
+		}
+#endif
+#if CTSTR_SSE2
+		else if constexpr (Length >= 16)
+		{
+			__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + Offset));
+			__m128i y = _mm_load_si128(reinterpret_cast<const __m128i*>(b + Offset));
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) == 0xFFFF && equal_bytes<Offset + 16, Length - 16>(a, b);
+		}
+#endif
+		else if constexpr (Length > 16)
+			return load<std::uint64_t>(a + Offset) == load<std::uint64_t>(b + Offset) && equal_bytes<Offset + 8, Length - 8>(a, b);
+		// What's left fits in two (possibly overlapping) loads of the same size.
+		else if constexpr (Length > 8)
+			return ((load<std::uint64_t>(a + Offset) ^ load<std::uint64_t>(b + Offset))
+			      | (load<std::uint64_t>(a + Offset + Length - 8) ^ load<std::uint64_t>(b + Offset + Length - 8))) == 0;
+		else if constexpr (Length > 4)
+			return ((load<std::uint32_t>(a + Offset) ^ load<std::uint32_t>(b + Offset))
+			      | (load<std::uint32_t>(a + Offset + Length - 4) ^ load<std::uint32_t>(b + Offset + Length - 4))) == 0;
+		else if constexpr (Length > 2)
+			return ((load<std::uint16_t>(a + Offset) ^ load<std::uint16_t>(b + Offset))
+			      | (load<std::uint16_t>(a + Offset + Length - 2) ^ load<std::uint16_t>(b + Offset + Length - 2))) == 0;
+		else if constexpr (Length == 2)
+			return load<std::uint16_t>(a + Offset) == load<std::uint16_t>(b + Offset);
+		else
+			return a[Offset] == b[Offset];
+	}
+
+	// Longer strings than this go to memcmp, which loops over them just as well without the code for every block being
+	// inlined (and without a level of template recursion per block, which long paged strings would run out of).
+	constexpr std::size_t unroll_limit = 256;
+
+	template <typename SeqType, typename CharType>
+	CTSTR_FORCEINLINE bool equal_chars(const CharType* str)
+	{
+		static_assert(std::is_same<typename sequence_type<SeqType>::type, CharType>::value, "The string has a different character type than the sequence.");
+		constexpr std::size_t bytes = size<SeqType> * sizeof(CharType);
+		if constexpr (bytes > unroll_limit)
+			return std::memcmp(str, data<SeqType, 32>, bytes) == 0;
+		else
+			return equal_bytes<0, bytes>(reinterpret_cast<const unsigned char*>(str), reinterpret_cast<const unsigned char*>(data<SeqType, 32>));
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_COMPARE
+/// \brief Checks whether the \c length characters at \c str are exactly the string \c SeqType
+///
+/// \code
+/// if (ctstr::equals<string_to_type("Content-Length")>(name, nameLength))
+///     ...
+/// \endcode
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename CharType>
+CTSTR_FORCEINLINE bool equals(const CharType* str, std::size_t length)
+{
+	return length == size<SeqType> && detail::equal_chars<SeqType>(str);
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_COMPARE
+/// \brief Checks whether \c str is exactly the string \c SeqType
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename CharType>
+CTSTR_FORCEINLINE bool equals(std::basic_string_view<CharType> str)
+{
+	return equals<SeqType>(str.data(), str.size());
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_COMPARE
+/// \brief Checks whether the \c length characters at \c str begin with the string \c SeqType
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename CharType>
+CTSTR_FORCEINLINE bool starts_with(const CharType* str, std::size_t length)
+{
+	return length >= size<SeqType> && detail::equal_chars<SeqType>(str);
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_COMPARE
+/// \brief Checks whether \c str begins with the string \c SeqType
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename CharType>
+CTSTR_FORCEINLINE bool starts_with(std::basic_string_view<CharType> str)
+{
+	return starts_with<SeqType>(str.data(), str.size());
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_COMPARE
+/// \brief Checks whether the \c length characters at \c str end with the string \c SeqType
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename CharType>
+CTSTR_FORCEINLINE bool ends_with(const CharType* str, std::size_t length)
+{
+	return length >= size<SeqType> && detail::equal_chars<SeqType>(str + (length - size<SeqType>));
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_COMPARE
+/// \brief Checks whether \c str ends with the string \c SeqType
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename CharType>
+CTSTR_FORCEINLINE bool ends_with(std::basic_string_view<CharType> str)
+{
+	return ends_with<SeqType>(str.data(), str.size());
+}
+
+}
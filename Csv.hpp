@@ -0,0 +1,852 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Compare.hpp"
+#include "MappedCatalog.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Csv.hpp requires C++17
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_CSV CSV
+///
+/// Reading CSV (or TSV) files with a fixed header straight into one array per column,
+/// with the column names as \c string_to_type strings.
+///
+/// \code
+/// using trades = ctstr::csv_schema<
+///     ctstr::col<string_to_type("ts"), std::int64_t>,
+///     ctstr::col<string_to_type("user"), std::string_view>,
+///     ctstr::col<string_to_type("price"), double>>;
+///
+/// trades::table t = trades::parse_file("trades.csv");
+/// for (std::size_t i = 0; i < t.size(); ++i)
+///     total += ctstr::get<string_to_type("price")>(t)[i];
+/// \endcode
+///
+/// The header row is checked against the column names once, field by field, and after that each field is
+/// converted straight to its column's type, without being looked up by name or kept around as text.
+/// Fields are found 64 bytes at a time: each block is compared against the delimiter, newline and quote at once
+/// (with AVX2 or SSE2 when they're available) and the results kept as a bitmask, so finding the end of a field is
+/// usually one count-trailing-zeros rather than a loop over its bytes.
+///
+/// Large inputs are split into chunks that are parsed on separate threads.  A first pass, also split across the threads,
+/// counts the quotes and the rows in each chunk, so each column is allocated once at its final size and every thread
+/// writes its rows straight into place.  Since a quoted field can contain newlines, a row only ends at a newline with an
+/// even number of quotes before it, which is why a quote in the middle of an unquoted field is an error rather than part of its text.
+///
+/// Fields follow RFC 4180: they can be quoted, with <tt>""</tt> for a quote inside them, and rows can end in
+/// \c \\n or \c \\r\\n.  Columns can be \c bool (\c true or \c false), \c char (exactly one character), any other
+/// integer or floating point type (an empty floating point field is NaN), \c std::string or \c std::string_view.
+/// That's what \c ctstr::write_csv writes, so anything it writes can be read back.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_CSV
+/// \brief A column called \c SeqType, read as values of type \c T
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename T>
+struct col
+{
+	static_assert(std::is_same<typename sequence_type<SeqType>::type, char>::value, "Column names must be strings of char.");
+	static_assert(std::is_arithmetic<T>::value || std::is_same<T, std::string>::value || std::is_same<T, std::string_view>::value,
+	              "Columns can only be read as bool, char, other integers, floating point, std::string or std::string_view.");
+
+	using key = SeqType;
+	using type = T;
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_CSV
+/// \brief Thrown when the input doesn't match the schema
+////////////////////////////////////////////////////////////
+class csv_error : public std::runtime_error
+{
+public:
+	csv_error(const std::string& what, std::size_t row, std::size_t column) : std::runtime_error(what), m_row(row), m_column(column) {}
+
+	/// The row the error is in, counting the header as row 0 (so data row \c i of the table is row <tt>i + 1</tt>).
+	std::size_t row() const { return m_row; }
+
+	/// The index of the column the error is in.
+	std::size_t column() const { return m_column; }
+
+private:
+	std::size_t m_row;
+	std::size_t m_column;
+};
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	template <typename Key, typename...Columns>
+	constexpr std::size_t csv_name_count()
+	{
+		return (std::size_t{ 0 } + ... + std::is_same<typename Columns::key, Key>::value);
+	}
+
+	// Chunks smaller than this aren't worth a thread.
+	constexpr std::size_t csv_min_chunk = 1u << 20;
+
+	inline std::size_t csv_lowest_bit(std::uint64_t mask)
+	{
+#if defined(_MSC_VER) && defined(_M_X64)
+		unsigned long index;
+		_BitScanForward64(&index, mask);
+		return index;
+#elif defined(__GNUC__) || defined(__clang__)
+		return static_cast<std::size_t>(__builtin_ctzll(mask));
+#else
+		std::size_t index = 0;
+		for (; !(mask & 1); mask >>= 1)
+			++index;
+		return index;
+#endif
+	}
+
+	// A bit for each of the 64 bytes at p that's a, b or c.
+	CTSTR_FORCEINLINE std::uint64_t csv_match(const char* p, char a, char b, char c)
+	{
+#if CTSTR_AVX2
+		const __m256i va = _mm256_set1_epi8(a), vb = _mm256_set1_epi8(b), vc = _mm256_set1_epi8(c);
+		auto half = [&](const char* h) {
+			__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h));
+			__m256i m = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, va), _mm256_cmpeq_epi8(v, vb)), _mm256_cmpeq_epi8(v, vc));
+			return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(m)));
+		};
+		return half(p) | half(p + 32) << 32;
+#elif CTSTR_SSE2
+		const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b), vc = _mm_set1_epi8(c);
+		auto quarter = [&](const char* q) {
+			__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+			__m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb)), _mm_cmpeq_epi8(v, vc));
+			return static_cast<std::uint64_t>(_mm_movemask_epi8(m));
+		};
+		return quarter(p) | quarter(p + 16) << 16 | quarter(p + 32) << 32 | quarter(p + 48) << 48;
+#else
+		std::uint64_t mask = 0;
+		for (std::size_t i = 0; i < 64; ++i)
+			mask |= static_cast<std::uint64_t>(p[i] == a || p[i] == b || p[i] == c) << i;
+		return mask;
+#endif
+	}
+
+	inline std::size_t csv_popcount(std::uint64_t mask)
+	{
+#if defined(_MSC_VER) && defined(_M_X64)
+		return static_cast<std::size_t>(__popcnt64(mask));
+#elif defined(__GNUC__) || defined(__clang__)
+		return static_cast<std::size_t>(__builtin_popcountll(mask));
+#else
+		std::size_t count = 0;
+		for (; mask; mask &= mask - 1)
+			++count;
+		return count;
+#endif
+	}
+
+	struct csv_counts
+	{
+		// Rows that start in the chunk if it starts outside a quoted field, and if it starts inside one.
+		std::size_t rows_if_outside = 0;
+		std::size_t rows_if_inside = 0;
+		// Whether it has an odd number of quotes, so that the next chunk starts the other way round.
+		bool odd = false;
+	};
+
+	// Counts the newlines in the length bytes at p that end a row, i.e. that aren't in a quoted field.
+	inline csv_counts csv_count_rows(const char* p, std::size_t length)
+	{
+		std::size_t newlines = 0, outside = 0;
+		// All ones when the next block starts inside a quoted field.
+		std::uint64_t inside = 0;
+		auto block = [&](const char* b) {
+			std::uint64_t quotes = csv_match(b, '"', '"', '"'), lines = csv_match(b, '\n', '\n', '\n');
+			// Bit i of the prefix XOR is set when there's an odd number of quotes up to and including byte i.
+			std::uint64_t in = quotes;
+			for (unsigned shift = 1; shift < 64; shift *= 2)
+				in ^= in << shift;
+			in ^= inside;
+			newlines += csv_popcount(lines);
+			outside += csv_popcount(lines & ~in);
+			inside = std::uint64_t{ 0 } - (in >> 63);
+		};
+
+		std::size_t i = 0;
+		for (; i + 64 <= length; i += 64)
+			block(p + i);
+		if (i < length)
+		{
+			char tail[64] = {};
+			std::memcpy(tail, p + i, length - i);
+			block(tail);
+		}
+
+		csv_counts out;
+		out.rows_if_outside = outside;
+		out.rows_if_inside = newlines - outside;
+		out.odd = inside != 0;
+		return out;
+	}
+
+	// Finds the delimiters, newlines and quotes in text, a block of 64 bytes at a time.
+	class csv_scanner
+	{
+	public:
+		csv_scanner(const char* text, std::size_t size, char delimiter) : m_text(text), m_size(size), m_delimiter(delimiter) {}
+
+		// The position of the first delimiter, newline or quote at or after pos, or the size of the text if there isn't one.
+		CTSTR_FORCEINLINE std::size_t next(std::size_t pos)
+		{
+			std::size_t block = pos & ~std::size_t{ 63 };
+			if (block != m_block)
+			{
+				if (pos >= m_size)
+					return m_size;
+				load(block);
+			}
+			std::uint64_t mask = m_mask & (~std::uint64_t{ 0 } << (pos & 63));
+			while (mask == 0)
+			{
+				block += 64;
+				if (block >= m_size)
+					return m_size;
+				load(block);
+				mask = m_mask;
+			}
+			return block + csv_lowest_bit(mask);
+		}
+
+	private:
+		void load(std::size_t block)
+		{
+			m_block = block;
+			std::size_t left = m_size - block;
+			if (left >= 64)
+			{
+				m_mask = csv_match(m_text + block, m_delimiter, '\n', '"');
+				return;
+			}
+			// Don't read past the end of the text, and don't report the padding.
+			char tail[64] = {};
+			std::memcpy(tail, m_text + block, left);
+			m_mask = csv_match(tail, m_delimiter, '\n', '"') & ((std::uint64_t{ 1 } << left) - 1);
+		}
+
+		const char* m_text;
+		std::size_t m_size;
+		char m_delimiter;
+		// Not a multiple of 64, so the first next() always loads a block.
+		std::size_t m_block = 1;
+		std::uint64_t m_mask = 0;
+	};
+
+	struct csv_field
+	{
+		const char* data;
+		std::size_t size;
+		// Whether it was quoted and had "" in it, so its text isn't the value as it is.
+		bool escaped;
+	};
+
+	inline std::string csv_unescape(const csv_field& field)
+	{
+		std::string out;
+		out.reserve(field.size);
+		for (std::size_t i = 0; i < field.size; ++i)
+		{
+			out += field.data[i];
+			i += field.data[i] == '"';
+		}
+		return out;
+	}
+
+	template <typename T>
+	bool csv_convert(const csv_field& field, T& value)
+	{
+		const char* end = field.data + field.size;
+		if constexpr (std::is_same<T, bool>::value)
+		{
+			if (std::string_view(field.data, field.size) == "true")
+				return value = true, true;
+			if (std::string_view(field.data, field.size) == "false")
+				return value = false, true;
+			return false;
+		}
+		else if constexpr (std::is_same<T, char>::value)
+		{
+			if (field.escaped)
+				return field.size == 2 && (value = '"', true);
+			return field.size == 1 && (value = field.data[0], true);
+		}
+		else if constexpr (std::is_arithmetic<T>::value)
+		{
+			if constexpr (std::is_floating_point<T>::value)
+				if (field.size == 0)
+					return value = std::numeric_limits<T>::quiet_NaN(), true;
+			auto result = std::from_chars(field.data, end, value);
+			return result.ec == std::errc() && result.ptr == end;
+		}
+		else if constexpr (std::is_same<T, std::string>::value)
+		{
+			if (field.escaped)
+				value = csv_unescape(field);
+			else
+				value.assign(field.data, field.size);
+			return true;
+		}
+		else
+		{
+			// A view has to point into the input, so this only works for fields without escapes.
+			value = std::string_view(field.data, field.size);
+			return !field.escaped;
+		}
+	}
+
+	template <typename T>
+	constexpr const char* csv_expected()
+	{
+		if constexpr (std::is_same<T, bool>::value)
+			return "expected true or false";
+		else if constexpr (std::is_same<T, char>::value)
+			return "expected a single character";
+		else if constexpr (std::is_integral<T>::value)
+			return "expected an integer that fits the column's type";
+		else if constexpr (std::is_floating_point<T>::value)
+			return "expected a number";
+		else
+			return "a std::string_view column can't hold a field with escaped quotes";
+	}
+
+	// Splits rows into fields and converts them, from pos until the first row that starts at or after limit.
+	class csv_reader
+	{
+	public:
+		csv_reader(const char* text, std::size_t size, char delimiter, std::size_t pos)
+			: m_text(text), m_size(size), m_delimiter(delimiter), m_pos(pos), m_scanner(text, size, delimiter) {}
+
+		std::size_t position() const { return m_pos; }
+		const char* error() const { return m_error; }
+
+		// Reads the next field, which is the last in its row if last is true.  On failure, error() says why.
+		CTSTR_FORCEINLINE bool field(bool last, csv_field& out)
+		{
+			std::size_t begin = m_pos, end, after;
+			out.escaped = false;
+			if (begin < m_size && m_text[begin] == '"')
+			{
+				after = begin + 1;
+				for (;;)
+				{
+					after = m_scanner.next(after);
+					if (after == m_size)
+						return fail("a quoted field has no closing quote");
+					if (m_text[after] != '"')
+						++after;
+					else if (after + 1 < m_size && m_text[after + 1] == '"')
+					{
+						out.escaped = true;
+						after += 2;
+					}
+					else
+						break;
+				}
+				++begin;
+				end = after++;
+				if (last && after < m_size && m_text[after] == '\r')
+					++after;
+			}
+			else
+			{
+				end = after = m_scanner.next(begin);
+				if (after < m_size && m_text[after] == '"')
+					return fail("a quote in the middle of a field that isn't quoted");
+				if (last && end > begin && m_text[end - 1] == '\r')
+					--end;
+			}
+
+			if (!last)
+			{
+				if (after >= m_size || m_text[after] != m_delimiter)
+					return fail(after >= m_size || m_text[after] == '\n'? "the row has too few fields" : "unexpected text after a quoted field");
+			}
+			else if (after < m_size && m_text[after] != '\n')
+				return fail(m_text[after] == m_delimiter? "the row has too many fields" : "unexpected text after a quoted field");
+
+			out.data = m_text + begin;
+			out.size = end - begin;
+			m_pos = after + 1;
+			return true;
+		}
+
+		bool fail(const char* why)
+		{
+			m_error = why;
+			return false;
+		}
+
+	private:
+		const char* m_text;
+		std::size_t m_size;
+		char m_delimiter;
+		std::size_t m_pos;
+		csv_scanner m_scanner;
+		const char* m_error = nullptr;
+	};
+
+	// Runs f(0) ... f(count - 1) at once, one on this thread and the others on threads of their own.
+	template <typename F>
+	void csv_parallel(std::size_t count, F&& f)
+	{
+		std::vector<std::exception_ptr> errors(count);
+		auto run = [&](std::size_t i) {
+			try
+			{
+				f(i);
+			}
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> threads;
+		std::size_t started = 1;
+		try
+		{
+			threads.reserve(count - 1);
+			for (; started < count; ++started)
+				threads.emplace_back(run, started);
+		}
+		catch (...)
+		{
+			// Whatever couldn't get a thread runs here instead.
+		}
+		run(0);
+		for (std::size_t i = started; i < count; ++i)
+			run(i);
+		for (std::thread& thread : threads)
+			thread.join();
+		for (std::exception_ptr& error : errors)
+			if (error)
+				std::rethrow_exception(error);
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_CSV
+/// \brief The values in one column of a \c csv_table: an array of \c T that's filled in once and never grows
+///
+/// Unlike a \c std::vector, its elements aren't initialized when it's allocated, so that each thread
+/// parsing part of the file is the first to write to its own rows.
+////////////////////////////////////////////////////////////
+template <typename T>
+class csv_column
+{
+public:
+	using value_type = T;
+	using iterator = T*;
+	using const_iterator = const T*;
+
+	csv_column() = default;
+
+	csv_column(csv_column&& other) noexcept : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+	csv_column& operator=(csv_column&& other) noexcept
+	{
+		csv_column(std::move(other)).swap(*this);
+		return *this;
+	}
+
+	~csv_column()
+	{
+		std::destroy(m_data, m_data + m_size);
+		::operator delete(m_data);
+	}
+
+	void swap(csv_column& other) noexcept
+	{
+		std::swap(m_data, other.m_data);
+		std::swap(m_size, other.m_size);
+	}
+
+	std::size_t size() const { return m_size; }
+	bool empty() const { return m_size == 0; }
+
+	T* data() { return m_data; }
+	const T* data() const { return m_data; }
+
+	T& operator[](std::size_t i) { return m_data[i]; }
+	const T& operator[](std::size_t i) const { return m_data[i]; }
+
+	T* begin() { return m_data; }
+	T* end() { return m_data + m_size; }
+	const T* begin() const { return m_data; }
+	const T* end() const { return m_data + m_size; }
+
+private:
+	template <typename...Columns>
+	friend class csv_schema;
+
+	// Room for capacity values, none of which exist yet.
+	void allocate(std::size_t capacity)
+	{
+		m_data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+	}
+
+	T* m_data = nullptr;
+	std::size_t m_size = 0;
+};
+
+template <typename...Columns>
+class csv_schema;
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_CSV
+/// \brief The columns read by \c csv_schema<Columns...>
+///
+/// \c std::string_view values point into the text that was parsed.  When it was a file opened by
+/// \c csv_schema::parse_file, the table keeps the file mapped, so they're valid for as long as the table is.
+////////////////////////////////////////////////////////////
+template <typename...Columns>
+class csv_table
+{
+	template <typename SeqType>
+	static constexpr std::size_t index()
+	{
+		constexpr bool matches[] = { std::is_same<typename Columns::key, SeqType>::value..., false };
+		for (std::size_t i = 0; i < sizeof...(Columns); ++i)
+			if (matches[i])
+				return i;
+		return sizeof...(Columns);
+	}
+
+	template <typename SeqType>
+	using column_type = csv_column<typename std::tuple_element_t<index<SeqType>(), std::tuple<Columns..., col<SeqType, char>>>::type>;
+
+public:
+	/// The number of rows, not counting the header.
+	std::size_t size() const { return std::get<0>(m_columns).size(); }
+
+	/// The values in column \c SeqType, one per row.
+	template <typename SeqType>
+	const column_type<SeqType>& column() const
+	{
+		static_assert(index<SeqType>() < sizeof...(Columns), "The schema has no column with this name.");
+		return std::get<index<SeqType>()>(m_columns);
+	}
+
+	/// \copydoc column() const
+	template <typename SeqType>
+	column_type<SeqType>& column()
+	{
+		static_assert(index<SeqType>() < sizeof...(Columns), "The schema has no column with this name.");
+		return std::get<index<SeqType>()>(m_columns);
+	}
+
+private:
+	friend class csv_schema<Columns...>;
+
+	std::tuple<csv_column<typename Columns::type>...> m_columns;
+	detail::file_mapping m_file;
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_CSV
+/// \brief The values in column \c SeqType of \c table
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename...Columns>
+const auto& get(const csv_table<Columns...>& table)
+{
+	return table.template column<SeqType>();
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_CSV
+/// \brief The values in column \c SeqType of \c table
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename...Columns>
+auto& get(csv_table<Columns...>& table)
+{
+	return table.template column<SeqType>();
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_CSV
+/// \brief A CSV file whose header is \c Columns, in order
+///
+/// \code
+/// auto t = ctstr::csv_schema<ctstr::col<string_to_type("id"), int>, ctstr::col<string_to_type("name"), std::string>>::parse(text);
+/// \endcode
+///
+/// \c parse and \c parse_file throw \c csv_error, saying which row and column, if the header isn't exactly the
+/// column names or a field can't be read as its column's type.  Trailing text in a number, a number that doesn't
+/// fit, and rows with too few or too many fields are all errors.  The last row doesn't need a newline after it.
+////////////////////////////////////////////////////////////
+template <typename...Columns>
+class csv_schema
+{
+	static_assert(sizeof...(Columns) > 0, "A CSV schema needs at least one column.");
+	static_assert(((size<typename Columns::key> > 0) && ...), "Column names can't be empty.");
+	static_assert(((detail::csv_name_count<typename Columns::key, Columns...>() == 1) && ...), "Two columns have the same name.");
+
+	template <std::size_t I>
+	using type_at = typename std::tuple_element_t<I, std::tuple<Columns...>>::type;
+
+	using columns_type = std::tuple<csv_column<typename Columns::type>...>;
+	using row_type = std::tuple<typename Columns::type...>;
+
+	// What one thread read: how many rows it stored, and where it went wrong if it did.
+	struct chunk
+	{
+		std::size_t first_row = 0;
+		std::size_t rows = 0;
+		const char* error = nullptr;
+		std::size_t error_column = 0;
+	};
+
+public:
+	/// Number of columns.
+	static constexpr std::size_t column_count = sizeof...(Columns);
+
+	/// What \c parse returns.
+	using table = csv_table<Columns...>;
+
+	////////////////////////////////////////////////////////////
+	/// \brief Reads \c text, a header row and then any number of rows, into a \c table
+	///
+	/// \param delimiter What separates fields: \c ',' for CSV, \c '\\t' for TSV
+	/// \param threads How many threads to split the work across; 0 for one per hardware thread.
+	/// Texts under a megabyte or so per thread use fewer.
+	////////////////////////////////////////////////////////////
+	static table parse(std::string_view text, char delimiter = ',', unsigned threads = 0)
+	{
+		table out;
+		read(text.data(), text.size(), delimiter, threads, out.m_columns);
+		return out;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Maps the file at \c path and reads it like \c parse
+	///
+	/// Also throws \c std::system_error if the file can't be mapped.
+	////////////////////////////////////////////////////////////
+	static table parse_file(const std::string& path, char delimiter = ',', unsigned threads = 0)
+	{
+		table out;
+		out.m_file = detail::file_mapping(path, "ctstr::csv_schema");
+		read(reinterpret_cast<const char*>(out.m_file.data()), out.m_file.size(), delimiter, threads, out.m_columns);
+		return out;
+	}
+
+private:
+	[[noreturn]] static void fail(const std::string& why, std::size_t row, std::size_t column)
+	{
+		throw csv_error("ctstr::csv_schema: row " + std::to_string(row) + ", column " + std::to_string(column) + ": " + why, row, column);
+	}
+
+	static void read(const char* text, std::size_t size, char delimiter, unsigned threads, columns_type& out)
+	{
+		if (delimiter == '"' || delimiter == '\n' || delimiter == '\r')
+			throw std::invalid_argument("ctstr::csv_schema: the delimiter can't be a quote or a line break");
+
+		// A UTF-8 byte order mark isn't part of the first name.
+		std::size_t start = size >= 3 && std::memcmp(text, "\xEF\xBB\xBF", 3) == 0? 3 : 0;
+		start = read_header(text, size, delimiter, start, std::index_sequence_for<Columns...>{});
+
+		std::size_t count = threads != 0? threads : std::max(1u, std::thread::hardware_concurrency());
+		count = std::min(count, std::max<std::size_t>(1, (size - start) / detail::csv_min_chunk));
+
+		// Chunk i reads the rows that start in [bounds[i], bounds[i + 1]), which are the ones after a newline in
+		// [bounds[i] - 1, bounds[i + 1] - 1) that isn't in a quoted field.  The header ends in one of those newlines
+		// (unless there are no rows), so bounds[0] - 1 is always in the text.
+		std::vector<std::size_t> bounds(count + 1);
+		for (std::size_t i = 0; i < count; ++i)
+			bounds[i] = start + (size - start) / count * i;
+		bounds[count] = size;
+
+		// Whether a chunk starts in a quoted field depends on the quotes in all the ones before it,
+		// so count the rows both ways, then pick.
+		std::vector<detail::csv_counts> counts(count);
+		if (start < size)
+			detail::csv_parallel(count, [&](std::size_t i) {
+				counts[i] = detail::csv_count_rows(text + bounds[i] - 1, bounds[i + 1] - bounds[i]);
+			});
+		std::vector<chunk> chunks(count);
+		std::vector<char> quoted(count);
+		std::size_t rows = 0;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			chunks[i].first_row = rows;
+			rows += quoted[i]? counts[i].rows_if_inside : counts[i].rows_if_outside;
+			if (i + 1 < count)
+				quoted[i + 1] = quoted[i] ^ counts[i].odd;
+		}
+
+		std::apply([&](auto&...column) { (column.allocate(rows), ...); }, out);
+		try
+		{
+			detail::csv_parallel(count, [&](std::size_t i) {
+				std::size_t last = i + 1 < count? chunks[i + 1].first_row : rows;
+				read_chunk(text, size, delimiter, bounds[i], bounds[i + 1], quoted[i] != 0, last - chunks[i].first_row, out, chunks[i]);
+			});
+		}
+		catch (...)
+		{
+			for (chunk& c : chunks)
+				destroy(out, c, std::index_sequence_for<Columns...>{});
+			throw;
+		}
+
+		for (chunk& c : chunks)
+		{
+			if (c.error)
+			{
+				// Only the first error counts, but every chunk's rows have to go.
+				for (chunk& d : chunks)
+					destroy(out, d, std::index_sequence_for<Columns...>{});
+				fail(c.error, c.first_row + c.rows + 1, c.error_column);
+			}
+		}
+		std::apply([&](auto&...column) { ((column.m_size = rows), ...); }, out);
+	}
+
+	template <std::size_t...I>
+	static std::size_t read_header(const char* text, std::size_t size, char delimiter, std::size_t pos, std::index_sequence<I...>)
+	{
+		detail::csv_reader reader(text, size, delimiter, pos);
+		detail::csv_field field{};
+		std::size_t column = 0;
+		auto check = [&](auto name, bool last) {
+			using key = decltype(name);
+			if (!reader.field(last, field))
+				fail(reader.error(), 0, column);
+			bool matches = field.escaped? detail::csv_unescape(field) == to_string_view<key>() : equals<key>(field.data, field.size);
+			if (!matches)
+				fail("expected the header to say \"" + std::string(to_string_view<key>()) + "\"", 0, column);
+			++column;
+		};
+		(check(typename Columns::key{}, I + 1 == sizeof...(Columns)), ...);
+		return std::min(reader.position(), size);
+	}
+
+	static void read_chunk(const char* text, std::size_t size, char delimiter, std::size_t begin, std::size_t end, bool quoted,
+	                       std::size_t rows, columns_type& columns, chunk& out)
+	{
+		if (rows == 0)
+			return;
+
+		// The first row starts after the first newline from begin - 1 on that isn't in a quoted field.
+		std::size_t first = begin - 1;
+		for (; text[first] != '\n' || quoted; ++first)
+			quoted ^= text[first] == '"';
+
+		detail::csv_reader reader(text, size, delimiter, first + 1);
+		row_type values;
+		for (; out.rows < rows; ++out.rows)
+			if (!read_row(reader, values, columns, out.first_row + out.rows, out, std::index_sequence_for<Columns...>{}))
+				return;
+		// With every quote where it should be, the rows counted are exactly the ones read.
+		if (reader.position() < end)
+		{
+			out.error = "the quotes don't pair up";
+			out.error_column = 0;
+		}
+	}
+
+	// Reads a row into values, and only if all of it is good, moves it into the columns.
+	template <std::size_t...I>
+	CTSTR_FORCEINLINE static bool read_row(detail::csv_reader& reader, row_type& values, columns_type& columns, std::size_t row, chunk& out,
+	                                       std::index_sequence<I...>)
+	{
+		detail::csv_field field{};
+		auto read = [&](auto& value, std::size_t index) {
+			using T = std::remove_reference_t<decltype(value)>;
+			if (!reader.field(index + 1 == sizeof...(Columns), field))
+			{
+				out.error = reader.error();
+				out.error_column = index;
+				return false;
+			}
+			if (!detail::csv_convert(field, value))
+			{
+				out.error = detail::csv_expected<T>();
+				out.error_column = index;
+				return false;
+			}
+			return true;
+		};
+		if (!(read(std::get<I>(values), I) && ...))
+			return false;
+		(::new (static_cast<void*>(std::get<I>(columns).m_data + row)) type_at<I>(std::move(std::get<I>(values))), ...);
+		return true;
+	}
+
+	template <std::size_t...I>
+	static void destroy(columns_type& columns, const chunk& c, std::index_sequence<I...>)
+	{
+		(std::destroy(std::get<I>(columns).m_data + c.first_row, std::get<I>(columns).m_data + c.first_row + c.rows), ...);
+	}
+};
+
+}
@@ -0,0 +1,280 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Hash.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Dispatch.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_DISPATCH Dispatch
+///
+/// Going from a string that's only known at runtime back to the \c string_to_type type it matches.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_DISPATCH
+/// \brief Passed to the visitor of \c dispatch() when the string didn't match any of the candidates
+////////////////////////////////////////////////////////////
+struct no_match {};
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	constexpr std::uint32_t dispatch_empty_slot = 0xFFFFFFFFu;
+
+	constexpr int log2(std::size_t n)
+	{
+		int result = 0;
+		while (n >>= 1)
+			++result;
+		return result;
+	}
+
+	constexpr std::size_t next_power_of_2(std::size_t n)
+	{
+		std::size_t result = 1;
+		while (result < n)
+			result *= 2;
+		return result;
+	}
+
+	// A perfect hash table built with "hash and displace".  Each key's 64-bit hash picks a bucket,
+	// and each bucket has a displacement that was chosen (at compile time) so that every key
+	// in it lands in its own slot.  Finding a key's slot is two table reads and never probes.
+	template <std::size_t N>
+	struct perfect_hash_table
+	{
+		static constexpr std::size_t bucket_count = next_power_of_2(N / 2 + 1);
+		static constexpr std::size_t slot_count = next_power_of_2(2 * N + 1);
+
+		std::array<std::uint32_t, bucket_count> displacements{};
+		std::array<std::uint32_t, slot_count> slots{};
+		bool duplicate_keys = false;
+		bool ok = false;
+
+		static constexpr int slot_bits = log2(slot_count);
+
+		// The key hashes are already well mixed, so a mask and a multiply-shift are enough here.
+		static constexpr std::size_t bucket_of(std::uint64_t hash)
+		{
+			return static_cast<std::size_t>(hash) & (bucket_count - 1);
+		}
+
+		static constexpr std::size_t slot_of(std::uint64_t hash, std::uint32_t displacement)
+		{
+			return slot_bits == 0? 0 : static_cast<std::size_t>(((hash ^ displacement) * 0x9E3779B97F4A7C15ull) >> (64 - slot_bits));
+		}
+
+		constexpr std::uint32_t find(std::uint64_t hash) const
+		{
+			return slots[slot_of(hash, displacements[bucket_of(hash)])];
+		}
+
+		constexpr perfect_hash_table(const std::array<std::uint64_t, N>& hashes)
+		{
+			for (std::size_t i = 0; i < slot_count; ++i)
+				slots[i] = dispatch_empty_slot;
+
+			// Group the keys by bucket (counting sort), so each bucket's keys can be visited directly.
+			std::array<std::size_t, bucket_count + 1> starts{};
+			std::array<std::size_t, N + 1> members{};
+			for (std::size_t i = 0; i < N; ++i)
+				++starts[bucket_of(hashes[i]) + 1];
+			std::size_t largest = 0;
+			for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+			{
+				largest = starts[bucket + 1] > largest? starts[bucket + 1] : largest;
+				starts[bucket + 1] += starts[bucket];
+			}
+			std::array<std::size_t, bucket_count> filled{};
+			for (std::size_t i = 0; i < N; ++i)
+			{
+				std::size_t bucket = bucket_of(hashes[i]);
+				members[starts[bucket] + filled[bucket]++] = i;
+			}
+
+			// Identical strings have identical hashes, so they always end up in the same bucket.
+			for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+				for (std::size_t i = starts[bucket]; i < starts[bucket + 1]; ++i)
+					for (std::size_t j = i + 1; j < starts[bucket + 1]; ++j)
+						if (hashes[members[i]] == hashes[members[j]])
+						{
+							duplicate_keys = true;
+							return;
+						}
+
+			// Place the biggest buckets first, while there's still plenty of room.
+			std::array<std::size_t, N + 1> tried{};
+			for (std::size_t size = largest; size > 0; --size)
+			{
+				for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+				{
+					if (starts[bucket + 1] - starts[bucket] != size)
+						continue;
+
+					bool placed = false;
+					for (std::uint32_t displacement = 0; !placed && displacement < 0x100000u; ++displacement)
+					{
+						placed = true;
+						for (std::size_t i = 0; placed && i < size; ++i)
+						{
+							tried[i] = slot_of(hashes[members[starts[bucket] + i]], displacement);
+							placed = slots[tried[i]] == dispatch_empty_slot;
+							for (std::size_t k = 0; placed && k < i; ++k)
+								placed = tried[k] != tried[i];
+						}
+						if (placed)
+						{
+							displacements[bucket] = displacement;
+							for (std::size_t i = 0; i < size; ++i)
+								slots[tried[i]] = static_cast<std::uint32_t>(members[starts[bucket] + i]);
+						}
+					}
+					if (!placed)
+						return;
+				}
+			}
+			ok = true;
+		}
+	};
+
+	template <typename...Strings>
+	struct dispatch_char_type { using type = char; };
+
+	template <typename First, typename...Rest>
+	struct dispatch_char_type<First, Rest...> : sequence_type<First> {};
+
+	// Only the first string's result is used to work out the return type;
+	// std::common_type of thousands of types would blow the template depth limit.
+	template <typename Visitor, typename Miss, typename...Strings>
+	struct dispatch_result { using type = decltype(std::declval<Miss&>()()); };
+
+	template <typename Visitor, typename Miss, typename First, typename...Rest>
+	struct dispatch_result<Visitor, Miss, First, Rest...>
+	{
+		using type = std::common_type_t<decltype(std::declval<Visitor&>()(First{})), decltype(std::declval<Miss&>()())>;
+	};
+
+	template <typename CharType, typename...Strings>
+	struct dispatch_table
+	{
+		static constexpr perfect_hash_table<sizeof...(Strings)> table{ std::array<std::uint64_t, sizeof...(Strings)>{ { xxh64_v<Strings>... } } };
+		static constexpr std::basic_string_view<CharType> keys[sizeof...(Strings) + 1] = { to_string_view<Strings>()..., {} };
+
+		static_assert(!table.duplicate_keys, "The same string was passed to dispatch more than once.");
+		static_assert(table.ok, "Couldn't build a perfect hash for these strings.");
+	};
+
+	template <typename String, typename Result, typename Visitor>
+	Result dispatch_call(Visitor& visitor)
+	{
+		return visitor(String{});
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_DISPATCH
+/// \brief Calls \c visitor with whichever of \c Strings is equal to \c str
+///
+/// This is the runtime counterpart to overloading on \c string_to_type types:
+/// \code
+/// ctstr::dispatch<string_to_type("GET"), string_to_type("PUT")>(method,
+///     [](auto tag) { return handle(tag); },   // Called with string_to_type("GET"){} or string_to_type("PUT"){}
+///     []() { return bad_request(); });        // Called if method was neither
+/// \endcode
+///
+/// A perfect hash of all the strings is built at compile time, so matching costs one hash of \c str,
+/// two table lookups and a single comparison no matter how many strings there are.
+///
+/// \param str The string to look for
+/// \param visitor Called with a default-constructed instance of the matching string's type
+/// \param on_miss Called with no arguments if none of the strings match
+///
+/// \return Whatever \c visitor or \c on_miss returned, converted to the common type of \c on_miss's result and \c visitor's result for the first string
+////////////////////////////////////////////////////////////
+template <typename...Strings, typename CharType, typename Visitor, typename Miss>
+decltype(auto) dispatch(std::basic_string_view<CharType> str, Visitor&& visitor, Miss&& on_miss)
+{
+	using result_type = typename detail::dispatch_result<Visitor, Miss, Strings...>::type;
+	using table = detail::dispatch_table<CharType, Strings...>;
+	using thunk = result_type (*)(Visitor&);
+	static constexpr thunk thunks[sizeof...(Strings) + 1] = { &detail::dispatch_call<Strings, result_type, Visitor>..., nullptr };
+
+	static_assert((std::is_same<typename sequence_type<Strings>::type, CharType>::value && ...), "All the strings must have the same character type as the one being searched for.");
+
+	std::uint32_t index = table::table.find(xxh64(str.data(), str.size()));
+	if (index != detail::dispatch_empty_slot
+	    && table::keys[index].size() == str.size()
+	    && std::memcmp(table::keys[index].data(), str.data(), str.size() * sizeof(CharType)) == 0)
+		return static_cast<result_type>(thunks[index](visitor));
+	return static_cast<result_type>(on_miss());
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_DISPATCH
+/// \brief \c dispatch() for any kind of string
+////////////////////////////////////////////////////////////
+template <typename...Strings, typename String, typename Visitor, typename Miss>
+decltype(auto) dispatch(const String& str, Visitor&& visitor, Miss&& on_miss)
+{
+	using char_type = typename detail::dispatch_char_type<Strings...>::type;
+	return dispatch<Strings...>(std::basic_string_view<char_type>(str), std::forward<Visitor>(visitor), std::forward<Miss>(on_miss));
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_DISPATCH
+/// \brief \c dispatch() with a single visitor, which gets a \c no_match on a miss
+////////////////////////////////////////////////////////////
+template <typename...Strings, typename String, typename Visitor>
+decltype(auto) dispatch(const String& str, Visitor&& visitor)
+{
+	return dispatch<Strings...>(str, visitor, [&visitor]() -> decltype(auto) { return visitor(no_match{}); });
+}
+
+}
@@ -0,0 +1,349 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Hash.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error FixedString.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_FIXED_STRING Fixed-capacity strings
+///
+/// A string that keeps its characters inside itself, for when the longest it can be is known at compile time.
+///
+/// \code
+/// using greeting = string_to_type("Hello, ");
+/// auto message = greeting{} + ctstr::fixed_string<32>(name) + string_to_type("!"){};   // A fixed_string<40>
+/// queue.push(message);                                                               // A memcpy of 42 bytes
+/// \endcode
+///
+/// Concatenating \c fixed_string s with each other, with characters, or with \c string_to_type strings gives
+/// a \c fixed_string with room for exactly the sum of their capacities, worked out at compile time, so
+/// building a message from constant parts and bounded runtime parts can't run out of room and never allocates.
+/// Everything is \c constexpr, and every \c fixed_string is trivially copyable.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	// The smallest type that can hold every length up to N.
+	template <std::size_t N>
+	using fixed_string_size_t = std::conditional_t<(N <= 0xFF), std::uint8_t,
+	                            std::conditional_t<(N <= 0xFFFF), std::uint16_t,
+	                            std::conditional_t<(N <= 0xFFFFFFFFu), std::uint32_t, std::size_t>>>;
+
+	[[noreturn]] inline void fixed_string_overflow()
+	{
+		throw std::length_error("ctstr::fixed_string: not enough room");
+	}
+
+	template <typename CharType>
+	constexpr void fixed_string_copy(CharType* to, const CharType* from, std::size_t length)
+	{
+#if CTSTR_HAS_IS_CONSTANT_EVALUATED
+		if (!CTSTR_IS_CONSTANT_EVALUATED())
+		{
+			std::memcpy(to, from, length * sizeof(CharType));
+			return;
+		}
+#endif
+		for (std::size_t i = 0; i < length; ++i)
+			to[i] = from[i];
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FIXED_STRING
+/// \brief A string of up to \c N characters, stored inline
+///
+/// Works like a \c std::basic_string that can't grow past \c N: the characters (and a null terminator) live in the
+/// object itself, so it never allocates, and copying one is a \c memcpy of <tt>N + 1</tt> characters and its length.
+/// Anything that would make it longer than \c N throws \c std::length_error.
+///
+/// It converts to \c std::basic_string_view implicitly, so it can be passed to anything that takes one.
+////////////////////////////////////////////////////////////
+template <std::size_t N, typename CharType = char>
+class fixed_string
+{
+public:
+	using value_type = CharType;
+	using traits_type = std::char_traits<CharType>;
+	using size_type = std::size_t;
+	using iterator = CharType*;
+	using const_iterator = const CharType*;
+
+	/// The most characters it can hold.
+	static constexpr std::size_t capacity() { return N; }
+
+	/// An empty string.
+	constexpr fixed_string() = default;
+
+	/// The characters of a \c string_to_type string, which must fit.
+	template <CharType...Chars>
+	constexpr fixed_string(std::integer_sequence<CharType, Chars...>) : m_chars{ Chars... }, m_size(sizeof...(Chars))
+	{
+		static_assert(sizeof...(Chars) <= N, "The string is longer than the fixed_string's capacity.");
+	}
+
+	/// The characters of a string literal, which must fit.
+	template <std::size_t M>
+	constexpr fixed_string(const CharType (&str)[M]) : m_size(static_cast<size_type_>(M - 1))
+	{
+		static_assert(M - 1 <= N, "The string is longer than the fixed_string's capacity.");
+		detail::fixed_string_copy(m_chars, str, M - 1);
+	}
+
+	/// A copy of a shorter \c fixed_string.
+	template <std::size_t M, typename = std::enable_if_t<(M < N)>>
+	constexpr fixed_string(const fixed_string<M, CharType>& other) : m_size(static_cast<size_type_>(other.size()))
+	{
+		// All M + 1 characters, since a copy of a length known at compile time is a few moves rather than a call.
+		detail::fixed_string_copy(m_chars, other.data(), M + 1);
+	}
+
+	/// A copy of \c str; throws \c std::length_error if it's longer than \c N.
+	constexpr explicit fixed_string(std::basic_string_view<CharType> str)
+	{
+		append(str);
+	}
+
+	constexpr std::size_t size() const { return m_size; }
+	constexpr std::size_t length() const { return m_size; }
+	constexpr bool empty() const { return m_size == 0; }
+
+	constexpr CharType* data() { return m_chars; }
+	constexpr const CharType* data() const { return m_chars; }
+	/// The characters, followed by a null character.
+	constexpr const CharType* c_str() const { return m_chars; }
+
+	constexpr CharType& operator[](std::size_t i) { return m_chars[i]; }
+	constexpr const CharType& operator[](std::size_t i) const { return m_chars[i]; }
+
+	constexpr CharType* begin() { return m_chars; }
+	constexpr CharType* end() { return m_chars + m_size; }
+	constexpr const CharType* begin() const { return m_chars; }
+	constexpr const CharType* end() const { return m_chars + m_size; }
+
+	constexpr std::basic_string_view<CharType> view() const { return std::basic_string_view<CharType>(m_chars, m_size); }
+	constexpr operator std::basic_string_view<CharType>() const { return view(); }
+
+	constexpr void clear()
+	{
+		m_size = 0;
+		m_chars[0] = CharType();
+	}
+
+	/// Adds \c c to the end; throws \c std::length_error if it's already \c N characters long.
+	constexpr void push_back(CharType c)
+	{
+		if (m_size == N)
+			detail::fixed_string_overflow();
+		m_chars[m_size] = c;
+		m_chars[++m_size] = CharType();
+	}
+
+	constexpr void pop_back()
+	{
+		m_chars[--m_size] = CharType();
+	}
+
+	/// Adds \c str to the end; throws \c std::length_error, leaving the string as it was, if it doesn't fit.
+	constexpr fixed_string& append(std::basic_string_view<CharType> str)
+	{
+		if (str.size() > N - m_size)
+			detail::fixed_string_overflow();
+		detail::fixed_string_copy(m_chars + m_size, str.data(), str.size());
+		m_size = static_cast<size_type_>(m_size + str.size());
+		m_chars[m_size] = CharType();
+		return *this;
+	}
+
+	/// Adds \c str to the end; throws \c std::length_error, leaving the string as it was, if it doesn't fit.
+	template <std::size_t M>
+	constexpr fixed_string& append(const fixed_string<M, CharType>& str)
+	{
+		// Appending a string to itself: the copies below would overlap, but copying just its characters won't.
+		if constexpr (M == N)
+			if (&str == this)
+				return append(str.view());
+		if (str.size() > N - m_size)
+			detail::fixed_string_overflow();
+		// When there's room for all of str's M + 1 characters, copy them all, for the same reason as above.
+		if (M <= N - m_size)
+			detail::fixed_string_copy(m_chars + m_size, str.data(), M + 1);
+		else
+			detail::fixed_string_copy(m_chars + m_size, str.data(), str.size() + 1);
+		m_size = static_cast<size_type_>(m_size + str.size());
+		return *this;
+	}
+
+	constexpr fixed_string& operator+=(std::basic_string_view<CharType> str) { return append(str); }
+
+	template <std::size_t M>
+	constexpr fixed_string& operator+=(const fixed_string<M, CharType>& str) { return append(str); }
+
+	constexpr fixed_string& operator+=(CharType c)
+	{
+		push_back(c);
+		return *this;
+	}
+
+	friend constexpr bool operator==(const fixed_string& a, std::basic_string_view<CharType> b) { return a.view() == b; }
+	friend constexpr bool operator==(std::basic_string_view<CharType> a, const fixed_string& b) { return a == b.view(); }
+	friend constexpr bool operator!=(const fixed_string& a, std::basic_string_view<CharType> b) { return a.view() != b; }
+	friend constexpr bool operator!=(std::basic_string_view<CharType> a, const fixed_string& b) { return a != b.view(); }
+	friend constexpr bool operator<(const fixed_string& a, std::basic_string_view<CharType> b) { return a.view() < b; }
+	friend constexpr bool operator<(std::basic_string_view<CharType> a, const fixed_string& b) { return a < b.view(); }
+
+	template <std::size_t M>
+	friend constexpr bool operator==(const fixed_string& a, const fixed_string<M, CharType>& b) { return a.view() == b.view(); }
+	template <std::size_t M>
+	friend constexpr bool operator!=(const fixed_string& a, const fixed_string<M, CharType>& b) { return a.view() != b.view(); }
+	template <std::size_t M>
+	friend constexpr bool operator<(const fixed_string& a, const fixed_string<M, CharType>& b) { return a.view() < b.view(); }
+
+	friend std::basic_ostream<CharType>& operator<<(std::basic_ostream<CharType>& out, const fixed_string& str) { return out << str.view(); }
+
+private:
+	using size_type_ = detail::fixed_string_size_t<N>;
+
+	CharType m_chars[N + 1] = {};
+	size_type_ m_size = 0;
+};
+
+static_assert(std::is_trivially_copyable<fixed_string<16>>::value && std::is_trivially_copyable<fixed_string<300, char32_t>>::value,
+              "fixed_string has to be safe to memcpy.");
+
+template <typename CharType, CharType...Chars>
+fixed_string(std::integer_sequence<CharType, Chars...>) -> fixed_string<sizeof...(Chars), CharType>;
+
+template <typename CharType, std::size_t M>
+fixed_string(const CharType (&)[M]) -> fixed_string<M - 1, CharType>;
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FIXED_STRING
+/// \brief Turns a string returned from \c string_to_type into a \c fixed_string exactly big enough for it
+///
+/// Like \c to_string(), but nothing is allocated, and it works in constant expressions.
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+constexpr auto to_fixed_string(SeqType sequence = SeqType{})
+{
+	return fixed_string<size<SeqType>, typename sequence_type<SeqType>::type>(sequence);
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FIXED_STRING
+/// \brief \c a followed by \c b, in a \c fixed_string with room for both of their capacities
+////////////////////////////////////////////////////////////
+template <std::size_t N, std::size_t M, typename CharType>
+constexpr fixed_string<N + M, CharType> operator+(const fixed_string<N, CharType>& a, const fixed_string<M, CharType>& b)
+{
+	fixed_string<N + M, CharType> out(a);
+	out.append(b);
+	return out;
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FIXED_STRING
+/// \brief \c a followed by the \c string_to_type string \c b, in a \c fixed_string with room for both
+////////////////////////////////////////////////////////////
+template <std::size_t N, typename CharType, CharType...Chars>
+constexpr fixed_string<N + sizeof...(Chars), CharType> operator+(const fixed_string<N, CharType>& a, std::integer_sequence<CharType, Chars...> b)
+{
+	return a + fixed_string<sizeof...(Chars), CharType>(b);
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FIXED_STRING
+/// \brief The \c string_to_type string \c a followed by \c b, in a \c fixed_string with room for both
+////////////////////////////////////////////////////////////
+template <std::size_t N, typename CharType, CharType...Chars>
+constexpr fixed_string<sizeof...(Chars) + N, CharType> operator+(std::integer_sequence<CharType, Chars...> a, const fixed_string<N, CharType>& b)
+{
+	return fixed_string<sizeof...(Chars), CharType>(a) + b;
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FIXED_STRING
+/// \brief \c a followed by \c c
+////////////////////////////////////////////////////////////
+template <std::size_t N, typename CharType>
+constexpr fixed_string<N + 1, CharType> operator+(const fixed_string<N, CharType>& a, CharType c)
+{
+	fixed_string<N + 1, CharType> out(a);
+	out.push_back(c);
+	return out;
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FIXED_STRING
+/// \brief \c c followed by \c b
+////////////////////////////////////////////////////////////
+template <std::size_t N, typename CharType>
+constexpr fixed_string<1 + N, CharType> operator+(CharType c, const fixed_string<N, CharType>& b)
+{
+	fixed_string<1 + N, CharType> out;
+	out.push_back(c);
+	out.append(b);
+	return out;
+}
+
+}
+
+namespace std
+{
+	template <std::size_t N, typename CharType>
+	struct hash<ctstr::fixed_string<N, CharType>>
+	{
+		std::size_t operator()(const ctstr::fixed_string<N, CharType>& str) const { return std::hash<std::basic_string_view<CharType>>()(str.view()); }
+	};
+}
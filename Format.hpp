@@ -0,0 +1,305 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Format.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_FORMAT Formatting
+///
+/// Substituting values into strings like <tt>"It happened %0 times on %1/%2/%3"</tt>,
+/// where the string is a \c string_to_type type and so can be taken apart at compile time.
+///
+/// \c %N (any number of digits) is replaced with argument \c N, and \c %% is a literal \c %.
+/// Each argument can be a string (anything convertible to \c std::basic_string_view of the same character type),
+/// a single character, an integer, a floating point number (shortest round-trip form), a \c bool,
+/// or another \c string_to_type string.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	// A piece of the format string: either literal characters (copied from data<SeqType>) or an argument.
+	struct format_segment
+	{
+		std::size_t offset = 0;
+		std::size_t length = 0;
+		std::size_t argument = static_cast<std::size_t>(-1);
+
+		constexpr bool is_literal() const { return argument == static_cast<std::size_t>(-1); }
+	};
+
+	constexpr bool format_is_digit(std::uint64_t c) { return c >= '0' && c <= '9'; }
+
+	// Walks the format string.  Called once to count the segments and again to fill them in.
+	template <typename CharType>
+	constexpr std::size_t parse_format(const CharType* str, std::size_t length, format_segment* out, bool& malformed, std::size_t& argument_count)
+	{
+		std::size_t count = 0;
+		std::size_t start = 0;
+		auto literal = [&](std::size_t end) {
+			if (end > start)
+			{
+				if (out)
+					out[count] = format_segment{ start, end - start };
+				++count;
+			}
+		};
+
+		for (std::size_t i = 0; i < length; ++i)
+		{
+			if (str[i] != CharType('%'))
+				continue;
+
+			if (i + 1 < length && str[i + 1] == CharType('%'))
+			{
+				// Keep the first % as part of the literal text and skip the second.
+				literal(i + 1);
+				start = i + 2;
+				++i;
+			}
+			else if (i + 1 < length && format_is_digit(static_cast<std::uint64_t>(str[i + 1])))
+			{
+				literal(i);
+				std::size_t argument = 0;
+				std::size_t j = i + 1;
+				for (; j < length && format_is_digit(static_cast<std::uint64_t>(str[j])); ++j)
+					argument = argument * 10 + static_cast<std::size_t>(str[j] - CharType('0'));
+				if (out)
+					out[count] = format_segment{ 0, 0, argument };
+				++count;
+				argument_count = argument + 1 > argument_count? argument + 1 : argument_count;
+				start = j;
+				i = j - 1;
+			}
+			else
+				malformed = true;
+		}
+		literal(length);
+		return count;
+	}
+
+	template <typename SeqType>
+	struct format_spec
+	{
+		static constexpr std::size_t count_segments()
+		{
+			bool malformed = false;
+			std::size_t arguments = 0;
+			return parse_format(data<SeqType>, size<SeqType>, nullptr, malformed, arguments);
+		}
+
+		struct parsed
+		{
+			std::array<format_segment, count_segments() + 1> segments{};
+			std::size_t argument_count = 0;
+			std::size_t literal_length = 0;
+			bool malformed = false;
+
+			constexpr parsed()
+			{
+				parse_format(data<SeqType>, size<SeqType>, segments.data(), malformed, argument_count);
+				for (const format_segment& segment : segments)
+					literal_length += segment.length;
+			}
+		};
+
+		static constexpr std::size_t segment_count = count_segments();
+		static constexpr parsed value{};
+	};
+
+	// Enough for any integer up to 128 bits with a sign, or any double in shortest form.
+	constexpr std::size_t format_number_size = 48;
+
+	template <typename CharType, typename T>
+	constexpr std::size_t format_max_size(const T& value)
+	{
+		if constexpr (std::is_same<T, bool>::value)
+			return 5;
+		else if constexpr (std::is_same<T, CharType>::value)
+			return 1;
+		else if constexpr (std::is_arithmetic<T>::value)
+			return format_number_size;
+		else if constexpr (is_sequence<T>::value)
+			return size<T>;
+		else
+		{
+			static_assert(std::is_convertible<const T&, std::basic_string_view<CharType>>::value, "Can't format an argument of this type.");
+			return std::basic_string_view<CharType>(value).size();
+		}
+	}
+
+	template <typename CharType>
+	CharType* format_copy(CharType* out, const CharType* str, std::size_t length)
+	{
+		std::memcpy(out, str, length * sizeof(CharType));
+		return out + length;
+	}
+
+	template <typename CharType, typename T>
+	CharType* format_write(CharType* out, const T& value)
+	{
+		if constexpr (std::is_same<T, bool>::value)
+		{
+			const char* text = value? "true" : "false";
+			for (; *text; ++text)
+				*out++ = static_cast<CharType>(*text);
+			return out;
+		}
+		else if constexpr (std::is_same<T, CharType>::value)
+		{
+			*out = value;
+			return out + 1;
+		}
+		else if constexpr (std::is_arithmetic<T>::value)
+		{
+			if constexpr (sizeof(CharType) == 1)
+				return reinterpret_cast<CharType*>(std::to_chars(reinterpret_cast<char*>(out), reinterpret_cast<char*>(out) + format_number_size, value).ptr);
+			else
+			{
+				char buffer[format_number_size];
+				char* end = std::to_chars(buffer, buffer + format_number_size, value).ptr;
+				for (char* p = buffer; p != end; ++p)
+					*out++ = static_cast<CharType>(*p);
+				return out;
+			}
+		}
+		else if constexpr (is_sequence<T>::value)
+			return format_copy(out, data<T>, size<T>);
+		else
+		{
+			std::basic_string_view<CharType> str(value);
+			return format_copy(out, str.data(), str.size());
+		}
+	}
+
+	template <typename SeqType, typename CharType, typename Tuple, std::size_t...I>
+	CharType* format_segments(CharType* out, const Tuple& args, std::index_sequence<I...>)
+	{
+		using spec = format_spec<SeqType>;
+		auto write = [&](auto index) {
+			constexpr format_segment segment = spec::value.segments[decltype(index)::value];
+			if constexpr (segment.is_literal())
+				out = format_copy(out, data<SeqType> + segment.offset, segment.length);
+			else
+				out = format_write<CharType>(out, std::get<segment.argument>(args));
+		};
+		static_cast<void>(write);
+		(write(std::integral_constant<std::size_t, I>{}), ...);
+		return out;
+	}
+
+	// Returns false (after failing a static_assert) so callers can skip the code that would only add more errors.
+	template <typename SeqType, typename...Args>
+	constexpr bool format_check()
+	{
+		using spec = format_spec<SeqType>;
+		static_assert(!spec::value.malformed, "Every % in a format string must be followed by an argument number or another %.");
+		static_assert(spec::value.argument_count == sizeof...(Args), "The number of arguments doesn't match the format string (it must be one more than the highest %N).");
+		return !spec::value.malformed && spec::value.argument_count == sizeof...(Args);
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FORMAT
+/// \brief The most characters \c format_to() can write for these arguments
+///
+/// The literal part of the format string is counted at compile time; strings add their length,
+/// and numbers add a fixed worst case.
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename...Args>
+constexpr std::size_t format_size_bound(const Args&...args)
+{
+	using char_type = typename sequence_type<SeqType>::type;
+	if constexpr (detail::format_check<SeqType, Args...>())
+		return (detail::format_spec<SeqType>::value.literal_length + ... + detail::format_max_size<char_type>(args));
+	else
+		return 0;
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FORMAT
+/// \brief Writes the formatted string to \c out, which must have room for at least \c format_size_bound() characters
+///
+/// Nothing is parsed at runtime; the format string has already been split into literal pieces
+/// (each copied with a fixed-size \c memcpy) and arguments.  No null terminator is written.
+///
+/// \return A pointer just past the last character written
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename...Args>
+typename sequence_type<SeqType>::type* format_to(typename sequence_type<SeqType>::type* out, const Args&...args)
+{
+	if constexpr (detail::format_check<SeqType, Args...>())
+		return detail::format_segments<SeqType>(out, std::forward_as_tuple(args...), std::make_index_sequence<detail::format_spec<SeqType>::segment_count>{});
+	else
+		return out;
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_FORMAT
+/// \brief Formats into a new string, with exactly one allocation
+///
+/// \code
+/// ctstr::format<string_to_type("It happened %0 times on %1/%2/%3")>(count, month, day, year);
+/// \endcode
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename...Args>
+std::basic_string<typename sequence_type<SeqType>::type> format(const Args&...args)
+{
+	std::basic_string<typename sequence_type<SeqType>::type> result;
+	result.resize(format_size_bound<SeqType>(args...));
+	result.resize(static_cast<std::size_t>(format_to<SeqType>(&result[0], args...) - result.data()));
+	return result;
+}
+
+}
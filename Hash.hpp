@@ -0,0 +1,385 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \cond IGNORE
+////////////////////////////////////////////////////////////
+
+// Lets the hashes use plain (unaligned) loads at runtime and only fall back to assembling bytes one at a time during constant evaluation.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define CTSTR_HAS_IS_CONSTANT_EVALUATED 1
+#define CTSTR_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+#if !defined(CTSTR_HAS_IS_CONSTANT_EVALUATED) && defined(_MSC_VER) && _MSC_VER >= 1925
+#define CTSTR_HAS_IS_CONSTANT_EVALUATED 1
+#define CTSTR_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#ifndef CTSTR_HAS_IS_CONSTANT_EVALUATED
+#define CTSTR_HAS_IS_CONSTANT_EVALUATED 0
+#endif
+
+#if defined(_WIN32) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define CTSTR_LITTLE_ENDIAN 1
+#else
+#define CTSTR_LITTLE_ENDIAN 0
+#endif
+
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_HASH Hashing
+///
+/// Hashes of strings made with \c string_to_type, computed at compile time.
+///
+/// Every hash function here is \c constexpr and is also the one you call at runtime,
+/// so a string hashed at compile time and the same characters hashed at runtime always give the same value.
+/// Strings of wider character types are hashed as the little-endian bytes of each character,
+/// which means <tt>U"foo"</tt> and <tt>"foo"</tt> hash differently.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	// The i-th byte of a string, treating each character as little-endian.
+	template <typename CharType>
+	constexpr std::uint8_t byte_at(const CharType* str, std::size_t i)
+	{
+		return static_cast<std::uint8_t>(static_cast<std::make_unsigned_t<CharType>>(str[i / sizeof(CharType)]) >> (8 * (i % sizeof(CharType))));
+	}
+
+	template <typename CharType>
+	constexpr std::uint64_t read_le(const CharType* str, std::size_t i, std::size_t bytes)
+	{
+#if CTSTR_HAS_IS_CONSTANT_EVALUATED && CTSTR_LITTLE_ENDIAN
+		// Same result as the loop below, but compilers don't reliably turn the loop into a single load.
+		if (!CTSTR_IS_CONSTANT_EVALUATED())
+		{
+			std::uint64_t value = 0;
+			std::memcpy(&value, reinterpret_cast<const unsigned char*>(str) + i, bytes);
+			return value;
+		}
+#endif
+		std::uint64_t value = 0;
+		for (std::size_t b = 0; b < bytes; ++b)
+			value |= static_cast<std::uint64_t>(byte_at(str, i + b)) << (8 * b);
+		return value;
+	}
+
+	constexpr std::uint64_t rotl64(std::uint64_t value, int bits)
+	{
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	constexpr std::uint64_t xxh64_prime1 = 11400714785074694791ull;
+	constexpr std::uint64_t xxh64_prime2 = 14029467366897019727ull;
+	constexpr std::uint64_t xxh64_prime3 =  1609587929392839161ull;
+	constexpr std::uint64_t xxh64_prime4 =  9650029242287828579ull;
+	constexpr std::uint64_t xxh64_prime5 =  2870177450012600261ull;
+
+	constexpr std::uint64_t xxh64_round(std::uint64_t acc, std::uint64_t input)
+	{
+		return rotl64(acc + input * xxh64_prime2, 31) * xxh64_prime1;
+	}
+
+	constexpr std::uint64_t xxh64_merge_round(std::uint64_t acc, std::uint64_t value)
+	{
+		return (acc ^ xxh64_round(0, value)) * xxh64_prime1 + xxh64_prime4;
+	}
+
+	// Lookup table for the reflected Castagnoli polynomial, built at compile time.
+	struct crc32c_table
+	{
+		constexpr crc32c_table() : entries()
+		{
+			for (std::uint32_t i = 0; i < 256; ++i)
+			{
+				std::uint32_t crc = i;
+				for (int bit = 0; bit < 8; ++bit)
+					crc = (crc >> 1) ^ ((crc & 1)? 0x82F63B78u : 0u);
+				entries[i] = crc;
+			}
+		}
+
+		std::uint32_t entries[256];
+	};
+
+	template <typename Dummy = void>
+	struct crc32c_storage
+	{
+		static constexpr crc32c_table table{};
+	};
+
+	template <typename Dummy>
+	constexpr crc32c_table crc32c_storage<Dummy>::table;
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief 64-bit FNV-1a hash of \c length characters starting at \c str
+////////////////////////////////////////////////////////////
+template <typename CharType>
+constexpr std::uint64_t fnv1a(const CharType* str, std::size_t length)
+{
+	std::uint64_t hash = 14695981039346656037ull;
+	for (std::size_t i = 0; i < length * sizeof(CharType); ++i)
+		hash = (hash ^ detail::byte_at(str, i)) * 1099511628211ull;
+	return hash;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief xxHash64 of \c length characters starting at \c str
+////////////////////////////////////////////////////////////
+template <typename CharType>
+constexpr std::uint64_t xxh64(const CharType* str, std::size_t length, std::uint64_t seed = 0)
+{
+	const std::size_t bytes = length * sizeof(CharType);
+	std::size_t i = 0;
+	std::uint64_t hash = 0;
+
+	if (bytes >= 32)
+	{
+		std::uint64_t v1 = seed + detail::xxh64_prime1 + detail::xxh64_prime2;
+		std::uint64_t v2 = seed + detail::xxh64_prime2;
+		std::uint64_t v3 = seed;
+		std::uint64_t v4 = seed - detail::xxh64_prime1;
+		for (; i + 32 <= bytes; i += 32)
+		{
+			v1 = detail::xxh64_round(v1, detail::read_le(str, i,      8));
+			v2 = detail::xxh64_round(v2, detail::read_le(str, i +  8, 8));
+			v3 = detail::xxh64_round(v3, detail::read_le(str, i + 16, 8));
+			v4 = detail::xxh64_round(v4, detail::read_le(str, i + 24, 8));
+		}
+		hash = detail::rotl64(v1, 1) + detail::rotl64(v2, 7) + detail::rotl64(v3, 12) + detail::rotl64(v4, 18);
+		hash = detail::xxh64_merge_round(hash, v1);
+		hash = detail::xxh64_merge_round(hash, v2);
+		hash = detail::xxh64_merge_round(hash, v3);
+		hash = detail::xxh64_merge_round(hash, v4);
+	}
+	else
+		hash = seed + detail::xxh64_prime5;
+
+	hash += bytes;
+
+	for (; i + 8 <= bytes; i += 8)
+		hash = detail::rotl64(hash ^ detail::xxh64_round(0, detail::read_le(str, i, 8)), 27) * detail::xxh64_prime1 + detail::xxh64_prime4;
+	if (i + 4 <= bytes)
+	{
+		hash = detail::rotl64(hash ^ (detail::read_le(str, i, 4) * detail::xxh64_prime1), 23) * detail::xxh64_prime2 + detail::xxh64_prime3;
+		i += 4;
+	}
+	for (; i < bytes; ++i)
+		hash = detail::rotl64(hash ^ (detail::byte_at(str, i) * detail::xxh64_prime5), 11) * detail::xxh64_prime1;
+
+	hash ^= hash >> 33;
+	hash *= detail::xxh64_prime2;
+	hash ^= hash >> 29;
+	hash *= detail::xxh64_prime3;
+	hash ^= hash >> 32;
+	return hash;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief CRC-32C (Castagnoli) of \c length characters starting at \c str
+////////////////////////////////////////////////////////////
+template <typename CharType>
+constexpr std::uint32_t crc32c(const CharType* str, std::size_t length)
+{
+	std::uint32_t crc = 0xFFFFFFFFu;
+	for (std::size_t i = 0; i < length * sizeof(CharType); ++i)
+		crc = (crc >> 8) ^ detail::crc32c_storage<>::table.entries[(crc ^ detail::byte_at(str, i)) & 0xFF];
+	return crc ^ 0xFFFFFFFFu;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief The FNV-1a hash of a string returned from \c string_to_type, as a compile-time constant
+///
+/// Identical to <tt>fnv1a(data<SeqType>, size<SeqType>)</tt>.
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+constexpr std::uint64_t fnv1a_v = fnv1a(data<SeqType>, size<SeqType>);
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief The xxHash64 (seed 0) of a string returned from \c string_to_type, as a compile-time constant
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+constexpr std::uint64_t xxh64_v = xxh64(data<SeqType>, size<SeqType>);
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief The CRC-32C of a string returned from \c string_to_type, as a compile-time constant
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+constexpr std::uint32_t crc32c_v = crc32c(data<SeqType>, size<SeqType>);
+
+/// \cond INTERNAL
+// The published test vectors, so a change that breaks any of them can't compile.  The long xxHash64 input covers the
+// 32-byte stripes, and the char16_t one checks that wide characters are hashed as their little-endian bytes.
+static_assert(fnv1a("", 0) == 0xCBF29CE484222325ull && fnv1a("a", 1) == 0xAF63DC4C8601EC8Cull && fnv1a("foobar", 6) == 0x85944171F73967E8ull,
+              "fnv1a doesn't match the FNV-1a test vectors.");
+static_assert(xxh64("", 0) == 0xEF46DB3751D8E999ull && xxh64("abc", 3) == 0x44BC2CF5AD770999ull
+              && xxh64("Nobody inspects the spammish repetition", 39) == 0xFBCEA83C8A378BF1ull,
+              "xxh64 doesn't match the xxHash64 test vectors.");
+static_assert(crc32c("", 0) == 0 && crc32c("123456789", 9) == 0xE3069283u, "crc32c doesn't match the CRC-32C test vectors.");
+static_assert(fnv1a(u"ab", 2) == fnv1a("a\0b\0", 4), "Wide characters have to be hashed as little-endian bytes.");
+/// \endcond
+
+
+#if CTSTR_CPLUSPLUS >= 201703L
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief Selects which hash \c string_hash uses
+////////////////////////////////////////////////////////////
+enum class hash_algorithm
+{
+	fnv1a,
+	xxh64,
+	crc32c
+};
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief A key for hash table lookups whose hash was computed at compile time
+///
+/// Pass one of these to \c find (or \c count, \c contains, ...) on an \c std::unordered_map that uses
+/// \c string_hash and \c string_equal, and the lookup neither hashes the key at runtime
+/// nor has to work out how long it is:
+/// \code
+/// std::unordered_map<std::string, int, ctstr::string_hash<>, ctstr::string_equal<>> counters;
+/// counters.find(ctstr::prehashed_key<string_to_type("cache.miss")>{});
+/// \endcode
+/// Heterogeneous lookup in unordered containers needs C++20; with C++17 the key still works with \c string_hash directly.
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+struct prehashed_key
+{
+	using char_type = typename sequence_type<SeqType>::type;
+
+	/// The hash of this key using the given algorithm.
+	template <hash_algorithm Algorithm>
+	static constexpr std::uint64_t hash()
+	{
+		return Algorithm == hash_algorithm::fnv1a? fnv1a_v<SeqType> : Algorithm == hash_algorithm::xxh64? xxh64_v<SeqType> : crc32c_v<SeqType>;
+	}
+
+	/// The characters of this key.
+	static constexpr std::basic_string_view<char_type> view() { return to_string_view<SeqType>(); }
+
+	constexpr operator std::basic_string_view<char_type>() const { return view(); }
+};
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief Transparent hash for string-keyed containers that also accepts \c prehashed_key
+///
+/// Strings are hashed at runtime with \c Algorithm; a \c prehashed_key just returns its compile-time hash,
+/// which is guaranteed to be the same value.
+////////////////////////////////////////////////////////////
+template <hash_algorithm Algorithm = hash_algorithm::fnv1a, typename CharType = char>
+struct string_hash
+{
+	using is_transparent = void;
+
+	std::size_t operator()(std::basic_string_view<CharType> str) const noexcept
+	{
+		return static_cast<std::size_t>(Algorithm == hash_algorithm::fnv1a? fnv1a(str.data(), str.size())
+		                              : Algorithm == hash_algorithm::xxh64? xxh64(str.data(), str.size())
+		                              :                                     crc32c(str.data(), str.size()));
+	}
+
+	std::size_t operator()(const std::basic_string<CharType>& str) const noexcept { return (*this)(std::basic_string_view<CharType>(str)); }
+	std::size_t operator()(const CharType* str) const noexcept { return (*this)(std::basic_string_view<CharType>(str)); }
+
+	template <typename SeqType>
+	constexpr std::size_t operator()(prehashed_key<SeqType>) const noexcept
+	{
+		static_assert(std::is_same<typename prehashed_key<SeqType>::char_type, CharType>::value, "This key has a different character type than the container.");
+		return static_cast<std::size_t>(prehashed_key<SeqType>::template hash<Algorithm>());
+	}
+};
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_HASH
+/// \brief Transparent equality for string-keyed containers that also accepts \c prehashed_key
+///
+/// Comparing against a \c prehashed_key checks the length against a constant first and then compares the characters with \c memcmp.
+////////////////////////////////////////////////////////////
+template <typename CharType = char>
+struct string_equal
+{
+	using is_transparent = void;
+
+	bool operator()(std::basic_string_view<CharType> a, std::basic_string_view<CharType> b) const noexcept { return a == b; }
+
+	template <typename SeqType, typename String>
+	bool operator()(prehashed_key<SeqType>, const String& str) const noexcept
+	{
+		static_assert(std::is_same<typename prehashed_key<SeqType>::char_type, CharType>::value, "This key has a different character type than the container.");
+		const std::basic_string_view<CharType> view(str);
+		return view.size() == size<SeqType> && std::memcmp(view.data(), data<SeqType>, size<SeqType> * sizeof(CharType)) == 0;
+	}
+
+	template <typename String, typename SeqType>
+	bool operator()(const String& str, prehashed_key<SeqType> key) const noexcept { return (*this)(key, str); }
+};
+
+#endif
+
+}
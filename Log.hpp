@@ -0,0 +1,579 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Format.hpp"
+#include "ThreadBuffers.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Log.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_LOG Logging
+///
+/// A logger that leaves the formatting for later, so that logging costs the calling thread little more than a \c memcpy.
+///
+/// \code
+/// CTSTR_LOG("Request %0 took %1 ms", request_id, elapsed);
+///
+/// int main()
+/// {
+///     ctstr::log_writer writer("app.log");
+///     ...
+/// }
+/// \endcode
+///
+/// The format strings are the same as \c ctstr::format's, and are checked against the arguments at compile time.
+/// Each combination of format string and argument types is a log site with a small id (given out at startup, like
+/// \c ctstr::id) and a signature worked out at compile time, one character per argument:
+///
+/// | Argument                                      | Signature | Stored as                          |
+/// |-----------------------------------------------|-----------|------------------------------------|
+/// | \c bool                                       | \c b      | 1 byte                             |
+/// | \c char                                       | \c c      | 1 byte                             |
+/// | \c float                                      | \c f      | \c float                           |
+/// | \c double, <tt>long double</tt>               | \c d      | \c double                          |
+/// | signed integers                               | \c i      | \c std::int64_t                    |
+/// | unsigned integers                             | \c u      | \c std::uint64_t                   |
+/// | strings and \c string_to_type strings         | \c s      | \c std::uint32_t length, then text |
+///
+/// Logging writes the site id, a timestamp and the raw arguments into the calling thread's own ring buffer, without
+/// taking a lock or formatting anything.  A \c log_writer drains every thread's buffer on a thread of its own, and
+/// either formats the messages there or writes them out in binary for \c tools/log_decode.cpp to format later.
+/// If a buffer fills up before it's drained, new messages are dropped (and counted) rather than making the caller wait.
+///
+/// Binary logs are in the byte order of the machine that wrote them, since the arguments are copied as they are.  They start
+/// with <tt>uint32 magic "CTSL"; uint32 version;</tt> and then hold records that each start with a byte saying what they are:
+/// \code
+/// 'F'  uint32 site; uint32 format_length; char format[format_length]; uint32 signature_length; char signature[signature_length];
+/// 'R'  uint32 size; uint64 time; uint32 site; arguments[size - 12]
+/// \endcode
+/// Each site's \c 'F' record comes before any of its messages.  \c time is in nanoseconds since the \c std::chrono::system_clock epoch.
+////////////////////////////////////////////////////////////
+
+#ifndef CTSTR_LOG_BUFFER_SIZE
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_LOG
+/// \brief How many bytes each thread's buffer holds; must be a power of 2
+////////////////////////////////////////////////////////////
+#define CTSTR_LOG_BUFFER_SIZE 0x100000
+#endif
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_LOG
+/// \brief Logs a message, to be formatted from \c format and the arguments later
+////////////////////////////////////////////////////////////
+#define CTSTR_LOG(format, ...) ::ctstr::log<string_to_type(format)>(__VA_ARGS__)
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	constexpr std::uint32_t log_magic = 0x4C535443u; // "CTSL"
+	constexpr std::uint32_t log_version = 1;
+	constexpr std::uint32_t log_skip = 0xFFFFFFFFu;
+
+	// The size of each record, then its time and site id.
+	constexpr std::size_t log_header_size = sizeof(std::uint32_t) + sizeof(std::uint64_t) + sizeof(std::uint32_t);
+
+	template <typename T>
+	struct log_unsupported : std::false_type {};
+
+	template <typename T>
+	constexpr char log_tag()
+	{
+		if constexpr (std::is_same<T, bool>::value)
+			return 'b';
+		else if constexpr (std::is_same<T, char>::value)
+			return 'c';
+		else if constexpr (std::is_same<T, float>::value)
+			return 'f';
+		else if constexpr (std::is_floating_point<T>::value)
+			return 'd';
+		else if constexpr (std::is_integral<T>::value)
+			return std::is_signed<T>::value? 'i' : 'u';
+		else if constexpr (is_sequence<T>::value || std::is_convertible<const T&, std::string_view>::value)
+			return 's';
+		else
+		{
+			static_assert(log_unsupported<T>::value, "Can't log an argument of this type.");
+			return 0;
+		}
+	}
+
+	template <char Tag>
+	struct log_type;
+
+	template <> struct log_type<'b'> { using type = bool; };
+	template <> struct log_type<'c'> { using type = char; };
+	template <> struct log_type<'f'> { using type = float; };
+	template <> struct log_type<'d'> { using type = double; };
+	template <> struct log_type<'i'> { using type = std::int64_t; };
+	template <> struct log_type<'u'> { using type = std::uint64_t; };
+	template <> struct log_type<'s'> { using type = std::string_view; };
+
+	template <typename T>
+	std::string_view log_string(const T& value)
+	{
+		if constexpr (is_sequence<T>::value)
+			return std::string_view(data<T>, size<T>);
+		else
+			return std::string_view(value);
+	}
+
+	template <typename T>
+	std::size_t log_size(const T& value)
+	{
+		if constexpr (log_tag<T>() == 's')
+			return sizeof(std::uint32_t) + log_string(value).size();
+		else
+			return sizeof(typename log_type<log_tag<T>()>::type);
+	}
+
+	template <typename T>
+	unsigned char* log_encode(unsigned char* out, const T& value)
+	{
+		if constexpr (log_tag<T>() == 's')
+		{
+			std::string_view str = log_string(value);
+			std::uint32_t length = static_cast<std::uint32_t>(str.size());
+			std::memcpy(out, &length, sizeof(length));
+			std::memcpy(out + sizeof(length), str.data(), str.size());
+			return out + sizeof(length) + str.size();
+		}
+		else
+		{
+			typename log_type<log_tag<T>()>::type stored = static_cast<typename log_type<log_tag<T>()>::type>(value);
+			std::memcpy(out, &stored, sizeof(stored));
+			return out + sizeof(stored);
+		}
+	}
+
+	template <char Tag>
+	typename log_type<Tag>::type log_decode(const unsigned char*& in)
+	{
+		if constexpr (Tag == 's')
+		{
+			std::uint32_t length;
+			std::memcpy(&length, in, sizeof(length));
+			std::string_view str(reinterpret_cast<const char*>(in + sizeof(length)), length);
+			in += sizeof(length) + length;
+			return str;
+		}
+		else
+		{
+			typename log_type<Tag>::type value;
+			std::memcpy(&value, in, sizeof(value));
+			in += sizeof(value);
+			return value;
+		}
+	}
+
+	// What a log_writer needs to know about a log site.
+	struct log_format
+	{
+		std::string_view format;
+		std::string_view signature;
+		void (*text)(const unsigned char* arguments, std::string& out);
+	};
+
+	// A single-producer, single-consumer ring of variable-sized records, each one contiguous so that it can be
+	// filled in with plain memcpys.  A record that won't fit before the end goes at the start instead, after a
+	// size of log_skip that tells the reader to do the same.
+	class log_buffer
+	{
+	public:
+		static constexpr std::size_t capacity = CTSTR_LOG_BUFFER_SIZE;
+		static_assert(capacity >= 64 && (capacity & (capacity - 1)) == 0, "CTSTR_LOG_BUFFER_SIZE must be a power of 2.");
+
+		log_buffer() : m_data(new unsigned char[capacity]) {}
+
+		// Room for a record of size bytes (including its own size), or nullptr if there isn't any.
+		unsigned char* reserve(std::size_t size)
+		{
+			// Every record starts on an 8 byte boundary, so there's always room for a log_skip before the end.
+			const std::size_t unpadded = size;
+			size = (size + 7) & ~std::size_t(7);
+			std::size_t head = m_head.load(std::memory_order_relaxed);
+			std::size_t offset = head & (capacity - 1);
+			std::size_t skip = capacity - offset < size? capacity - offset : 0;
+			if (size > capacity || head + skip + size - m_tail_seen > capacity)
+			{
+				m_tail_seen = m_tail.load(std::memory_order_acquire);
+				if (size > capacity || head + skip + size - m_tail_seen > capacity)
+				{
+					m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+					return nullptr;
+				}
+			}
+
+			if (skip)
+			{
+				std::memcpy(m_data.get() + offset, &log_skip, sizeof(log_skip));
+				offset = 0;
+			}
+			std::uint32_t stored = static_cast<std::uint32_t>(size);
+			std::memcpy(m_data.get() + offset, &stored, sizeof(stored));
+			// The padding goes into binary logs along with the rest of the record, so it mustn't be whatever was there before.
+			std::memset(m_data.get() + offset + unpadded, 0, size - unpadded);
+			m_reserved = head + skip + size;
+			return m_data.get() + offset + sizeof(stored);
+		}
+
+		// Hands the record from the last reserve() over to the reader.
+		void commit() { m_head.store(m_reserved, std::memory_order_release); }
+
+		// Calls f(record, size) for each record, not including the size at the start (but including any padding at the end).
+		template <typename F>
+		void drain(F&& f)
+		{
+			std::size_t tail = m_tail.load(std::memory_order_relaxed);
+			std::size_t head = m_head.load(std::memory_order_acquire);
+			while (tail != head)
+			{
+				std::size_t offset = tail & (capacity - 1);
+				std::uint32_t size;
+				std::memcpy(&size, m_data.get() + offset, sizeof(size));
+				if (size == log_skip)
+				{
+					tail += capacity - offset;
+					continue;
+				}
+				f(m_data.get() + offset + sizeof(size), size - sizeof(size));
+				tail += size;
+			}
+			m_tail.store(tail, std::memory_order_release);
+		}
+
+		void finish() { m_finished.store(true, std::memory_order_release); }
+		bool finished() const { return m_finished.load(std::memory_order_acquire); }
+		std::uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+	private:
+		std::unique_ptr<unsigned char[]> m_data;
+		std::atomic<bool> m_finished{ false };
+
+		// Written by the owning thread.
+		alignas(64) std::atomic<std::size_t> m_head{ 0 };
+		std::size_t m_reserved = 0;
+		std::size_t m_tail_seen = 0;
+		std::atomic<std::uint64_t> m_dropped{ 0 };
+
+		// Written by the writer.
+		alignas(64) std::atomic<std::size_t> m_tail{ 0 };
+	};
+
+	// The per-thread buffers, along with the format of every log site.
+	class log_registry : public thread_buffers<log_buffer>
+	{
+	public:
+		std::uint32_t add_format(const log_format& format)
+		{
+			std::lock_guard<std::mutex> lock(m_formats_mutex);
+			m_formats.push_back(format);
+			return static_cast<std::uint32_t>(m_formats.size() - 1);
+		}
+
+		// Copies out every site registered so far, for a writer to keep.
+		void formats(std::vector<log_format>& out)
+		{
+			std::lock_guard<std::mutex> lock(m_formats_mutex);
+			out.assign(m_formats.begin(), m_formats.end());
+		}
+
+	private:
+		std::mutex m_formats_mutex;
+		std::vector<log_format> m_formats;
+	};
+
+	// Log sites add their formats while statics are being initialized, so this can't be an ordinary global.
+	inline log_registry& logs()
+	{
+		static log_registry registry;
+		return registry;
+	}
+
+	inline std::uint64_t log_now()
+	{
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+	}
+
+	template <typename SeqType, typename...Args>
+	struct log_site
+	{
+		using signature = std::integer_sequence<char, log_tag<Args>()...>;
+
+		static void text(const unsigned char* arguments, std::string& out)
+		{
+			// Braces, so the arguments are decoded in order.
+			std::tuple<typename log_type<log_tag<Args>()>::type...> values{ log_decode<log_tag<Args>()>(arguments)... };
+			static_cast<void>(arguments);
+			std::apply([&](const auto&...value) {
+				std::size_t start = out.size();
+				out.resize(start + format_size_bound<SeqType>(value...));
+				out.resize(static_cast<std::size_t>(format_to<SeqType>(&out[start], value...) - out.data()));
+			}, values);
+		}
+
+		static std::uint32_t id()
+		{
+			// Using registered here is what makes it exist (and so register this site at startup) in the first place.
+			static_cast<void>(&registered);
+			static const std::uint32_t value = logs().add_format(log_format{ to_string_view<SeqType>(), to_string_view<signature>(), &text });
+			return value;
+		}
+
+		static inline const std::uint32_t registered = id();
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_LOG
+/// \brief Logs a message, to be formatted from \c SeqType and \c args later
+///
+/// Usually spelled \c CTSTR_LOG.  Strings are copied, so they don't have to outlive the call;
+/// everything else is copied as it is.
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename...Args>
+void log(const Args&...args)
+{
+	static_assert(std::is_same<typename sequence_type<SeqType>::type, char>::value, "Log format strings must be strings of char.");
+	if constexpr (detail::format_check<SeqType, Args...>())
+	{
+		using site = detail::log_site<SeqType, std::decay_t<Args>...>;
+		detail::log_buffer& buffer = detail::this_thread_buffer<&detail::logs>();
+		unsigned char* out = buffer.reserve((detail::log_header_size + ... + detail::log_size(args)));
+		if (!out)
+			return;
+
+		std::uint64_t time = detail::log_now();
+		std::uint32_t id = site::id();
+		std::memcpy(out, &time, sizeof(time));
+		std::memcpy(out + sizeof(time), &id, sizeof(id));
+		out += sizeof(time) + sizeof(id);
+		((out = detail::log_encode(out, args)), ...);
+		buffer.commit();
+	}
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_LOG
+/// \brief What \c log_writer writes
+////////////////////////////////////////////////////////////
+enum class log_output
+{
+	text,   ///< One formatted message per line, after the time in seconds since the epoch
+	binary  ///< The records as they were logged, for \c tools/log_decode.cpp
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_LOG
+/// \brief Writes every thread's log messages to a file as they come in
+///
+/// Starts a thread that drains the buffers every \c interval, and writes whatever's left when it's destroyed.
+/// Messages logged before it was made (but not yet dropped) are included.  Each batch is sorted by time before
+/// it's written, so messages from different threads come out in order unless they were logged more than
+/// one interval apart.
+///
+/// Keep one of these for as long as you're logging.  If there's more than one at a time, each message
+/// goes to only one of their files.
+////////////////////////////////////////////////////////////
+class log_writer
+{
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Creates (or overwrites) the file at \c path and starts writing to it
+	///
+	/// \throw std::runtime_error if the file can't be opened
+	////////////////////////////////////////////////////////////
+	explicit log_writer(const std::string& path, log_output output = log_output::text, std::chrono::milliseconds interval = std::chrono::milliseconds(10))
+		: m_out(path, std::ios::binary | std::ios::trunc)
+		, m_output(output)
+		, m_interval(interval)
+	{
+		if (!m_out)
+			throw std::runtime_error("ctstr::log_writer: couldn't open " + path);
+		if (m_output == log_output::binary)
+		{
+			write_raw(detail::log_magic);
+			write_raw(detail::log_version);
+		}
+		m_thread = std::thread([this] { run(); });
+	}
+
+	~log_writer()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_wake.notify_one();
+		m_thread.join();
+		flush();
+	}
+
+	log_writer(const log_writer&) = delete;
+	log_writer& operator=(const log_writer&) = delete;
+
+	/// Writes out everything logged so far, instead of waiting for the next interval.
+	void flush()
+	{
+		std::lock_guard<std::mutex> lock(m_write_mutex);
+		m_batch.clear();
+		m_records.clear();
+		detail::logs().drain([this](const unsigned char* record, std::size_t size) {
+			std::uint64_t time;
+			std::memcpy(&time, record, sizeof(time));
+			m_records.push_back(batched{ time, m_batch.size(), size });
+			m_batch.insert(m_batch.end(), record, record + size);
+		});
+		std::stable_sort(m_records.begin(), m_records.end(), [](const batched& a, const batched& b) { return a.time < b.time; });
+
+		for (const batched& r : m_records)
+			write(m_batch.data() + r.offset, r.size);
+		m_out.flush();
+	}
+
+	/// How many messages have been lost so far because a thread's buffer was full.
+	static std::uint64_t dropped() { return detail::logs().dropped(); }
+
+private:
+	struct batched
+	{
+		std::uint64_t time;
+		std::size_t offset;
+		std::size_t size;
+	};
+
+	void run()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (!m_wake.wait_for(lock, m_interval, [this] { return m_stop; }))
+		{
+			lock.unlock();
+			flush();
+			lock.lock();
+		}
+	}
+
+	template <typename T>
+	void write_raw(const T& value) { m_out.write(reinterpret_cast<const char*>(&value), sizeof(value)); }
+
+	const detail::log_format& format(std::uint32_t id)
+	{
+		// Sites register at startup, but a library loaded later can add more.
+		if (id >= m_formats.size())
+		{
+			detail::logs().formats(m_formats);
+			m_defined.resize(m_formats.size());
+		}
+		return m_formats[id];
+	}
+
+	void write(const unsigned char* record, std::size_t size)
+	{
+		std::uint64_t time;
+		std::uint32_t id;
+		std::memcpy(&time, record, sizeof(time));
+		std::memcpy(&id, record + sizeof(time), sizeof(id));
+		const detail::log_format& site = format(id);
+
+		if (m_output == log_output::text)
+		{
+			char stamp[32];
+			int length = std::snprintf(stamp, sizeof(stamp), "%llu.%09llu ", static_cast<unsigned long long>(time / 1000000000), static_cast<unsigned long long>(time % 1000000000));
+			m_line.assign(stamp, static_cast<std::size_t>(length));
+			site.text(record + sizeof(time) + sizeof(id), m_line);
+			m_line += '\n';
+			m_out.write(m_line.data(), static_cast<std::streamsize>(m_line.size()));
+			return;
+		}
+
+		if (!m_defined[id])
+		{
+			m_out.put('F');
+			write_raw(id);
+			write_raw(static_cast<std::uint32_t>(site.format.size()));
+			m_out.write(site.format.data(), static_cast<std::streamsize>(site.format.size()));
+			write_raw(static_cast<std::uint32_t>(site.signature.size()));
+			m_out.write(site.signature.data(), static_cast<std::streamsize>(site.signature.size()));
+			m_defined[id] = true;
+		}
+		m_out.put('R');
+		write_raw(static_cast<std::uint32_t>(size));
+		m_out.write(reinterpret_cast<const char*>(record), static_cast<std::streamsize>(size));
+	}
+
+	std::ofstream m_out;
+	log_output m_output;
+	std::chrono::milliseconds m_interval;
+	std::vector<detail::log_format> m_formats;
+	std::vector<bool> m_defined;
+	std::vector<unsigned char> m_batch;
+	std::vector<batched> m_records;
+	std::string m_line;
+
+	std::mutex m_write_mutex;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	bool m_stop = false;
+	std::thread m_thread;
+};
+
+}
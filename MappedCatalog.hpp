@@ -0,0 +1,535 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Hash.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error MappedCatalog.hpp requires C++17
+#endif
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_MAPPED_CATALOG Mapped catalog
+///
+/// Translations loaded from a file at runtime, looked up with keys hashed from \c string_to_type strings at compile time.
+///
+/// Unlike \c ctstr::catalog, the translated text doesn't have to be compiled in, so it can be
+/// updated (even while the program is running) by generating a new file with \c tools/catalog_gen.cpp.
+///
+/// The file is memory-mapped and used in place: lookups return views straight into the mapping.
+/// Its layout, with every integer little-endian, is
+/// \code
+/// header  { uint32 magic "CTSC"; uint32 version; uint64 slot_count; uint64 entry_count; uint64 blob_size; }
+/// slots   { uint64 key; uint32 offset; uint32 length; } [slot_count]
+/// blob    char[blob_size]
+/// \endcode
+/// where \c key is the \c ctstr::xxh64 of the original string and the slots are an open-addressed hash table
+/// (a power of 2 in size, at most half full, probed linearly from <tt>key & (slot_count - 1)</tt>; an \c offset of \c 0xFFFFFFFF marks an empty slot).
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	constexpr std::uint32_t mapped_catalog_magic = 0x43535443u; // "CTSC"
+	constexpr std::uint32_t mapped_catalog_version = 1;
+	constexpr std::uint32_t mapped_catalog_empty = 0xFFFFFFFFu;
+
+	struct mapped_catalog_header
+	{
+		std::uint32_t magic;
+		std::uint32_t version;
+		std::uint64_t slot_count;
+		std::uint64_t entry_count;
+		std::uint64_t blob_size;
+	};
+
+	struct mapped_catalog_slot
+	{
+		std::uint64_t key;
+		std::uint32_t offset;
+		std::uint32_t length;
+	};
+
+	static_assert(sizeof(mapped_catalog_header) == 32 && sizeof(mapped_catalog_slot) == 16, "The catalog file layout needs these structs to have no padding.");
+
+	// The file is little-endian; these are no-ops everywhere else that matters.
+	template <typename T>
+	inline T from_le(T value)
+	{
+#if CTSTR_LITTLE_ENDIAN
+		return value;
+#else
+		return static_cast<T>(read_le(reinterpret_cast<const unsigned char*>(&value), 0, sizeof(T)));
+#endif
+	}
+
+	template <typename T>
+	inline void write_le(std::ostream& out, T value)
+	{
+		unsigned char bytes[sizeof(T)];
+		for (std::size_t i = 0; i < sizeof(T); ++i)
+			bytes[i] = static_cast<unsigned char>(static_cast<std::uint64_t>(value) >> (8 * i));
+		out.write(reinterpret_cast<const char*>(bytes), sizeof(T));
+	}
+
+	// A whole file mapped read-only.  Errors are reported as coming from owner.
+	class file_mapping
+	{
+	public:
+		file_mapping() = default;
+
+		explicit file_mapping(const std::string& path, const char* owner = "ctstr::mapped_catalog")
+		{
+#if defined(_WIN32)
+			HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE)
+				fail(owner, "can't open " + path);
+			LARGE_INTEGER size{};
+			if (!GetFileSizeEx(file, &size))
+			{
+				DWORD error = GetLastError();
+				CloseHandle(file);
+				fail(owner, "can't read " + path, error);
+			}
+			if (size.QuadPart == 0)
+			{
+				CloseHandle(file);
+				throw std::runtime_error(std::string(owner) + ": " + path + " is empty");
+			}
+			HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			DWORD error = GetLastError();
+			// The mapping keeps the file alive on its own.
+			CloseHandle(file);
+			if (!mapping)
+				fail(owner, "can't map " + path, error);
+			m_data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			error = GetLastError();
+			CloseHandle(mapping);
+			if (!m_data)
+				fail(owner, "can't map " + path, error);
+			m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+			int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+			if (fd < 0)
+				fail(owner, "can't open " + path);
+			struct stat info;
+			if (::fstat(fd, &info) != 0)
+			{
+				int error = errno;
+				::close(fd);
+				fail(owner, "can't read " + path, error);
+			}
+			if (info.st_size == 0)
+			{
+				::close(fd);
+				throw std::runtime_error(std::string(owner) + ": " + path + " is empty");
+			}
+			void* data = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+			int error = errno;
+			// The mapping keeps the file alive on its own.
+			::close(fd);
+			if (data == MAP_FAILED)
+				fail(owner, "can't map " + path, error);
+			m_data = data;
+			m_size = static_cast<std::size_t>(info.st_size);
+#endif
+		}
+
+		file_mapping(file_mapping&& other) noexcept : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+		file_mapping& operator=(file_mapping&& other) noexcept
+		{
+			file_mapping(std::move(other)).swap(*this);
+			return *this;
+		}
+
+		~file_mapping()
+		{
+			if (!m_data)
+				return;
+#if defined(_WIN32)
+			UnmapViewOfFile(m_data);
+#else
+			::munmap(m_data, m_size);
+#endif
+		}
+
+		void swap(file_mapping& other) noexcept
+		{
+			std::swap(m_data, other.m_data);
+			std::swap(m_size, other.m_size);
+		}
+
+		const unsigned char* data() const { return static_cast<const unsigned char*>(m_data); }
+		std::size_t size() const { return m_size; }
+
+	private:
+#if defined(_WIN32)
+		[[noreturn]] static void fail(const char* owner, const std::string& what, DWORD error = GetLastError())
+		{
+			throw std::system_error(static_cast<int>(error), std::system_category(), std::string(owner) + ": " + what);
+		}
+#else
+		[[noreturn]] static void fail(const char* owner, const std::string& what, int error = errno)
+		{
+			throw std::system_error(error, std::generic_category(), std::string(owner) + ": " + what);
+		}
+#endif
+
+		void* m_data = nullptr;
+		std::size_t m_size = 0;
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_MAPPED_CATALOG
+/// \brief A catalog file, mapped into memory
+///
+/// \code
+/// ctstr::mapped_catalog catalog("ja.ctc");
+/// std::string_view text = catalog.lookup<string_to_type(u8"Hello!")>();
+/// \endcode
+///
+/// Nothing is copied out of the file: opening it only checks the header, and each lookup hashes nothing
+/// at runtime (the key is \c xxh64_v of the string), reads one or two slots and returns a view into the mapping.
+/// The views are valid for as long as the \c mapped_catalog is.
+///
+/// Throws \c std::system_error if the file can't be mapped and \c std::runtime_error if it isn't a catalog file.
+/// All the other functions are safe to call from any number of threads at once.
+////////////////////////////////////////////////////////////
+class mapped_catalog
+{
+public:
+	/// An empty catalog, where every lookup misses.
+	mapped_catalog() = default;
+
+	/// Maps the catalog file at \c path.
+	explicit mapped_catalog(const std::string& path) : m_file(path)
+	{
+		auto invalid = [&](const char* why) {
+			return std::runtime_error("ctstr::mapped_catalog: " + path + " " + why);
+		};
+
+		if (m_file.size() < sizeof(detail::mapped_catalog_header))
+			throw invalid("is too small to be a catalog");
+
+		const detail::mapped_catalog_header& header = *reinterpret_cast<const detail::mapped_catalog_header*>(m_file.data());
+		if (detail::from_le(header.magic) != detail::mapped_catalog_magic)
+			throw invalid("isn't a catalog");
+		if (detail::from_le(header.version) != detail::mapped_catalog_version)
+			throw invalid("is a catalog from an incompatible version");
+
+		std::uint64_t slot_count = detail::from_le(header.slot_count);
+		std::uint64_t blob_size = detail::from_le(header.blob_size);
+		std::size_t available = m_file.size() - sizeof(detail::mapped_catalog_header);
+		if (slot_count == 0 || (slot_count & (slot_count - 1)) != 0 || slot_count > available / sizeof(detail::mapped_catalog_slot)
+		    || blob_size != available - slot_count * sizeof(detail::mapped_catalog_slot))
+			throw invalid("is truncated or corrupt");
+
+		m_slots = reinterpret_cast<const detail::mapped_catalog_slot*>(m_file.data() + sizeof(detail::mapped_catalog_header));
+		m_mask = static_cast<std::size_t>(slot_count - 1);
+		m_blob = reinterpret_cast<const char*>(m_slots + slot_count);
+		m_blob_size = blob_size;
+		m_entry_count = static_cast<std::size_t>(detail::from_le(header.entry_count));
+	}
+
+	mapped_catalog(mapped_catalog&& other) noexcept
+	{
+		swap(other);
+	}
+
+	mapped_catalog& operator=(mapped_catalog&& other) noexcept
+	{
+		mapped_catalog(std::move(other)).swap(*this);
+		return *this;
+	}
+
+	void swap(mapped_catalog& other) noexcept
+	{
+		m_file.swap(other.m_file);
+		std::swap(m_slots, other.m_slots);
+		std::swap(m_mask, other.m_mask);
+		std::swap(m_blob, other.m_blob);
+		std::swap(m_blob_size, other.m_blob_size);
+		std::swap(m_entry_count, other.m_entry_count);
+	}
+
+	/// Number of translations in the catalog.
+	std::size_t size() const { return m_entry_count; }
+
+	////////////////////////////////////////////////////////////
+	/// \brief The translation stored under \c key, or nothing if there isn't one
+	///
+	/// \param key The \c ctstr::xxh64 hash of the original string
+	////////////////////////////////////////////////////////////
+	std::optional<std::string_view> find(std::uint64_t key) const
+	{
+		if (!m_slots)
+			return std::nullopt;
+
+		// The table is never full, so this stops at an empty slot long before wrapping around;
+		// the limit only matters for a corrupt file.
+		std::size_t i = static_cast<std::size_t>(key) & m_mask;
+		for (std::size_t probes = 0; probes <= m_mask; ++probes, i = (i + 1) & m_mask)
+		{
+			const detail::mapped_catalog_slot& slot = m_slots[i];
+			std::uint32_t offset = detail::from_le(slot.offset);
+			if (offset == detail::mapped_catalog_empty)
+				break;
+			if (detail::from_le(slot.key) == key)
+			{
+				std::uint32_t length = detail::from_le(slot.length);
+				if (static_cast<std::uint64_t>(offset) + length > m_blob_size)
+					break;
+				return std::string_view(m_blob + offset, length);
+			}
+		}
+		return std::nullopt;
+	}
+
+	/// The translation of \c SeqType, or nothing if the catalog doesn't have one.
+	template <typename SeqType>
+	std::optional<std::basic_string_view<typename sequence_type<SeqType>::type>> find() const
+	{
+		using char_type = typename sequence_type<SeqType>::type;
+		static_assert(sizeof(char_type) == 1, "Catalog files only hold single-byte strings.");
+		if (auto text = find(xxh64_v<SeqType>))
+			return std::basic_string_view<char_type>(reinterpret_cast<const char_type*>(text->data()), text->size());
+		return std::nullopt;
+	}
+
+	/// The translation of \c SeqType, or \c SeqType itself if the catalog doesn't have one.
+	template <typename SeqType>
+	std::basic_string_view<typename sequence_type<SeqType>::type> lookup() const
+	{
+		if (auto text = find<SeqType>())
+			return *text;
+		return to_string_view<SeqType>();
+	}
+
+private:
+	detail::file_mapping m_file;
+	const detail::mapped_catalog_slot* m_slots = nullptr;
+	std::size_t m_mask = 0;
+	const char* m_blob = nullptr;
+	std::uint64_t m_blob_size = 0;
+	std::size_t m_entry_count = 0;
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_MAPPED_CATALOG
+/// \brief A \c mapped_catalog that can be replaced while other threads are reading it
+///
+/// Readers take a snapshot with \c current() and keep it for as long as they use the views it returns
+/// (for example, one snapshot per frame).  \c reload() maps the new file completely before swapping it in,
+/// so a bad file throws and leaves the old catalog in place, and the old mapping is only unmapped once
+/// the last snapshot of it is gone.
+/// \code
+/// ctstr::live_catalog translations("ja.ctc");
+///
+/// // Any thread:
+/// auto catalog = translations.current();
+/// draw(catalog->lookup<string_to_type(u8"Hello!")>());
+///
+/// // When ja.ctc has been regenerated:
+/// translations.reload("ja.ctc");
+/// \endcode
+////////////////////////////////////////////////////////////
+class live_catalog
+{
+public:
+	using snapshot = std::shared_ptr<const mapped_catalog>;
+
+	/// Starts out with an empty catalog.
+	live_catalog() : m_current(std::make_shared<const mapped_catalog>()) {}
+
+	/// Starts out with the catalog file at \c path.
+	explicit live_catalog(const std::string& path) : m_current(std::make_shared<const mapped_catalog>(path)) {}
+
+	/// The catalog as it is right now.
+	snapshot current() const
+	{
+#if defined(__cpp_lib_atomic_shared_ptr)
+		return m_current.load(std::memory_order_acquire);
+#else
+		return std::atomic_load_explicit(&m_current, std::memory_order_acquire);
+#endif
+	}
+
+	/// Replaces the catalog with one that's already loaded.
+	void replace(snapshot catalog)
+	{
+#if defined(__cpp_lib_atomic_shared_ptr)
+		m_current.store(std::move(catalog), std::memory_order_release);
+#else
+		std::atomic_store_explicit(&m_current, std::move(catalog), std::memory_order_release);
+#endif
+	}
+
+	/// Maps the catalog file at \c path and replaces the current one with it.
+	void reload(const std::string& path)
+	{
+		replace(std::make_shared<const mapped_catalog>(path));
+	}
+
+private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+	std::atomic<snapshot> m_current;
+#else
+	snapshot m_current;
+#endif
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_MAPPED_CATALOG
+/// \brief Builds catalog files for \c mapped_catalog
+///
+/// \c tools/catalog_gen.cpp uses this to turn a text file of translations into a catalog.
+////////////////////////////////////////////////////////////
+class mapped_catalog_writer
+{
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Adds the translation of \c source
+	///
+	/// \return false (and changes nothing) if \c source, or another string with the same hash, was already added
+	////////////////////////////////////////////////////////////
+	bool add(std::string_view source, std::string_view translation)
+	{
+		return add(xxh64(source.data(), source.size()), translation);
+	}
+
+	/// Adds a translation under a key that's already been hashed.
+	bool add(std::uint64_t key, std::string_view translation)
+	{
+		if (m_blob.size() + translation.size() >= detail::mapped_catalog_empty)
+			throw std::length_error("ctstr::mapped_catalog_writer: catalogs can't hold more than 4GB of text");
+		auto inserted = m_keys.emplace(key, m_entries.size());
+		if (!inserted.second)
+			return false;
+
+		// If either of these runs out of memory, take the key back out, so that the writer is as it was and the string can be added again.
+		const std::size_t blob_size = m_blob.size();
+		try
+		{
+			m_blob.append(translation);
+			m_entries.push_back(entry{ key, static_cast<std::uint32_t>(blob_size), static_cast<std::uint32_t>(translation.size()) });
+		}
+		catch (...)
+		{
+			m_blob.resize(blob_size);
+			m_keys.erase(inserted.first);
+			throw;
+		}
+		return true;
+	}
+
+	/// Number of translations added so far.
+	std::size_t size() const { return m_entries.size(); }
+
+	/// Writes the catalog file.  \c out should be opened in binary mode.
+	void write(std::ostream& out) const
+	{
+		std::uint64_t slot_count = 1;
+		while (slot_count < 2 * m_entries.size() + 1)
+			slot_count *= 2;
+
+		std::vector<entry> slots(static_cast<std::size_t>(slot_count), entry{ 0, detail::mapped_catalog_empty, 0 });
+		std::size_t mask = static_cast<std::size_t>(slot_count - 1);
+		for (const entry& e : m_entries)
+		{
+			std::size_t i = static_cast<std::size_t>(e.key) & mask;
+			while (slots[i].offset != detail::mapped_catalog_empty)
+				i = (i + 1) & mask;
+			slots[i] = e;
+		}
+
+		detail::write_le(out, detail::mapped_catalog_magic);
+		detail::write_le(out, detail::mapped_catalog_version);
+		detail::write_le(out, slot_count);
+		detail::write_le(out, static_cast<std::uint64_t>(m_entries.size()));
+		detail::write_le(out, static_cast<std::uint64_t>(m_blob.size()));
+		for (const entry& e : slots)
+		{
+			detail::write_le(out, e.key);
+			detail::write_le(out, e.offset);
+			detail::write_le(out, e.length);
+		}
+		out.write(m_blob.data(), static_cast<std::streamsize>(m_blob.size()));
+	}
+
+private:
+	struct entry
+	{
+		std::uint64_t key;
+		std::uint32_t offset;
+		std::uint32_t length;
+	};
+
+	std::vector<entry> m_entries;
+	std::unordered_map<std::uint64_t, std::size_t> m_keys;
+	std::string m_blob;
+};
+
+}
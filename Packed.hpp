@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_PACKED Packed strings
+///
+/// A more compact type for the same string, for when the names of the types start to matter.
+///
+/// A 200-character \c string_to_type string is an \c std::integer_sequence with 200 template arguments, and every
+/// function overloaded on it (like \c get_translation in the example) carries all 200 of them around in its mangled name
+/// and its debug info.  \c ctstr::packed stores the same characters 8 bytes to an \c std::uint64_t, so the same string
+/// takes 25 template arguments instead, and \c pack_t and \c unpack_t convert between the two without losing anything.
+///
+/// \code
+/// std::string get_translation(packed_string_to_type(u8"Hello!"), english);
+///
+/// template <typename S>
+/// std::string translate(language lang) { return get_translation(ctstr::pack_t<S>{}, lang); }
+/// \endcode
+///
+/// The string is still built as an \c std::integer_sequence first, and then packed, so it's a little slower to compile;
+/// what it saves is space in the symbol table and the debug info, and so in what the linker has to read.
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PACKED
+/// \brief Like \c string_to_type, but the result is a \c ctstr::packed
+////////////////////////////////////////////////////////////
+#define packed_string_to_type(str) ::ctstr::pack_t<string_to_type(str)>
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PACKED
+/// \brief \c Length characters of type \c T, packed into as few \c std::uint64_t as will hold them
+///
+/// The first character is in the lowest bits of the first word, and any bits past the end of the string are 0.
+/// Don't write these out by hand; get them from \c pack_t.
+////////////////////////////////////////////////////////////
+template <typename T, std::size_t Length, std::uint64_t...Words>
+struct packed
+{
+	using value_type = T;
+	static constexpr std::size_t size() noexcept { return Length; }
+};
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	template <typename T>
+	struct packing
+	{
+		static_assert(sizeof(T) <= sizeof(std::uint64_t), "Characters must fit in an std::uint64_t.");
+		using unsigned_type = std::make_unsigned_t<T>;
+		static constexpr std::size_t chars_per_word = sizeof(std::uint64_t) / sizeof(T);
+		static constexpr std::size_t bits = 8 * sizeof(T);
+
+		static constexpr std::size_t word_count(std::size_t length) { return (length + chars_per_word - 1) / chars_per_word; }
+	};
+
+	template <std::size_t Count>
+	struct packed_words
+	{
+		// Never empty, so that the empty string still makes an array.
+		std::uint64_t words[Count == 0? 1 : Count];
+	};
+
+	template <typename T, T...t>
+	struct pack_words
+	{
+		using info = packing<T>;
+
+		// All the words are worked out in one go from a local array; reading the pack back one word at a time
+		// would cost time proportional to the square of the length.
+		static constexpr packed_words<info::word_count(sizeof...(t))> make()
+		{
+			const typename info::unsigned_type chars[] = { static_cast<typename info::unsigned_type>(t)..., 0 };
+			packed_words<info::word_count(sizeof...(t))> out{};
+			for (std::size_t i = 0; i < sizeof...(t); ++i)
+				out.words[i / info::chars_per_word] |= static_cast<std::uint64_t>(chars[i]) << (i % info::chars_per_word * info::bits);
+			return out;
+		}
+
+		static constexpr packed_words<info::word_count(sizeof...(t))> value = make();
+	};
+
+	// Only ever named inside decltype.  Spelling the result as the return type of a function that's never defined,
+	// instead of as a member typedef, keeps pack_words out of the debug info (and a variable template would end up
+	// in the object file), so nothing that's emitted is still named after every character.
+	template <typename T, T...t, std::size_t...I>
+	packed<T, sizeof...(t), pack_words<T, t...>::value.words[I]...> pack(std::integer_sequence<T, t...>, std::index_sequence<I...>);
+
+	template <typename PackedType, typename Indices = std::make_index_sequence<PackedType::size()>>
+	struct unpack;
+
+	template <typename T, std::size_t Length, std::uint64_t...Words, std::size_t...I>
+	struct unpack<packed<T, Length, Words...>, std::index_sequence<I...>>
+	{
+		using info = packing<T>;
+		static_assert(sizeof...(Words) == info::word_count(Length), "Not a packed string made by pack_t.");
+
+		static constexpr std::uint64_t words[] = { Words..., 0 };
+		using type = std::integer_sequence<T, static_cast<T>(static_cast<typename info::unsigned_type>(words[I / info::chars_per_word] >> (I % info::chars_per_word * info::bits)))...>;
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PACKED
+/// \brief The \c ctstr::packed form of a \c string_to_type string
+///
+/// \code
+/// static_assert(std::is_same<ctstr::pack_t<string_to_type("Hello!")>, ctstr::packed<char, 6, 0x216F6C6C6548>>::value, "");
+/// \endcode
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+using pack_t = decltype(detail::pack(SeqType{}, std::make_index_sequence<detail::packing<typename sequence_type<SeqType>::type>::word_count(SeqType::size())>{}));
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PACKED
+/// \brief The \c std::integer_sequence that a \c ctstr::packed string came from
+///
+/// <tt>unpack_t<pack_t<S>></tt> is always exactly \c S, so anything that takes a \c string_to_type string
+/// (\c to_string(), \c data and so on) can be used on a packed one through this.
+////////////////////////////////////////////////////////////
+template <typename PackedType>
+using unpack_t = typename detail::unpack<PackedType>::type;
+
+}
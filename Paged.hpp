@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Paged.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_PAGED Paged strings
+///
+/// Strings too long for \c string_to_type: SQL, shaders, schemas and other text assets embedded in the program.
+///
+/// \c string_to_type is a macro tree that's always \c CTSTR_MAX_STRING_SIZE characters wide, so a 64K limit means
+/// 65536 instantiations for every string, however short.  A \c ctstr::paged string is cut into pages of
+/// \c CTSTR_PAGE_SIZE characters instead, each page made from the text with a single \c std::make_index_sequence,
+/// so compiling one costs time and memory in proportion to how long it really is and there's no upper limit.
+///
+/// \code
+/// constexpr char schema_sql[] =
+/// #include "schema.sql.inc"   // R"SQL( ... )SQL"
+/// ;
+/// using schema = ctstr::paged_t<schema_sql>;
+///
+/// static_assert(ctstr::find_v<schema, string_to_type("DROP")> == ctstr::npos, "");
+/// std::string_view text = ctstr::to_string_view<schema>();
+/// \endcode
+///
+/// \c data, \c size, \c to_string_view(), \c to_string() and \c to_c_string() work on paged strings the same way they do
+/// on sequences, so does everything built on them (the hashes, \c equals and so on), and so do the operations in
+/// \c Algorithms.hpp and \c Unicode.hpp.  Those give back ordinary \c std::integer_sequence strings, except \c to_upper_t
+/// and \c to_lower_t, which keep the pages.
+////////////////////////////////////////////////////////////
+
+#ifndef CTSTR_PAGE_SIZE
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PAGED
+/// \brief The number of characters in every page of a \c ctstr::paged string but the last
+///
+/// Smaller pages mean less to redo when only part of a string changes between builds; larger ones mean fewer types.
+////////////////////////////////////////////////////////////
+#define CTSTR_PAGE_SIZE 0x400
+#endif
+
+#if CTSTR_USE_NTTP
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PAGED
+/// \brief Like \c string_to_type, but the result is a \c ctstr::paged string
+///
+/// With \c CTSTR_USE_NTTP the literal is paged directly, so this has no length limit.  Otherwise it's
+/// <tt>page_t<string_to_type(str)></tt>, and \c CTSTR_MAX_STRING_SIZE still applies; use \c paged_t on a \c constexpr
+/// array instead for long text before C++20.
+////////////////////////////////////////////////////////////
+#define paged_string_to_type(str) ::ctstr::detail::paginate_t<::ctstr::detail::literal_source<::ctstr::detail::string_literal{str}>>
+#else
+#define paged_string_to_type(str) ::ctstr::page_t<string_to_type(str)>
+#endif
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PAGED
+/// \brief A string of \c T made of the pages \c Pages, one after the other
+///
+/// Each page is an \c std::integer_sequence of \c T.  Get these from \c paged_t, \c page_t or \c paged_string_to_type
+/// rather than writing them out, so that the same text is always split the same way and so is always the same type.
+////////////////////////////////////////////////////////////
+template <typename T, typename...Pages>
+struct paged
+{
+	static_assert((std::is_same<typename sequence_type<Pages>::type, T>::value && ...), "Every page must be an std::integer_sequence of the string's character type.");
+	using value_type = T;
+	static constexpr std::size_t size() noexcept { return (std::size_t{ 0 } + ... + Pages::size()); }
+	static constexpr std::size_t page_count = sizeof...(Pages);
+};
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+template <typename T, typename...Pages>
+struct sequence_type<paged<T, Pages...>> { using type = T; };
+
+template <typename T>
+struct is_paged : std::false_type {};
+template <typename T, typename...Pages>
+struct is_paged<paged<T, Pages...>> : std::true_type {};
+
+namespace detail
+{
+	template <typename T, T...t>
+	constexpr void append_page(T* out, std::size_t& o, std::integer_sequence<T, t...>)
+	{
+		const T page[] = { t..., T() };
+		for (std::size_t i = 0; i < sizeof...(t); ++i)
+			out[o++] = page[i];
+	}
+
+	// All the pages joined together, plus a terminator; the same as Algorithms.hpp's chars() for a sequence.
+	template <typename T, typename...Pages>
+	constexpr std::array<T, paged<T, Pages...>::size() + 1> chars(paged<T, Pages...>)
+	{
+		std::array<T, paged<T, Pages...>::size() + 1> out{};
+		// Only ever read by append_page, so an empty string with no pages would warn about it.
+		[[maybe_unused]] std::size_t o = 0;
+		(append_page(out.data(), o, Pages{}), ...);
+		return out;
+	}
+
+	// data<paged<...>> points into one joined copy of the text, the same way it does for sequences.
+	template <typename T, typename...Pages, std::size_t Alignment>
+	struct sequence_storage<paged<T, Pages...>, Alignment>
+	{
+		static_assert(Alignment == 0 || (Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0), "Alignment must be 0 or a power of 2 no smaller than alignof(T).");
+		alignas(Alignment == 0? alignof(T) : Alignment) static constexpr std::array<T, paged<T, Pages...>::size() + 1> value = chars(paged<T, Pages...>{});
+		static constexpr const T* array = value.data();
+	};
+
+	// Where the text to be paged comes from: a type with a static size and static chars that can be indexed in a constant expression.
+	template <const auto& Array>
+	struct array_source
+	{
+		using type = std::remove_const_t<std::remove_extent_t<std::remove_reference_t<decltype(Array)>>>;
+		static_assert(std::extent<std::remove_reference_t<decltype(Array)>>::value > 0, "paged_t needs an array with a null terminator, like a string literal.");
+		static constexpr std::size_t size = std::extent<std::remove_reference_t<decltype(Array)>>::value - 1;
+		static constexpr const type* chars = Array;
+	};
+
+	template <typename SeqType>
+	struct sequence_source
+	{
+		using type = typename sequence_type<SeqType>::type;
+		static constexpr std::size_t size = SeqType::size();
+		static constexpr const type* chars = sequence_storage<SeqType, 0>::array;
+	};
+
+#if CTSTR_USE_NTTP
+	template <auto Literal>
+	struct literal_source
+	{
+		using type = std::remove_const_t<std::remove_reference_t<decltype(*Literal.chars)>>;
+		static constexpr std::size_t size = decltype(Literal)::size;
+		static constexpr const type* chars = Literal.chars;
+	};
+#endif
+
+	template <typename Source, std::size_t Page, typename Indices>
+	struct page_of;
+
+	template <typename Source, std::size_t Page, std::size_t...I>
+	struct page_of<Source, Page, std::index_sequence<I...>>
+	{
+		using type = std::integer_sequence<typename Source::type, Source::chars[Page * CTSTR_PAGE_SIZE + I]...>;
+	};
+
+	template <typename Source, typename Pages = std::make_index_sequence<(Source::size + CTSTR_PAGE_SIZE - 1) / CTSTR_PAGE_SIZE>>
+	struct paginate;
+
+	// Every page but the last uses the same std::make_index_sequence<CTSTR_PAGE_SIZE>, so there are only ever two of them.
+	template <typename Source, std::size_t...P>
+	struct paginate<Source, std::index_sequence<P...>>
+	{
+		static_assert(CTSTR_PAGE_SIZE > 0, "CTSTR_PAGE_SIZE can't be 0.");
+
+		static constexpr std::size_t page_length(std::size_t page)
+		{
+			return Source::size - page * CTSTR_PAGE_SIZE < CTSTR_PAGE_SIZE? Source::size - page * CTSTR_PAGE_SIZE : CTSTR_PAGE_SIZE;
+		}
+
+		using type = paged<typename Source::type, typename page_of<Source, P, std::make_index_sequence<page_length(P)>>::type...>;
+	};
+
+	template <typename Source>
+	using paginate_t = typename paginate<Source>::type;
+
+	template <typename PagedType>
+	struct unpage;
+
+	template <typename T>
+	struct unpage<paged<T>>
+	{
+		using type = std::integer_sequence<T>;
+	};
+
+	template <typename T, T...t>
+	struct unpage<paged<T, std::integer_sequence<T, t...>>>
+	{
+		using type = std::integer_sequence<T, t...>;
+	};
+
+	template <typename T, typename...Pages>
+	struct unpage<paged<T, Pages...>>
+	{
+		template <std::size_t...I>
+		static auto make(std::index_sequence<I...>) -> std::integer_sequence<T, sequence_storage<paged<T, Pages...>, 0>::value[I]...>;
+
+		using type = decltype(make(std::make_index_sequence<paged<T, Pages...>::size()>{}));
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PAGED
+/// \brief The text of a \c constexpr character array with static storage duration, as a \c ctstr::paged string
+///
+/// The array's last element is taken to be the null terminator and left out, as with a string literal.  Works with arrays
+/// of any length and any character type, from C++17 on.
+////////////////////////////////////////////////////////////
+template <const auto& Array>
+using paged_t = detail::paginate_t<detail::array_source<Array>>;
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PAGED
+/// \brief The \c ctstr::paged form of a \c string_to_type string
+///
+/// <tt>page_t<string_to_type("...")></tt> is the same type as <tt>paged_string_to_type("...")</tt> and as \c paged_t
+/// of an array holding the same text.
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+using page_t = detail::paginate_t<detail::sequence_source<SeqType>>;
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_PAGED
+/// \brief The whole of a \c ctstr::paged string as one \c std::integer_sequence
+///
+/// <tt>unpage_t<page_t<S>></tt> is always exactly \c S.
+////////////////////////////////////////////////////////////
+template <typename PagedType>
+using unpage_t = typename detail::unpage<PagedType>::type;
+
+}
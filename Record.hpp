@@ -0,0 +1,401 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Dispatch.hpp"
+#include "Hash.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Record.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_RECORD Records
+///
+/// A struct whose members are named by \c string_to_type strings, for replacing a map from names to values
+/// when the names are all known at compile time.
+///
+/// \code
+/// using config = ctstr::record<
+///     ctstr::named<string_to_type("host"), std::string_view>,
+///     ctstr::named<string_to_type("port"), int>,
+///     ctstr::named<string_to_type("verbose"), bool>>;
+///
+/// config c("localhost", 8080, false);
+/// ctstr::get<string_to_type("port")>(c) = 9090;         // A load or store at a fixed offset
+/// if (int* port = ctstr::get_if<int>(c, "port"))         // The name is only known at runtime
+///     ...
+/// \endcode
+///
+/// The values are stored one after another in a single block, sorted from the most strictly aligned to the least,
+/// so there's no padding between them and at most the padding at the end that any struct would need.  Each one's offset
+/// is worked out at compile time.  Asking for a name that isn't there, or giving two values the same name, doesn't compile.
+///
+/// Looking a value up by a runtime name goes through a perfect hash of the names (the same one \c ctstr::dispatch uses)
+/// straight to that value's offset.
+///
+/// If every value is trivially copyable, so is the record.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_RECORD
+/// \brief A value of type \c T in a \c record, called \c SeqType
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename T>
+struct named
+{
+	static_assert(std::is_same<typename sequence_type<SeqType>::type, char>::value, "Record names must be strings of char.");
+	static_assert(std::is_object<T>::value && !std::is_array<T>::value, "Record values must be objects (and not arrays).");
+
+	using key = SeqType;
+	using type = T;
+};
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	template <std::size_t N>
+	struct record_offsets
+	{
+		std::array<std::size_t, N + 1> offsets{};
+		std::size_t size = 0;
+		std::size_t alignment = 1;
+	};
+
+	template <typename...Named>
+	struct record_layout
+	{
+		static constexpr std::size_t count = sizeof...(Named);
+
+		static constexpr record_offsets<count> make()
+		{
+			const std::size_t sizes[] = { sizeof(typename Named::type)..., 0 };
+			const std::size_t alignments[] = { alignof(typename Named::type)..., 1 };
+
+			// Most strictly aligned first, otherwise in the order they were given (an insertion sort, so it's stable).
+			std::array<std::size_t, count + 1> order{};
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				std::size_t j = i;
+				for (; j > 0 && alignments[order[j - 1]] < alignments[i]; --j)
+					order[j] = order[j - 1];
+				order[j] = i;
+			}
+
+			// Every size is a multiple of its alignment, and every alignment a power of 2, so in this order
+			// each value already starts on a multiple of its own alignment.
+			record_offsets<count> out{};
+			for (std::size_t k = 0; k < count; ++k)
+			{
+				std::size_t i = order[k];
+				out.offsets[i] = out.size;
+				out.size += sizes[i];
+				out.alignment = alignments[i] > out.alignment? alignments[i] : out.alignment;
+			}
+			out.size = (out.size + out.alignment - 1) / out.alignment * out.alignment;
+			if (out.size == 0)
+				out.size = 1;
+			return out;
+		}
+
+		static constexpr record_offsets<count> value = make();
+	};
+
+	template <typename Key, typename...Named>
+	constexpr std::size_t record_index()
+	{
+		constexpr bool matches[] = { std::is_same<typename Named::key, Key>::value..., false };
+		for (std::size_t i = 0; i < sizeof...(Named); ++i)
+			if (matches[i])
+				return i;
+		return sizeof...(Named);
+	}
+
+	template <typename Key, typename...Named>
+	constexpr std::size_t record_key_count()
+	{
+		return (std::size_t{ 0 } + ... + std::is_same<typename Named::key, Key>::value);
+	}
+
+	// For constructors that construct the values themselves.
+	struct record_no_values {};
+
+	// The bytes the values live in, and how to get at each one.
+	template <typename...Named>
+	class record_bytes
+	{
+	protected:
+		using layout = record_layout<Named...>;
+
+		template <std::size_t I>
+		using type_at = typename std::tuple_element_t<I, std::tuple<Named...>>::type;
+
+		template <std::size_t I>
+		type_at<I>* at() { return std::launder(reinterpret_cast<type_at<I>*>(m_bytes + layout::value.offsets[I])); }
+
+		template <std::size_t I>
+		const type_at<I>* at() const { return std::launder(reinterpret_cast<const type_at<I>*>(m_bytes + layout::value.offsets[I])); }
+
+		void* address(std::size_t i) { return m_bytes + layout::value.offsets[i]; }
+		const void* address(std::size_t i) const { return m_bytes + layout::value.offsets[i]; }
+
+		template <typename F, std::size_t...I>
+		static void each(F&& f, std::index_sequence<I...>) { (f(std::integral_constant<std::size_t, I>{}), ...); }
+
+		template <typename F>
+		static void each(F&& f) { each(f, std::index_sequence_for<Named...>{}); }
+
+		record_bytes()
+		{
+			each([this](auto i) { new (this->address(i)) type_at<i>(); });
+		}
+
+		explicit record_bytes(record_no_values) {}
+
+		template <typename...Args>
+		explicit record_bytes(std::in_place_t, Args&&...args)
+		{
+			construct(std::index_sequence_for<Named...>{}, std::forward<Args>(args)...);
+		}
+
+		template <std::size_t...I, typename...Args>
+		void construct(std::index_sequence<I...>, Args&&...args)
+		{
+			(new (address(I)) type_at<I>(std::forward<Args>(args)), ...);
+		}
+
+		alignas(layout::value.alignment) unsigned char m_bytes[layout::value.size];
+	};
+
+	// When every value is trivially copyable, so are the bytes, and the defaults are right.
+	template <bool Trivial, typename...Named>
+	class record_storage : public record_bytes<Named...>
+	{
+	protected:
+		using record_bytes<Named...>::record_bytes;
+	};
+
+	// Otherwise each value has to be copied, moved and destroyed in place.
+	template <typename...Named>
+	class record_storage<false, Named...> : public record_bytes<Named...>
+	{
+		using base = record_bytes<Named...>;
+
+	protected:
+		using base::base;
+		using base::each;
+		using base::address;
+
+		template <std::size_t I>
+		using type_at = typename base::template type_at<I>;
+
+		record_storage(const record_storage& other) : base(record_no_values{})
+		{
+			each([this, &other](auto i) { new (this->address(i)) type_at<i>(*other.template at<i>()); });
+		}
+
+		record_storage(record_storage&& other) noexcept((std::is_nothrow_move_constructible<typename Named::type>::value && ...)) : base(record_no_values{})
+		{
+			each([this, &other](auto i) { new (this->address(i)) type_at<i>(std::move(*other.template at<i>())); });
+		}
+
+		record_storage& operator=(const record_storage& other)
+		{
+			each([this, &other](auto i) { *this->template at<i>() = *other.template at<i>(); });
+			return *this;
+		}
+
+		record_storage& operator=(record_storage&& other) noexcept((std::is_nothrow_move_assignable<typename Named::type>::value && ...))
+		{
+			each([this, &other](auto i) { *this->template at<i>() = std::move(*other.template at<i>()); });
+			return *this;
+		}
+
+		~record_storage()
+		{
+			each([this](auto i) { using T = type_at<i>; this->template at<i>()->~T(); });
+		}
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_RECORD
+/// \brief Values of the types in \c Named, each called by its name
+///
+/// \see get(), get_if(), visit()
+////////////////////////////////////////////////////////////
+template <typename...Named>
+class record : private detail::record_storage<(std::is_trivially_copyable<typename Named::type>::value && ...), Named...>
+{
+	using base = detail::record_storage<(std::is_trivially_copyable<typename Named::type>::value && ...), Named...>;
+
+	static_assert(((detail::record_key_count<typename Named::key, Named...>() == 1) && ...), "Two values in a record have the same name.");
+
+	template <typename Key>
+	static constexpr std::size_t index()
+	{
+		constexpr std::size_t i = detail::record_index<Key, Named...>();
+		static_assert(i < sizeof...(Named), "The record has no value with this name.");
+		return i;
+	}
+
+	// Which value (if any) a runtime name refers to.
+	std::size_t find(std::string_view key) const
+	{
+		if constexpr (sizeof...(Named) == 0)
+			return 0;
+		else
+		{
+			using table = detail::dispatch_table<char, typename Named::key...>;
+			std::uint32_t i = table::table.find(xxh64(key.data(), key.size()));
+			if (i == detail::dispatch_empty_slot || table::keys[i] != key)
+				return sizeof...(Named);
+			return i;
+		}
+	}
+
+public:
+	/// Number of values.
+	static constexpr std::size_t size() noexcept { return sizeof...(Named); }
+
+	/// Value-initializes every value.
+	record() = default;
+
+	/// Constructs each value from the corresponding argument, in the order they were given to \c record (not the order they're stored in).
+	template <typename...Args, typename = std::enable_if_t<sizeof...(Args) == sizeof...(Named) && sizeof...(Args) != 0
+	                                                      && !(sizeof...(Args) == 1 && (std::is_same<std::decay_t<Args>, record>::value && ...))>>
+	record(Args&&...args) : base(std::in_place, std::forward<Args>(args)...) {}
+
+	/// The value called \c Key.  \see ctstr::get()
+	template <typename Key>
+	auto& get() { return *this->template at<index<Key>()>(); }
+
+	/// \copydoc get
+	template <typename Key>
+	const auto& get() const { return *this->template at<index<Key>()>(); }
+
+	/// The value called \c key, if there is one and it's a \c T.  \see ctstr::get_if()
+	template <typename T>
+	T* get_if(std::string_view key)
+	{
+		constexpr bool is_t[] = { std::is_same<typename Named::type, T>::value..., false };
+		std::size_t i = find(key);
+		return i < sizeof...(Named) && is_t[i]? static_cast<T*>(this->address(i)) : nullptr;
+	}
+
+	/// \copydoc get_if
+	template <typename T>
+	const T* get_if(std::string_view key) const
+	{
+		constexpr bool is_t[] = { std::is_same<typename Named::type, T>::value..., false };
+		std::size_t i = find(key);
+		return i < sizeof...(Named) && is_t[i]? static_cast<const T*>(this->address(i)) : nullptr;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Calls \c visitor with the value called \c key, if there is one
+	///
+	/// \return Whether there was a value called \c key
+	////////////////////////////////////////////////////////////
+	template <typename Visitor>
+	bool visit(std::string_view key, Visitor&& visitor)
+	{
+		return dispatch<typename Named::key...>(key,
+			[&](auto matched) { visitor(get<decltype(matched)>()); return true; },
+			[]() { return false; });
+	}
+
+	/// \copydoc visit
+	template <typename Visitor>
+	bool visit(std::string_view key, Visitor&& visitor) const
+	{
+		return dispatch<typename Named::key...>(key,
+			[&](auto matched) { visitor(get<decltype(matched)>()); return true; },
+			[]() { return false; });
+	}
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_RECORD
+/// \brief The value called \c Key
+///
+/// Doesn't compile if there isn't one.  Always compiles down to an access at a constant offset.
+////////////////////////////////////////////////////////////
+template <typename Key, typename...Named>
+auto& get(record<Named...>& r)
+{
+	return r.template get<Key>();
+}
+
+/// \copydoc get
+template <typename Key, typename...Named>
+const auto& get(const record<Named...>& r)
+{
+	return r.template get<Key>();
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_RECORD
+/// \brief The value called \c key, if there is one and it's a \c T
+///
+/// \return A pointer to the value, or null
+////////////////////////////////////////////////////////////
+template <typename T, typename...Named>
+T* get_if(record<Named...>& r, std::string_view key)
+{
+	return r.template get_if<T>(key);
+}
+
+/// \copydoc get_if
+template <typename T, typename...Named>
+const T* get_if(const record<Named...>& r, std::string_view key)
+{
+	return r.template get_if<T>(key);
+}
+
+}
@@ -0,0 +1,999 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Regex.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_REGEX Regular expressions
+///
+/// Regular expressions whose pattern is a \c string_to_type string, compiled into a DFA while your program compiles.
+///
+/// The syntax is the regular subset of ECMAScript's (what \c std::regex uses by default):
+///  - Literal characters, and \c . for any byte but \c '\\n'
+///  - Classes like <tt>[a-z_]</tt> and <tt>[^,]</tt>, and the escapes \c \\d, \c \\w, \c \\s, \c \\D, \c \\W and \c \\S inside or outside them
+///  - \c \\n, \c \\t, \c \\r, \c \\f, \c \\v, \c \\0 and <tt>\\xHH</tt>, and a backslash before any punctuation to make it literal
+///  - \c *, \c +, \c ? and <tt>{n}</tt>, <tt>{n,}</tt> and <tt>{n,m}</tt> (up to 1000), one to an atom
+///  - Grouping with <tt>(...)</tt> or <tt>(?:...)</tt>, which are the same thing since nothing is captured, and alternation with \c |
+///
+/// Anything that a DFA can't do (backreferences, lookaround, lazy quantifiers, \c \\b, \c ^ and \c $) is a compile error, as is
+/// a malformed pattern.  Patterns and the text they're matched against are bytes, so UTF-8 is matched a byte at a time.
+////////////////////////////////////////////////////////////
+
+#ifndef CTSTR_REGEX_MAX_STATES
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_REGEX
+/// \brief The most DFA states any one pattern can compile to
+///
+/// Some patterns, like <tt>(a|b)*a(a|b){20}</tt>, need exponentially many states.  Rather than let the compiler run out of
+/// memory on them, \c ctstr::regex fails a \c static_assert once a pattern needs more than this.
+////////////////////////////////////////////////////////////
+#define CTSTR_REGEX_MAX_STATES 0x400
+#endif
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	enum class regex_error
+	{
+		none,
+		unbalanced_parenthesis,
+		bad_escape,
+		bad_class,
+		bad_repeat,
+		nothing_to_repeat,
+		unsupported,
+		too_many_states
+	};
+
+	using regex_byte_set = std::array<std::uint64_t, 4>;
+
+	constexpr void regex_add(regex_byte_set& set, unsigned first, unsigned last)
+	{
+		for (unsigned b = first; b <= last; ++b)
+			set[b / 64] |= std::uint64_t{ 1 } << (b % 64);
+	}
+
+	constexpr bool regex_has(const regex_byte_set& set, unsigned b)
+	{
+		return (set[b / 64] >> (b % 64)) & 1;
+	}
+
+	constexpr void regex_add(regex_byte_set& set, const regex_byte_set& other, bool negate)
+	{
+		for (std::size_t i = 0; i < 4; ++i)
+			set[i] |= negate? ~other[i] : other[i];
+	}
+
+	enum class regex_kind : std::uint8_t { epsilon, split, bytes, match };
+
+	struct regex_nfa_state
+	{
+		regex_kind kind = regex_kind::epsilon;
+		std::uint32_t out1 = 0;
+		std::uint32_t out2 = 0;
+		regex_byte_set set{};
+	};
+
+	// A Thompson NFA, built by a recursive descent parser.  Every piece of the pattern becomes a fragment with one way in
+	// and one way out, where the way out is an epsilon state whose target gets filled in once we know what comes next.
+	//
+	// Capacity can be 0, in which case nothing is stored and only state_count and error come out.  That's how the
+	// number of states is found before the real thing is built.
+	template <std::size_t Capacity>
+	struct regex_nfa
+	{
+		struct fragment
+		{
+			std::uint32_t start;
+			std::uint32_t end;
+		};
+
+		std::array<regex_nfa_state, Capacity == 0? 1 : Capacity> states{};
+		std::size_t state_count = 0;
+		std::uint32_t start = 0;
+		regex_error error = regex_error::none;
+
+		const char* str = nullptr;
+		std::size_t length = 0;
+		std::size_t pos = 0;
+
+		constexpr regex_nfa(const char* pattern, std::size_t pattern_length)
+			: str(pattern), length(pattern_length)
+		{
+			fragment f = parse_alternation();
+			if (pos != length)
+				fail(regex_error::unbalanced_parenthesis);
+			std::uint32_t m = add(regex_kind::match, 0, 0, {});
+			patch(f.end, m);
+			start = f.start;
+		}
+
+		constexpr void fail(regex_error e)
+		{
+			if (error == regex_error::none)
+				error = e;
+			pos = length;
+		}
+
+		constexpr bool at_end() const { return pos >= length; }
+		constexpr char peek() const { return str[pos]; }
+
+		constexpr std::uint32_t add(regex_kind kind, std::uint32_t out1, std::uint32_t out2, const regex_byte_set& set)
+		{
+			if (state_count < Capacity)
+			{
+				states[state_count].kind = kind;
+				states[state_count].out1 = out1;
+				states[state_count].out2 = out2;
+				states[state_count].set = set;
+			}
+			return static_cast<std::uint32_t>(state_count++);
+		}
+
+		constexpr void patch(std::uint32_t state, std::uint32_t target)
+		{
+			if (state < Capacity)
+				states[state].out1 = target;
+		}
+
+		constexpr fragment empty()
+		{
+			std::uint32_t e = add(regex_kind::epsilon, 0, 0, {});
+			return { e, e };
+		}
+
+		constexpr fragment append(fragment f, fragment g)
+		{
+			patch(f.end, g.start);
+			return { f.start, g.end };
+		}
+
+		constexpr fragment alternate(fragment f, fragment g)
+		{
+			std::uint32_t e = add(regex_kind::epsilon, 0, 0, {});
+			std::uint32_t s = add(regex_kind::split, f.start, g.start, {});
+			patch(f.end, e);
+			patch(g.end, e);
+			return { s, e };
+		}
+
+		constexpr fragment optional(fragment f)
+		{
+			std::uint32_t e = add(regex_kind::epsilon, 0, 0, {});
+			std::uint32_t s = add(regex_kind::split, f.start, e, {});
+			patch(f.end, e);
+			return { s, e };
+		}
+
+		constexpr fragment star(fragment f)
+		{
+			std::uint32_t e = add(regex_kind::epsilon, 0, 0, {});
+			std::uint32_t s = add(regex_kind::split, f.start, e, {});
+			patch(f.end, s);
+			return { s, e };
+		}
+
+		constexpr fragment plus(fragment f)
+		{
+			std::uint32_t e = add(regex_kind::epsilon, 0, 0, {});
+			std::uint32_t s = add(regex_kind::split, f.start, e, {});
+			patch(f.end, s);
+			return { f.start, e };
+		}
+
+		constexpr fragment parse_alternation()
+		{
+			fragment f = parse_concatenation();
+			while (!at_end() && peek() == '|')
+			{
+				++pos;
+				f = alternate(f, parse_concatenation());
+			}
+			return f;
+		}
+
+		constexpr fragment parse_concatenation()
+		{
+			fragment f = empty();
+			while (!at_end() && peek() != '|' && peek() != ')')
+				f = append(f, parse_repeat());
+			return f;
+		}
+
+		constexpr std::size_t parse_number()
+		{
+			std::size_t n = 0;
+			bool any = false;
+			while (!at_end() && peek() >= '0' && peek() <= '9')
+			{
+				n = n * 10 + static_cast<std::size_t>(peek() - '0');
+				if (n > 1000)
+					n = 1001;
+				any = true;
+				++pos;
+			}
+			if (!any)
+				fail(regex_error::bad_repeat);
+			return n;
+		}
+
+		constexpr fragment parse_repeat()
+		{
+			std::size_t atom_pos = pos;
+			fragment f = parse_atom();
+			if (at_end())
+				return f;
+
+			switch (peek())
+			{
+			case '*': ++pos; f = star(f); break;
+			case '+': ++pos; f = plus(f); break;
+			case '?': ++pos; f = optional(f); break;
+			case '{':
+			{
+				++pos;
+				std::size_t min = parse_number(), max = min;
+				bool unbounded = false;
+				if (!at_end() && peek() == ',')
+				{
+					++pos;
+					if (!at_end() && peek() == '}')
+						unbounded = true;
+					else
+						max = parse_number();
+				}
+				if (at_end() || peek() != '}' || max < min || max > 1000)
+				{
+					fail(regex_error::bad_repeat);
+					return f;
+				}
+				++pos;
+
+				// Copies of the atom come from parsing it again, so the states are all separate.
+				std::size_t after = pos;
+				fragment result = empty();
+				for (std::size_t i = 0; i < (unbounded? min + 1 : max); ++i)
+				{
+					fragment copy = f;
+					if (i > 0)
+					{
+						pos = atom_pos;
+						copy = parse_atom();
+					}
+					if (i >= min)
+						copy = unbounded? star(copy) : optional(copy);
+					result = append(result, copy);
+				}
+				pos = after;
+				f = result;
+				break;
+			}
+			default:
+				return f;
+			}
+
+			if (!at_end() && peek() == '?')
+				fail(regex_error::unsupported);
+			else if (!at_end() && (peek() == '*' || peek() == '+' || peek() == '{'))
+				fail(regex_error::bad_repeat);
+			return f;
+		}
+
+		constexpr fragment bytes(const regex_byte_set& set)
+		{
+			std::uint32_t e = add(regex_kind::epsilon, 0, 0, {});
+			std::uint32_t s = add(regex_kind::bytes, e, 0, set);
+			return { s, e };
+		}
+
+		constexpr fragment parse_atom()
+		{
+			if (at_end())
+			{
+				fail(regex_error::nothing_to_repeat);
+				return empty();
+			}
+
+			char c = peek();
+			++pos;
+			regex_byte_set set{};
+			switch (c)
+			{
+			case '(':
+			{
+				if (!at_end() && peek() == '?')
+				{
+					if (pos + 1 < length && str[pos + 1] == ':')
+						pos += 2;
+					else
+					{
+						fail(regex_error::unsupported);
+						return empty();
+					}
+				}
+				fragment f = parse_alternation();
+				if (at_end() || peek() != ')')
+					fail(regex_error::unbalanced_parenthesis);
+				else
+					++pos;
+				return f;
+			}
+			case '*': case '+': case '?': case '{':
+				fail(regex_error::nothing_to_repeat);
+				return empty();
+			case '^': case '$':
+				fail(regex_error::unsupported);
+				return empty();
+			case '[':
+				parse_class(set);
+				return bytes(set);
+			case '.':
+				regex_add(set, 0, 0xFF);
+				set['\n' / 64] &= ~(std::uint64_t{ 1 } << ('\n' % 64));
+				return bytes(set);
+			case '\\':
+				parse_escape(set, false);
+				return bytes(set);
+			default:
+				regex_add(set, static_cast<unsigned char>(c), static_cast<unsigned char>(c));
+				return bytes(set);
+			}
+		}
+
+		static constexpr unsigned hex_digit(char c)
+		{
+			return c >= '0' && c <= '9'? static_cast<unsigned>(c - '0') :
+			       c >= 'a' && c <= 'f'? static_cast<unsigned>(c - 'a' + 10) :
+			       c >= 'A' && c <= 'F'? static_cast<unsigned>(c - 'A' + 10) : 16;
+		}
+
+		// The escape after a backslash.  Returns the byte it stands for, or -1 for a whole class like \d (which can't start a range).
+		constexpr int parse_escape(regex_byte_set& set, bool in_class)
+		{
+			if (at_end())
+			{
+				fail(regex_error::bad_escape);
+				return -1;
+			}
+
+			char c = peek();
+			++pos;
+			regex_byte_set cls{};
+			switch (c)
+			{
+			case 'd': case 'D':
+				regex_add(cls, '0', '9');
+				regex_add(set, cls, c == 'D');
+				return -1;
+			case 'w': case 'W':
+				regex_add(cls, '0', '9');
+				regex_add(cls, 'a', 'z');
+				regex_add(cls, 'A', 'Z');
+				regex_add(cls, '_', '_');
+				regex_add(set, cls, c == 'W');
+				return -1;
+			case 's': case 'S':
+				regex_add(cls, '\t', '\r');
+				regex_add(cls, ' ', ' ');
+				regex_add(set, cls, c == 'S');
+				return -1;
+			case 'n': c = '\n'; break;
+			case 't': c = '\t'; break;
+			case 'r': c = '\r'; break;
+			case 'f': c = '\f'; break;
+			case 'v': c = '\v'; break;
+			case '0': c = '\0'; break;
+			case 'x':
+			{
+				unsigned high = pos < length? hex_digit(str[pos]) : 16;
+				unsigned low = pos + 1 < length? hex_digit(str[pos + 1]) : 16;
+				if (high > 15 || low > 15)
+				{
+					fail(regex_error::bad_escape);
+					return -1;
+				}
+				pos += 2;
+				c = static_cast<char>(high * 16 + low);
+				break;
+			}
+			case 'b':
+				// \b is a backspace in a class, and a word boundary (which a DFA can't do) outside one.
+				if (!in_class)
+				{
+					fail(regex_error::unsupported);
+					return -1;
+				}
+				c = '\b';
+				break;
+			default:
+				if (c >= '1' && c <= '9')
+				{
+					fail(regex_error::unsupported);
+					return -1;
+				}
+				if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_')
+				{
+					fail(regex_error::bad_escape);
+					return -1;
+				}
+				break;
+			}
+			regex_add(set, static_cast<unsigned char>(c), static_cast<unsigned char>(c));
+			return static_cast<unsigned char>(c);
+		}
+
+		constexpr void parse_class(regex_byte_set& set)
+		{
+			bool negate = !at_end() && peek() == '^';
+			if (negate)
+				++pos;
+
+			// As in ECMAScript, [] matches nothing and [^] matches anything, rather than ] first being literal as in POSIX.
+			regex_byte_set members{};
+			while (!at_end() && peek() != ']')
+			{
+				int low = static_cast<unsigned char>(peek());
+				++pos;
+				if (low == '\\')
+					low = parse_escape(members, true);
+				else
+					regex_add(members, static_cast<unsigned>(low), static_cast<unsigned>(low));
+
+				if (low >= 0 && pos + 1 < length && peek() == '-' && str[pos + 1] != ']')
+				{
+					++pos;
+					int high = static_cast<unsigned char>(peek());
+					++pos;
+					if (high == '\\')
+					{
+						regex_byte_set ignored{};
+						high = parse_escape(ignored, true);
+					}
+					if (high < low)
+					{
+						fail(regex_error::bad_class);
+						return;
+					}
+					regex_add(members, static_cast<unsigned>(low), static_cast<unsigned>(high));
+				}
+			}
+			if (at_end())
+			{
+				fail(regex_error::bad_class);
+				return;
+			}
+			++pos;
+			regex_add(set, members, negate);
+		}
+	};
+
+	// The pattern, copied out of the sequence rather than read from data<Pattern> (see chars() in Algorithms.hpp for why).
+	template <typename T, T...t>
+	constexpr std::array<char, sizeof...(t) + 1> regex_chars(std::integer_sequence<T, t...>)
+	{
+		return {{ static_cast<char>(t)..., '\0' }};
+	}
+
+	struct regex_nfa_count
+	{
+		std::size_t state_count;
+		regex_error error;
+	};
+
+	template <typename Pattern>
+	constexpr regex_nfa_count regex_count_nfa()
+	{
+		const auto str = regex_chars(Pattern{});
+		const regex_nfa<0> nfa(str.data(), size<Pattern>);
+		return { nfa.state_count, nfa.error };
+	}
+
+	template <typename Pattern>
+	struct regex_nfa_size
+	{
+		static constexpr regex_nfa_count counted = regex_count_nfa<Pattern>();
+		static constexpr std::size_t value = counted.state_count;
+		static constexpr regex_error error = counted.error;
+	};
+
+	constexpr std::uint8_t regex_de_bruijn[64] = { 0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4, 62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5, 63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6 };
+
+	// The index of the lowest set bit; a loop over the bits is a lot of steps in a constant expression.
+	constexpr std::size_t regex_lowest_bit(std::uint64_t bits)
+	{
+		return regex_de_bruijn[((bits & (~bits + 1)) * 0x03f79d71b4cb0a89u) >> 58];
+	}
+
+	template <std::size_t States>
+	using regex_row_t = std::conditional_t<(States <= 0x100), std::uint8_t, std::conditional_t<(States <= 0x10000), std::uint16_t, std::uint32_t>>;
+
+	// Subset construction, from the NFA to a DFA of at most MaxStates states.  With Classes 0 only the number of states
+	// and classes comes out, which is what sizes the table the second time around.
+	//
+	// Like Scanner.hpp's automaton, transitions are row offsets (state * class_count), states where the pattern has matched
+	// come after all the rest so checking for a match is one comparison, and bytes that the pattern treats the same share a
+	// column.  Row 0 is the dead state, from which nothing can match any more.
+	template <typename Pattern, std::size_t MaxStates, std::size_t Classes>
+	struct regex_dfa
+	{
+		static constexpr std::size_t nfa_states = regex_nfa_size<Pattern>::value;
+		static constexpr std::size_t words = (nfa_states + 63) / 64;
+		using state_set = std::array<std::uint64_t, words>;
+		static constexpr bool store_table = Classes > 0;
+		using row_type = regex_row_t<MaxStates * Classes>;
+
+		std::array<std::uint8_t, 256> byte_class{};
+		std::size_t class_count = 0;
+		std::size_t state_count = 0;
+		std::array<row_type, store_table? MaxStates * Classes : 1> next{};
+		std::size_t start_row = 0;
+		std::size_t first_accepting_row = 0;
+		bool too_many_states = false;
+
+		constexpr regex_dfa()
+		{
+			const auto str = regex_chars(Pattern{});
+			const regex_nfa<nfa_states> nfa(str.data(), size<Pattern>);
+
+			// Split the bytes into classes: two bytes are in the same class if every byte set in the NFA has both or neither.
+			// Repeats like [0-9a-f]{8} make lots of copies of the same set, and each only needs looking at once.
+			std::array<regex_byte_set, nfa_states> distinct{};
+			std::size_t distinct_count = 0;
+			for (std::size_t s = 0; s < nfa_states; ++s)
+			{
+				if (nfa.states[s].kind != regex_kind::bytes)
+					continue;
+				bool seen = false;
+				for (std::size_t i = 0; i < distinct_count && !seen; ++i)
+					seen = distinct[i][0] == nfa.states[s].set[0] && distinct[i][1] == nfa.states[s].set[1] &&
+					       distinct[i][2] == nfa.states[s].set[2] && distinct[i][3] == nfa.states[s].set[3];
+				if (seen)
+					continue;
+				distinct[distinct_count++] = nfa.states[s].set;
+				std::array<std::uint16_t, 512> renumber{};
+				std::uint16_t count = 0;
+				for (unsigned b = 0; b < 256; ++b)
+				{
+					std::size_t key = byte_class[b] * 2u + regex_has(nfa.states[s].set, b);
+					if (renumber[key] == 0)
+						renumber[key] = ++count;
+					byte_class[b] = static_cast<std::uint8_t>(renumber[key] - 1);
+				}
+			}
+			class_count = 1;
+			std::array<unsigned, 256> representative{};
+			for (unsigned b = 256; b-- > 0;)
+			{
+				representative[byte_class[b]] = b;
+				class_count = byte_class[b] >= class_count? byte_class[b] + 1u : class_count;
+			}
+
+			// The DFA states as sets of NFA states.  Only bytes and match states are kept, since those are all that decide
+			// where to go next; two sets that differ only in epsilon states behave the same.
+			//
+			// Each NFA state's closure, and which bytes states take each class, are worked out once up front, so that a
+			// DFA transition is only a few ORs of whole words.
+			std::array<state_set, nfa_states> closures{};
+			for (std::size_t s = 0; s < nfa_states; ++s)
+				closures[s] = closure(nfa, static_cast<std::uint32_t>(s));
+			std::array<state_set, 256> takes{};
+			for (std::size_t c = 0; c < class_count; ++c)
+				for (std::size_t s = 0; s < nfa_states; ++s)
+					if (nfa.states[s].kind == regex_kind::bytes && regex_has(nfa.states[s].set, representative[c]))
+						takes[c][s / 64] |= std::uint64_t{ 1 } << (s % 64);
+
+			subsets found{};
+			std::array<std::uint32_t, store_table? MaxStates * Classes : 1> transitions{};
+			find_or_add(found, state_set{});
+			std::size_t start = find_or_add(found, closures[nfa.start]);
+
+			for (std::size_t d = 1; d < state_count && !too_many_states; ++d)
+			{
+				for (std::size_t c = 0; c < class_count; ++c)
+				{
+					state_set moved{};
+					for (std::size_t w = 0; w < words; ++w)
+					{
+						for (std::uint64_t bits = found.sets[d][w] & takes[c][w]; bits != 0; bits &= bits - 1)
+						{
+							std::size_t s = w * 64 + regex_lowest_bit(bits);
+							for (std::size_t v = 0; v < words; ++v)
+								moved[v] |= closures[nfa.states[s].out1][v];
+						}
+					}
+					std::size_t target = find_or_add(found, moved);
+					if constexpr (store_table)
+						transitions[d * class_count + c] = static_cast<std::uint32_t>(target);
+				}
+			}
+
+			// Renumber: the dead state first, then the states that haven't matched, then the ones that have.
+			std::array<std::uint32_t, MaxStates> renumbered{};
+			std::uint32_t count = 0;
+			for (std::size_t pass = 0; pass < 2; ++pass)
+			{
+				if (pass == 1)
+					first_accepting_row = count * class_count;
+				for (std::size_t d = 0; d < state_count; ++d)
+					if (found.accepting[d] == (pass == 1))
+						renumbered[d] = count++;
+			}
+			start_row = renumbered[start] * class_count;
+
+			if constexpr (store_table)
+				for (std::size_t d = 0; d < state_count; ++d)
+					for (std::size_t c = 0; c < class_count; ++c)
+						next[renumbered[d] * class_count + c] = static_cast<row_type>(renumbered[transitions[d * class_count + c]] * class_count);
+		}
+
+
+		// Every state reachable from from without reading anything, keeping only the bytes and match states.
+		template <typename Nfa>
+		static constexpr state_set closure(const Nfa& nfa, std::uint32_t from)
+		{
+			std::array<std::uint32_t, nfa_states> stack{};
+			std::size_t top = 0;
+			stack[top++] = from;
+
+			state_set seen{};
+			seen[from / 64] |= std::uint64_t{ 1 } << (from % 64);
+			state_set kept{};
+			while (top > 0)
+			{
+				std::uint32_t s = stack[--top];
+				const regex_nfa_state& state = nfa.states[s];
+				if (state.kind == regex_kind::bytes || state.kind == regex_kind::match)
+				{
+					kept[s / 64] |= std::uint64_t{ 1 } << (s % 64);
+					continue;
+				}
+				std::uint32_t outs[2] = { state.out1, state.out2 };
+				for (std::size_t i = 0; i < (state.kind == regex_kind::split? 2u : 1u); ++i)
+				{
+					if (!((seen[outs[i] / 64] >> (outs[i] % 64)) & 1))
+					{
+						seen[outs[i] / 64] |= std::uint64_t{ 1 } << (outs[i] % 64);
+						stack[top++] = outs[i];
+					}
+				}
+			}
+			return kept;
+		}
+
+		// The sets found so far, with an open-addressed hash table to look them up in, since comparing a new set with
+		// every one of them makes patterns with a few hundred states take seconds to compile.
+		struct subsets
+		{
+			std::array<state_set, MaxStates> sets{};
+			std::array<bool, MaxStates> accepting{};
+			// DFA state + 1, or 0 for an empty slot.
+			std::array<std::uint32_t, MaxStates * 2> slots{};
+		};
+
+		// The empty set is the first one added, so it's the dead state, 0.
+		constexpr std::size_t find_or_add(subsets& found, const state_set& set)
+		{
+			std::uint64_t hash = 0xcbf29ce484222325u;
+			for (std::size_t w = 0; w < words; ++w)
+				hash = (hash ^ set[w]) * 0x100000001b3u;
+			std::size_t slot = static_cast<std::size_t>((hash ^ (hash >> 29)) % (MaxStates * 2));
+
+			for (; found.slots[slot] != 0; slot = (slot + 1) % (MaxStates * 2))
+			{
+				std::size_t d = found.slots[slot] - 1;
+				bool same = true;
+				for (std::size_t w = 0; w < words && same; ++w)
+					same = found.sets[d][w] == set[w];
+				if (same)
+					return d;
+			}
+			if (state_count == MaxStates)
+			{
+				too_many_states = true;
+				return 0;
+			}
+
+			// The match state is always the last one added to the NFA.
+			found.sets[state_count] = set;
+			found.accepting[state_count] = (set[(nfa_states - 1) / 64] >> ((nfa_states - 1) % 64)) & 1;
+			found.slots[slot] = static_cast<std::uint32_t>(state_count + 1);
+			return state_count++;
+		}
+	};
+
+	template <typename Pattern>
+	struct regex_dfa_size
+	{
+		static constexpr regex_dfa<Pattern, CTSTR_REGEX_MAX_STATES, 0> counted{};
+		static constexpr std::size_t value = counted.state_count;
+		static constexpr std::size_t class_count = counted.class_count;
+		static constexpr bool too_many_states = counted.too_many_states;
+	};
+
+	template <typename Pattern>
+	struct regex_storage
+	{
+		static constexpr regex_dfa<Pattern, regex_dfa_size<Pattern>::value, regex_dfa_size<Pattern>::class_count> dfa{};
+	};
+
+	template <typename Dfa>
+	constexpr std::array<bool, 256> regex_starts(const Dfa& dfa)
+	{
+		std::array<bool, 256> out{};
+		for (std::size_t b = 0; b < 256; ++b)
+			out[b] = dfa.next[dfa.start_row + dfa.byte_class[b]] != 0;
+		return out;
+	}
+
+	// Checked in order, so that a pattern that doesn't parse stops at the first error instead of going on to build a DFA.
+	template <typename Pattern>
+	constexpr bool regex_valid()
+	{
+		using error = regex_nfa_size<Pattern>;
+		static_assert(sizeof(typename sequence_type<Pattern>::type) == 1, "Regex patterns must be made of single-byte characters.");
+		static_assert(error::error != regex_error::unbalanced_parenthesis, "Regex pattern has an unmatched ( or ).");
+		static_assert(error::error != regex_error::bad_escape, "Regex pattern has an unknown or incomplete \\ escape.");
+		static_assert(error::error != regex_error::bad_class, "Regex pattern has an unterminated [ class or a backwards range in one.");
+		static_assert(error::error != regex_error::bad_repeat, "Regex pattern has a malformed {n,m}, one bigger than 1000, or two quantifiers in a row.");
+		static_assert(error::error != regex_error::nothing_to_repeat, "Regex pattern has a *, +, ? or { with nothing before it to repeat.");
+		static_assert(error::error != regex_error::unsupported, "Regex pattern uses something a DFA can't do: a backreference, lookaround, a lazy quantifier, \\b, ^ or $.");
+		return error::error == regex_error::none;
+	}
+
+	template <typename Pattern, bool Valid = regex_valid<Pattern>()>
+	struct regex_states_checked
+	{
+		static_assert(!regex_dfa_size<Pattern>::too_many_states, "Regex pattern needs more DFA states than CTSTR_REGEX_MAX_STATES.");
+		using type = regex_storage<Pattern>;
+	};
+
+	// An invalid pattern has already failed a static_assert; this just stops the DFA from being built from it as well.
+	template <typename Pattern>
+	struct regex_states_checked<Pattern, false>
+	{
+		using type = regex_storage<std::integer_sequence<char>>;
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_REGEX
+/// \brief A regular expression compiled to a DFA at compile time
+///
+/// The DFA is one flat, read-only transition table with a column for every group of bytes that the pattern treats alike,
+/// so there's nothing to set up at runtime and matching is one table lookup per byte, with no backtracking.  \c search
+/// and \c find_all take time linear in the length of the text too, however many places a match nearly starts; the worst
+/// case is a table lookup per byte for each state of the DFA.
+/// \code
+/// using order_id = ctstr::regex<string_to_type("[a-z]{3}-[0-9]+")>;
+/// if (order_id::match(input)) { ... }
+/// order_id::find_all(log_line, [](std::string_view id) { ... });
+/// \endcode
+///
+/// \c search and \c find_all find the leftmost match, and the longest one starting there, as POSIX regular expressions do
+/// (ECMAScript takes the first alternative that matches instead, so <tt>a|ab</tt> finds \c "a" in \c "ab" where this finds \c "ab").
+///
+/// \see CTSTR_REGEX for the syntax
+////////////////////////////////////////////////////////////
+template <typename Pattern>
+class regex
+{
+	static constexpr const auto& dfa = detail::regex_states_checked<Pattern>::type::dfa;
+
+	// Bytes that can be the first of a match, so that search can skip the rest without running the DFA.
+	static constexpr std::array<bool, 256> starts = detail::regex_starts(dfa);
+
+public:
+	/// Number of states in the DFA, including the one it goes to once nothing can match.
+	static constexpr std::size_t state_count = dfa.state_count;
+
+	/// True if the whole of \c str matches the pattern.
+	static bool match(std::string_view str) noexcept
+	{
+		std::size_t row = dfa.start_row;
+		for (char c : str)
+		{
+			row = dfa.next[row + dfa.byte_class[static_cast<unsigned char>(c)]];
+			if (row == 0)
+				return false;
+		}
+		return row >= dfa.first_accepting_row;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief The first match in \c str, as a view into it
+	///
+	/// \return The match, or an empty \c std::optional if there isn't one.
+	////////////////////////////////////////////////////////////
+	static std::optional<std::string_view> search(std::string_view str) noexcept
+	{
+		std::size_t position = 0, length = 0;
+		if (!search_from(str, 0, position, length))
+			return std::nullopt;
+		return str.substr(position, length);
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Calls <tt>on_match(std::string_view)</tt> for each match in \c str, from left to right
+	///
+	/// Matches don't overlap; each search starts where the last match ended.
+	///
+	/// \return The number of matches.
+	////////////////////////////////////////////////////////////
+	template <typename Callback>
+	static std::size_t find_all(std::string_view str, Callback&& on_match)
+	{
+		std::size_t count = 0, from = 0, position = 0, length = 0;
+		while (from <= str.size() && search_from(str, from, position, length))
+		{
+			on_match(str.substr(position, length));
+			++count;
+			// An empty match would be found again at the same place, so step past it.
+			from = position + (length == 0? 1 : length);
+		}
+		return count;
+	}
+
+private:
+	static constexpr std::size_t columns = dfa.class_count;
+
+	// Somewhere a match could have started, and the row of the DFA that the text since then has led to.
+	struct candidate
+	{
+		std::size_t row;
+		std::size_t start;
+	};
+
+	// How far search_from runs the DFA from one place before handing over to search_all_starts.
+	static constexpr std::size_t probe_length = 64;
+
+	// Most places a match could start are done with after a few bytes, and running the DFA from each of them in turn is
+	// the quickest way through those.  But doing that from every place could read the same bytes over and over (think
+	// "[a-z]+X" on a long run of letters), so once one runs for more than probe_length bytes without the DFA dying,
+	// search_all_starts takes over from there, which reads each byte only once.
+	static bool search_from(std::string_view str, std::size_t from, std::size_t& position, std::size_t& length) noexcept
+	{
+		const bool empty_matches = dfa.start_row >= dfa.first_accepting_row;
+		for (std::size_t i = from; i <= str.size(); ++i)
+		{
+			if (!empty_matches && (i == str.size() || !starts[static_cast<unsigned char>(str[i])]))
+				continue;
+
+			std::size_t row = dfa.start_row, longest = empty_matches? 0 : npos_length, j = i;
+			for (; j < str.size(); ++j)
+			{
+				if (j - i == probe_length)
+					return search_all_starts(str, i, position, length);
+				row = dfa.next[row + dfa.byte_class[static_cast<unsigned char>(str[j])]];
+				if (row == 0)
+					break;
+				if (row >= dfa.first_accepting_row)
+					longest = j + 1 - i;
+			}
+			if (longest != npos_length)
+			{
+				position = i;
+				length = longest;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// Follows every place a match could start at once, in one pass over the text, oldest first.  Two candidates that reach
+	// the same state will do the same from then on, so only the older (further left) one is kept, and there are never more
+	// of them than there are states.  Once one matches, nothing that started after it can be the leftmost match, so those
+	// are dropped and no more are started; the older ones carry on in case they match too, and it ends when they all die.
+	static bool search_all_starts(std::string_view str, std::size_t from, std::size_t& position, std::size_t& length) noexcept
+	{
+		const bool empty_matches = dfa.start_row >= dfa.first_accepting_row;
+		const std::size_t start_state = dfa.start_row / columns;
+		std::array<candidate, state_count> live;
+		// The step on which each state was last reached: the candidates live before reading str[i] reached theirs on step
+		// i + 1, and the ones after on step i + 2.  (Numbered from 1, so that nothing starts out looking reached.)
+		std::array<std::size_t, state_count> reached{};
+		std::size_t count = 0;
+		bool found = false;
+
+		for (std::size_t i = from;; ++i)
+		{
+			if (!found)
+			{
+				if (count == 0 && !empty_matches)
+				{
+					// Nothing's going on, so skip straight to the next byte that can start a match.
+					while (i < str.size() && !starts[static_cast<unsigned char>(str[i])])
+						++i;
+					if (i == str.size())
+						return false;
+				}
+
+				// If an older candidate is already in the start state, a new one would only ever do the same as it.
+				if (reached[start_state] != i + 1 && (empty_matches || (i < str.size() && starts[static_cast<unsigned char>(str[i])])))
+				{
+					reached[start_state] = i + 1;
+					live[count++] = { dfa.start_row, i };
+					if (empty_matches)
+					{
+						found = true;
+						position = i;
+						length = 0;
+					}
+				}
+			}
+
+			if (i == str.size() || count == 0)
+				break;
+
+			const std::size_t column = dfa.byte_class[static_cast<unsigned char>(str[i])];
+			std::size_t kept = 0;
+			for (std::size_t k = 0; k < count; ++k)
+			{
+				const std::size_t row = dfa.next[live[k].row + column];
+				if (row == 0 || reached[row / columns] == i + 2)
+					continue;
+				reached[row / columns] = i + 2;
+				live[kept++] = { row, live[k].start };
+				if (row >= dfa.first_accepting_row)
+				{
+					found = true;
+					position = live[k].start;
+					length = i + 1 - position;
+					break;
+				}
+			}
+			count = kept;
+		}
+		return found;
+	}
+
+	static constexpr std::size_t npos_length = static_cast<std::size_t>(-1);
+};
+
+}
@@ -0,0 +1,761 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Router.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_ROUTER Router
+///
+/// Matching request paths against a fixed set of route patterns like <tt>"/users/:id/posts"</tt>, with the patterns
+/// merged into one tree while your program compiles.
+///
+/// A pattern is a path starting with \c '/', split into segments at each \c '/'.  A segment written as \c :name matches any
+/// one non-empty segment and is passed to the route's handler as a parameter; any other segment has to match exactly.
+/// Paths are matched as they are, so strip the query string first, and \c "/users" and \c "/users/" are different paths.
+///
+/// When a path matches more than one route, the one with a fixed segment where the others have a parameter wins, looking
+/// from left to right: \c "/users/new" goes to <tt>"/users/new"</tt> over <tt>"/users/:id"</tt>.  Two routes that match
+/// exactly the same paths (<tt>"/users/:id"</tt> and <tt>"/users/:name"</tt>, say) are a compile error.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ROUTER
+/// \brief A route for \c router: paths matching \c Pattern go to a default-constructed \c Handler
+///
+/// \c Handler is called with the route's \c route_params, followed by whatever extra arguments were given to \c router::dispatch.
+////////////////////////////////////////////////////////////
+template <typename Pattern, typename Handler>
+struct route
+{
+	using pattern = Pattern;
+	using handler = Handler;
+};
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	enum class router_error
+	{
+		none,
+		no_leading_slash,
+		empty_parameter_name,
+		duplicate_parameter_name
+	};
+
+	constexpr std::uint32_t router_none = 0xFFFFFFFFu;
+
+	// FNV-1a, which is cheap enough to work out while looking for the '/' at the end of a segment.
+	constexpr std::uint32_t router_hash_basis = 0x811C9DC5u;
+
+	constexpr std::uint32_t router_hash_step(std::uint32_t hash, char c)
+	{
+		return (hash ^ static_cast<unsigned char>(c)) * 0x01000193u;
+	}
+
+	// Where an edge out of a node goes in the edge table.
+	constexpr std::uint32_t router_slot(std::uint32_t node, std::uint32_t hash)
+	{
+		std::uint32_t h = hash + node * 0x9E3779B9u;
+		return h ^ (h >> 16);
+	}
+
+	constexpr std::size_t router_table_size(std::size_t n)
+	{
+		std::size_t result = 1;
+		while (result < n * 2)
+			result *= 2;
+		return result;
+	}
+
+	template <typename T, T...t>
+	constexpr std::size_t router_slash_count(std::integer_sequence<T, t...>)
+	{
+		return ((t == '/'? 1 : 0) + ... + 0);
+	}
+
+	// Copied out of the sequence rather than read from data<Name> (see chars() in Algorithms.hpp for why).
+	template <typename T, T...t>
+	constexpr std::array<char, sizeof...(t) + 1> router_chars(std::integer_sequence<T, t...>)
+	{
+		return {{ static_cast<char>(t)..., '\0' }};
+	}
+
+	template <std::size_t N, typename T, T...t>
+	constexpr void router_append(std::array<char, N>& text, std::size_t& at, std::integer_sequence<T, t...>)
+	{
+		((text[at++] = static_cast<char>(t)), ...);
+	}
+
+	// Every pattern, split into segments.  Segment s is text[offset[s]] to text[offset[s] + length[s]], and route r's
+	// segments are first[r] to first[r + 1].  Equal fixed segments share a number in literal[], so that they can be grouped
+	// together without comparing them again; parameters have router_none there instead.
+	template <std::size_t Routes, std::size_t Segments, std::size_t TextSize>
+	struct router_shape
+	{
+		std::array<char, TextSize + 1> text{};
+		std::array<std::uint32_t, Segments + 1> offset{};
+		std::array<std::uint32_t, Segments + 1> length{};
+		std::array<std::uint32_t, Segments + 1> hash{};
+		std::array<std::uint32_t, Segments + 1> literal{};
+		std::array<std::uint32_t, Routes + 1> first{};
+		std::size_t literal_count = 0;
+		std::size_t max_depth = 0;
+		router_error error = router_error::none;
+
+		constexpr std::size_t depth(std::size_t route) const { return first[route + 1] - first[route]; }
+		constexpr bool is_parameter(std::size_t route, std::size_t depth) const { return literal[first[route] + depth] == router_none; }
+	};
+
+	template <typename...Patterns>
+	struct router_parsed
+	{
+		static constexpr std::size_t routes = sizeof...(Patterns);
+		static constexpr std::size_t segments = (router_slash_count(Patterns{}) + ... + 0);
+		static constexpr std::size_t text_size = (size<Patterns> + ... + 0);
+
+		using shape_type = router_shape<routes, segments, text_size>;
+
+		static constexpr shape_type parse()
+		{
+			shape_type shape{};
+			std::size_t at = 0;
+			(router_append(shape.text, at, Patterns{}), ...);
+			const std::size_t ends[] = { size<Patterns>..., 0 };
+
+			// Fixed segments seen so far, by hash, to number the equal ones the same.
+			constexpr std::size_t table_size = router_table_size(segments);
+			std::array<std::uint32_t, table_size> interned{};
+			for (auto& slot : interned)
+				slot = router_none;
+
+			std::size_t s = 0, begin = 0;
+			for (std::size_t r = 0; r < routes; ++r)
+			{
+				const std::size_t end = begin + ends[r];
+				shape.first[r] = static_cast<std::uint32_t>(s);
+				if (begin == end || shape.text[begin] != '/')
+				{
+					shape.error = router_error::no_leading_slash;
+					return shape;
+				}
+
+				for (std::size_t pos = begin + 1;; ++pos)
+				{
+					std::size_t start = pos;
+					std::uint32_t hash = router_hash_basis;
+					for (; pos < end && shape.text[pos] != '/'; ++pos)
+						hash = router_hash_step(hash, shape.text[pos]);
+
+					shape.offset[s] = static_cast<std::uint32_t>(start);
+					shape.length[s] = static_cast<std::uint32_t>(pos - start);
+					shape.hash[s] = hash;
+					if (start < pos && shape.text[start] == ':')
+					{
+						if (pos - start == 1)
+						{
+							shape.error = router_error::empty_parameter_name;
+							return shape;
+						}
+						for (std::size_t other = shape.first[r]; other < s; ++other)
+							if (shape.literal[other] == router_none && same(shape, other, s))
+							{
+								shape.error = router_error::duplicate_parameter_name;
+								return shape;
+							}
+						shape.literal[s] = router_none;
+					}
+					else
+					{
+						std::size_t slot = hash & (table_size - 1);
+						while (interned[slot] != router_none && !same(shape, interned[slot], s))
+							slot = (slot + 1) & (table_size - 1);
+						if (interned[slot] == router_none)
+						{
+							interned[slot] = static_cast<std::uint32_t>(s);
+							shape.literal[s] = static_cast<std::uint32_t>(shape.literal_count++);
+						}
+						else
+							shape.literal[s] = shape.literal[interned[slot]];
+					}
+					++s;
+
+					if (pos == end)
+						break;
+				}
+
+				if (s - shape.first[r] > shape.max_depth)
+					shape.max_depth = s - shape.first[r];
+				begin = end;
+			}
+			shape.first[routes] = static_cast<std::uint32_t>(s);
+			return shape;
+		}
+
+		static constexpr bool same(const shape_type& shape, std::size_t a, std::size_t b)
+		{
+			if (shape.length[a] != shape.length[b])
+				return false;
+			for (std::size_t i = 0; i < shape.length[a]; ++i)
+				if (shape.text[shape.offset[a] + i] != shape.text[shape.offset[b] + i])
+					return false;
+			return true;
+		}
+
+		static constexpr shape_type value = parse();
+	};
+
+	struct router_node
+	{
+		std::uint32_t parameter_child;  // Where a segment that isn't one of the node's edges goes, or router_none
+		std::uint32_t route;            // The route that a path ending here matches, or router_none
+	};
+
+	struct router_edge
+	{
+		std::uint32_t node;    // router_none for an empty slot
+		std::uint32_t hash;
+		std::uint32_t offset;  // Of the segment, in router_shape::text
+		std::uint32_t length;
+		std::uint32_t child;
+	};
+
+	// The routes merged into a tree with a node for each set of routes that a path can still match after so many segments.
+	// A fixed segment's edge also takes the routes with a parameter there (unless the segment is empty, which a parameter
+	// can't be), so a path never has to go back and try the parameter instead, and matching is one step per segment.
+	//
+	// With Nodes 0 only the numbers of nodes and edges come out, which is what sizes the tables the second time around.
+	//
+	// Edges out of every node are in one open-addressed table, keyed on the node and the hash of the segment.
+	template <std::size_t Nodes, std::size_t TableSize, typename...Patterns>
+	struct router_tree
+	{
+		static constexpr std::size_t routes = sizeof...(Patterns);
+		static constexpr const auto& parsed = router_parsed<Patterns...>::value;
+		using shape_type = typename router_parsed<Patterns...>::shape_type;
+		static constexpr bool store = Nodes > 0;
+
+		std::array<router_node, store? Nodes : 1> nodes{};
+		std::array<router_edge, store? TableSize : 1> edges{};
+		std::size_t node_count = 0;
+		std::size_t edge_count = 0;
+
+		// The first two routes found that match exactly the same paths, if any.
+		bool conflict = false;
+		std::size_t conflict_first = 0, conflict_second = 0;
+
+		constexpr router_tree()
+		{
+			static_assert(routes < 0x10000, "A router can have at most 65535 routes.");
+			for (auto& edge : edges)
+				edge.node = router_none;
+
+			// Read through one local copy, since GCC copies the whole of a constexpr variable every time a constant
+			// expression reads from it (see chars() in Algorithms.hpp).
+			const shape_type shape = parsed;
+			if (shape.error != router_error::none)
+				return;
+			scratch work{};
+			for (std::size_t r = 0; r < routes; ++r)
+				work.lists[r] = static_cast<std::uint16_t>(r);
+			build(shape, work, routes, 0);
+		}
+
+	private:
+		// The routes still in play at each depth, and the fixed segments that come next, so that each node doesn't need
+		// arrays of its own (which a constant expression would have to fill with zeroes every time).
+		struct scratch
+		{
+			std::array<std::uint16_t, routes * (parsed.max_depth + 2) + 1> lists;
+			std::array<std::uint32_t, routes * (parsed.max_depth + 1) + 1> next;
+			std::array<bool, parsed.literal_count + 1> seen;
+		};
+
+		// Which of two routes a path matching both should go to: the one with a fixed segment where the other has
+		// a parameter, looking from the left.  Returns router_none if they match the same paths.
+		static constexpr std::size_t more_specific(const shape_type& shape, std::size_t a, std::size_t b)
+		{
+			for (std::size_t d = 0; d < shape.depth(a); ++d)
+				if (shape.is_parameter(a, d) != shape.is_parameter(b, d))
+					return shape.is_parameter(a, d)? b : a;
+			return router_none;
+		}
+
+		// Makes the node for the count routes at work.lists[depth * routes], and everything under it.
+		constexpr std::uint32_t build(const shape_type& shape, scratch& work, std::size_t count, std::size_t depth)
+		{
+			const std::uint32_t node = static_cast<std::uint32_t>(node_count++);
+			const std::uint16_t* list = work.lists.data() + depth * routes;
+			std::uint16_t* sublist = work.lists.data() + (depth + 1) * routes;
+			std::uint32_t* next = work.next.data() + depth * routes;
+
+			std::uint32_t route = router_none;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (shape.depth(list[i]) != depth)
+					continue;
+				if (route == router_none)
+					route = list[i];
+				else if (more_specific(shape, route, list[i]) == router_none)
+				{
+					if (!conflict)
+					{
+						conflict = true;
+						conflict_first = route;
+						conflict_second = list[i];
+					}
+				}
+				else
+					route = static_cast<std::uint32_t>(more_specific(shape, route, list[i]));
+			}
+
+			// The different fixed segments that come next, by the first segment with each one.
+			std::size_t next_count = 0;
+			bool any_parameter = false;
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				if (shape.depth(list[i]) <= depth)
+					continue;
+				const std::uint32_t s = shape.first[list[i]] + static_cast<std::uint32_t>(depth);
+				if (shape.literal[s] == router_none)
+					any_parameter = true;
+				else if (!work.seen[shape.literal[s]])
+				{
+					work.seen[shape.literal[s]] = true;
+					next[next_count++] = s;
+				}
+			}
+			for (std::size_t i = 0; i < next_count; ++i)
+				work.seen[shape.literal[next[i]]] = false;
+
+			for (std::size_t i = 0; i < next_count; ++i)
+			{
+				const bool empty = shape.length[next[i]] == 0;
+				std::size_t sub_count = 0;
+				for (std::size_t j = 0; j < count; ++j)
+					if (shape.depth(list[j]) > depth)
+					{
+						const std::uint32_t literal = shape.literal[shape.first[list[j]] + depth];
+						if ((literal == router_none && !empty) || literal == shape.literal[next[i]])
+							sublist[sub_count++] = list[j];
+					}
+				add_edge(shape, node, next[i], build(shape, work, sub_count, depth + 1));
+			}
+
+			std::uint32_t parameter_child = router_none;
+			if (any_parameter)
+			{
+				std::size_t sub_count = 0;
+				for (std::size_t j = 0; j < count; ++j)
+					if (shape.depth(list[j]) > depth && shape.is_parameter(list[j], depth))
+						sublist[sub_count++] = list[j];
+				parameter_child = build(shape, work, sub_count, depth + 1);
+			}
+
+			if constexpr (store)
+				nodes[node] = router_node{ parameter_child, route };
+			return node;
+		}
+
+		constexpr void add_edge(const shape_type& shape, std::uint32_t node, std::uint32_t segment, std::uint32_t child)
+		{
+			++edge_count;
+			if constexpr (store)
+			{
+				std::size_t slot = router_slot(node, shape.hash[segment]) & (TableSize - 1);
+				while (edges[slot].node != router_none)
+					slot = (slot + 1) & (TableSize - 1);
+				edges[slot] = router_edge{ node, shape.hash[segment], shape.offset[segment], shape.length[segment], child };
+			}
+		}
+	};
+
+	template <typename...Patterns>
+	struct router_tree_size
+	{
+		static constexpr router_tree<0, 0, Patterns...> counted{};
+		static constexpr std::size_t nodes = counted.node_count;
+		static constexpr std::size_t table_size = router_table_size(counted.edge_count);
+		static constexpr bool conflict = counted.conflict;
+		static constexpr std::size_t conflict_first = counted.conflict_first;
+		static constexpr std::size_t conflict_second = counted.conflict_second;
+	};
+
+	template <typename...Patterns>
+	struct router_storage
+	{
+		static constexpr router_tree<router_tree_size<Patterns...>::nodes, router_tree_size<Patterns...>::table_size, Patterns...> tree{};
+	};
+
+	// Instantiated only when two routes match the same paths, so that the indices of the two routes show up in the error.
+	template <std::size_t First, std::size_t Second>
+	struct router_conflict
+	{
+		static_assert(First == Second, "Two routes match exactly the same paths (see router_conflict<first, second> for which two, counting from 0).");
+	};
+
+	template <typename...Patterns>
+	constexpr bool router_valid()
+	{
+		using parsed = router_parsed<Patterns...>;
+		static_assert((std::is_same<typename sequence_type<Patterns>::type, char>::value && ...), "Route patterns must be char strings.");
+		static_assert(parsed::value.error != router_error::no_leading_slash, "Route patterns must start with '/'.");
+		static_assert(parsed::value.error != router_error::empty_parameter_name, "Route pattern has a ':' with no parameter name after it.");
+		static_assert(parsed::value.error != router_error::duplicate_parameter_name, "Route pattern has two parameters with the same name.");
+		return parsed::value.error == router_error::none;
+	}
+
+	template <bool Valid, typename...Patterns>
+	struct router_checked
+	{
+		static_assert(sizeof(router_conflict<router_tree_size<Patterns...>::conflict_first, router_tree_size<Patterns...>::conflict_second>) > 0, "Two routes match exactly the same paths.");
+		using type = router_storage<Patterns...>;
+	};
+
+	// An invalid pattern has already failed a static_assert; this just stops the tree from being built from it as well.
+	template <typename...Patterns>
+	struct router_checked<false, Patterns...>
+	{
+		using type = router_storage<>;
+	};
+
+	// Folding | over these works out the common type of any number of types, where std::common_type would nest an
+	// instantiation for each one and run out of depth with a few hundred routes.
+	template <typename T>
+	struct router_common
+	{
+		using type = T;
+	};
+
+	template <typename A, typename B>
+	router_common<std::common_type_t<A, B>> operator|(router_common<A>, router_common<B>);
+
+	// Which segments of Pattern are parameters, in order, and what they're called.
+	template <typename Pattern>
+	struct router_parameters
+	{
+		using parsed = router_parsed<Pattern>;
+
+		static constexpr std::size_t count()
+		{
+			std::size_t n = 0;
+			for (std::size_t d = 0; d < parsed::value.depth(0); ++d)
+				n += parsed::value.is_parameter(0, d)? 1 : 0;
+			return n;
+		}
+
+		static constexpr std::array<std::uint8_t, count() + 1> depths()
+		{
+			std::array<std::uint8_t, count() + 1> out{};
+			std::size_t n = 0;
+			for (std::size_t d = 0; d < parsed::value.depth(0); ++d)
+				if (parsed::value.is_parameter(0, d))
+					out[n++] = static_cast<std::uint8_t>(d);
+			return out;
+		}
+
+		template <typename Name>
+		static constexpr std::size_t index()
+		{
+			const auto text = parsed::value.text;
+			const auto wanted = router_chars(Name{});
+			std::size_t n = 0;
+			for (std::size_t d = 0; d < parsed::value.depth(0); ++d)
+			{
+				if (!parsed::value.is_parameter(0, d))
+					continue;
+				const std::size_t offset = parsed::value.offset[d] + 1, length = parsed::value.length[d] - 1;
+				bool equal = length == size<Name>;
+				for (std::size_t i = 0; equal && i < length; ++i)
+					equal = text[offset + i] == wanted[i];
+				if (equal)
+					return n;
+				++n;
+			}
+			return n;
+		}
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ROUTER
+/// \brief The parameters of a path that matched \c Pattern, as views into the path
+///
+/// \see get()
+////////////////////////////////////////////////////////////
+template <typename Pattern>
+class route_params
+{
+	using parameters = detail::router_parameters<Pattern>;
+
+	static constexpr auto depths = parameters::depths();
+
+public:
+	/// Number of parameters in \c Pattern.
+	static constexpr std::size_t size() noexcept { return parameters::count(); }
+
+	/// Every parameter empty.
+	route_params() = default;
+
+	/// The parameters out of a path's segments, in order.
+	explicit route_params(const std::string_view* segments) noexcept
+	{
+		for (std::size_t i = 0; i < size(); ++i)
+			values[i] = segments[depths[i]];
+	}
+
+	/// The parameter written as \c :Name in the pattern.  \see ctstr::get()
+	template <typename Name>
+	std::string_view get() const noexcept
+	{
+		constexpr std::size_t i = parameters::template index<Name>();
+		static_assert(i < size(), "The route has no parameter with this name.");
+		return values[i];
+	}
+
+	/// The <tt>i</tt>th parameter, counting from the left.
+	std::string_view operator[](std::size_t i) const noexcept { return values[i]; }
+
+private:
+	std::array<std::string_view, parameters::count()> values{};
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ROUTER
+/// \brief The parameter written as \c :Name in the route's pattern
+////////////////////////////////////////////////////////////
+template <typename Name, typename Pattern>
+std::string_view get(const route_params<Pattern>& params) noexcept
+{
+	return params.template get<Name>();
+}
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	template <typename Route, typename...Args>
+	using router_result_t = decltype(std::declval<typename Route::handler&>()(std::declval<const route_params<typename Route::pattern>&>(), std::declval<Args>()...));
+
+	// A free function rather than a member of router, so that its name doesn't spell out every route.
+	template <typename Route, typename Result, typename...Args>
+	Result router_call(const std::string_view* segments, Args&&...args)
+	{
+		typename Route::handler handler{};
+		return static_cast<Result>(handler(route_params<typename Route::pattern>(segments), std::forward<Args>(args)...));
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_ROUTER
+/// \brief Sends request paths to the handler of whichever of \c Routes they match
+///
+/// The routes are merged at compile time into a tree of path segments, whose edges all live in one flat hash table, so
+/// matching is a single pass over the path: each segment is hashed while looking for the \c '/' after it, then followed
+/// with one table lookup and one comparison.  That costs the same with 500 routes as with 5, and parameters come out as
+/// views into the path, so nothing is allocated.
+/// \code
+/// struct show_post
+/// {
+///     template <typename Params>
+///     response operator()(const Params& params, const request& req) const
+///     {
+///         return load_post(ctstr::get<string_to_type("user")>(params), ctstr::get<string_to_type("post")>(params));
+///     }
+/// };
+///
+/// using routes = ctstr::router<
+///     ctstr::route<string_to_type("/users/:user"), show_user>,
+///     ctstr::route<string_to_type("/users/:user/posts/:post"), show_post>>;
+///
+/// response r = routes::dispatch(req.path, [] { return not_found(); }, req);
+/// \endcode
+///
+/// \see CTSTR_ROUTER for the pattern syntax and which route wins when a path matches more than one
+////////////////////////////////////////////////////////////
+template <typename...Routes>
+class router
+{
+	static constexpr bool valid = detail::router_valid<typename Routes::pattern...>();
+	static constexpr const auto& tree = detail::router_checked<valid, typename Routes::pattern...>::type::tree;
+	static constexpr const auto& shape = std::remove_reference_t<decltype(tree)>::parsed;
+
+	// Segments in the longest pattern; a path with more can't match anything.
+	static constexpr std::size_t max_depth = shape.max_depth;
+
+	static constexpr std::size_t max_parameters()
+	{
+		std::size_t result = 0;
+		for (std::size_t r = 0; r < sizeof...(Routes); ++r)
+		{
+			std::size_t n = 0;
+			for (std::size_t d = 0; d < shape.depth(r); ++d)
+				n += shape.is_parameter(r, d)? 1 : 0;
+			result = n > result? n : result;
+		}
+		return result;
+	}
+
+public:
+	/// Number of routes.
+	static constexpr std::size_t route_count = sizeof...(Routes);
+
+	/// Number of nodes in the tree that the routes were merged into.
+	static constexpr std::size_t node_count = tree.node_count;
+
+	/// What \c match found.
+	struct match_result
+	{
+		/// Which of \c Routes the path matched, counting from 0, or \c route_count if it didn't match any.
+		std::size_t route = route_count;
+
+		/// The matching route's parameters, from left to right; the rest are empty.
+		std::array<std::string_view, max_parameters()> parameters{};
+
+		/// True if the path matched a route.
+		explicit operator bool() const noexcept { return route != route_count; }
+	};
+
+	/// Which route \c path goes to, and its parameters.
+	static match_result match(std::string_view path) noexcept
+	{
+		std::array<std::string_view, max_depth + 1> segments;
+		match_result result;
+		result.route = find(path, segments.data());
+		if (result.route != route_count)
+		{
+			std::size_t n = 0;
+			for (std::size_t d = 0; d < shape.depth(result.route); ++d)
+				if (shape.is_parameter(result.route, d))
+					result.parameters[n++] = segments[d];
+		}
+		return result;
+	}
+
+	////////////////////////////////////////////////////////////
+	/// \brief Calls the handler of the route that \c path goes to
+	///
+	/// \param path The path to match, without the query string
+	/// \param on_miss Called with no arguments if \c path doesn't match any route
+	/// \param args Passed to the handler after its \c route_params
+	///
+	/// \return Whatever the handler or \c on_miss returned, converted to the common type of all their results
+	////////////////////////////////////////////////////////////
+	template <typename Miss, typename...Args>
+	static decltype(auto) dispatch(std::string_view path, Miss&& on_miss, Args&&...args)
+	{
+		using result_type = typename decltype((detail::router_common<decltype(std::declval<Miss&>()())>{} | ... | detail::router_common<detail::router_result_t<Routes, Args...>>{}))::type;
+		using thunk = result_type (*)(const std::string_view*, Args&&...);
+		static constexpr thunk thunks[sizeof...(Routes) + 1] = { &detail::router_call<Routes, result_type, Args...>..., nullptr };
+
+		std::array<std::string_view, max_depth + 1> segments;
+		std::size_t r = find(path, segments.data());
+		if (r == route_count)
+			return static_cast<result_type>(on_miss());
+		return static_cast<result_type>(thunks[r](segments.data(), std::forward<Args>(args)...));
+	}
+
+private:
+	// Walks the tree one segment at a time, keeping each segment in segments[], and returns the route that the path
+	// ended up at, or route_count.
+	static std::size_t find(std::string_view path, std::string_view* segments) noexcept
+	{
+		if (path.empty() || path[0] != '/')
+			return route_count;
+
+		std::uint32_t node = 0;
+		std::size_t depth = 0;
+		for (std::size_t pos = 1;; ++pos)
+		{
+			if (depth == max_depth)
+				return route_count;
+
+			const std::size_t start = pos;
+			std::uint32_t hash = detail::router_hash_basis;
+			for (; pos < path.size() && path[pos] != '/'; ++pos)
+				hash = detail::router_hash_step(hash, path[pos]);
+			const std::string_view segment(path.data() + start, pos - start);
+			segments[depth++] = segment;
+
+			std::uint32_t next = edge(node, hash, segment);
+			if (next == detail::router_none && !segment.empty())
+				next = tree.nodes[node].parameter_child;
+			if (next == detail::router_none)
+				return route_count;
+			node = next;
+
+			if (pos == path.size())
+				break;
+		}
+
+		const std::uint32_t route = tree.nodes[node].route;
+		return route == detail::router_none? route_count : route;
+	}
+
+	static std::uint32_t edge(std::uint32_t node, std::uint32_t hash, std::string_view segment) noexcept
+	{
+		constexpr std::size_t mask = tree.edges.size() - 1;
+		for (std::size_t slot = detail::router_slot(node, hash) & mask;; slot = (slot + 1) & mask)
+		{
+			const detail::router_edge& e = tree.edges[slot];
+			if (e.node == detail::router_none)
+				return detail::router_none;
+			if (e.node == node && e.hash == hash && e.length == segment.size()
+			    && std::memcmp(shape.text.data() + e.offset, segment.data(), segment.size()) == 0)
+				return e.child;
+		}
+	}
+};
+
+}
@@ -0,0 +1,300 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Scanner.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_SCANNER Scanner
+///
+/// Finding every occurrence of a fixed set of strings in a buffer, in one pass.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	template <std::size_t States>
+	using scanner_state_t = std::conditional_t<(States <= 0x100), std::uint8_t, std::conditional_t<(States <= 0x10000), std::uint16_t, std::uint32_t>>;
+
+	// Bytes that don't appear in any pattern all behave the same, so they share class 0.
+	// Every byte that does appear gets its own class, which keeps the transition table narrow.
+	template <typename...Patterns>
+	constexpr std::array<std::uint8_t, 256> scanner_byte_classes()
+	{
+		std::array<bool, 256> used{};
+		static_cast<void>((... , [&] {
+			for (std::size_t i = 0; i < size<Patterns>; ++i)
+				used[static_cast<unsigned char>(data<Patterns>[i])] = true;
+		}()));
+
+		// If every byte is used there's no need for the shared class, and starting at 0 keeps the classes within a byte.
+		std::size_t next = 0;
+		for (bool u : used)
+			next += u;
+		next = next == 256? 0 : 1;
+
+		std::array<std::uint8_t, 256> classes{};
+		for (std::size_t b = 0; b < 256; ++b)
+			if (used[b])
+				classes[b] = static_cast<std::uint8_t>(next++);
+		return classes;
+	}
+
+	template <typename...Patterns>
+	constexpr std::size_t scanner_class_count()
+	{
+		std::size_t count = 1;
+		for (std::uint8_t c : scanner_byte_classes<Patterns...>())
+			count = c >= count? c + 1u : count;
+		return count;
+	}
+
+	// An Aho-Corasick automaton, fully expanded into a DFA so scanning never follows failure links.
+	//
+	// Two tricks keep the scanning loop short.  Transitions are stored as row offsets (state * class_count)
+	// rather than state numbers, so there's no multiply on the critical path.  And states are renumbered so
+	// that every state where a pattern ends comes after all the ones where nothing does, so checking for
+	// a match is a comparison with a constant instead of another table lookup.
+	template <typename...Patterns>
+	struct scanner_automaton
+	{
+		static constexpr std::size_t pattern_count = sizeof...(Patterns);
+		static constexpr std::size_t max_states = (1 + ... + size<Patterns>);
+		static constexpr std::size_t class_count = scanner_class_count<Patterns...>();
+		static constexpr std::uint32_t no_pattern = 0xFFFFFFFFu;
+		using row_type = scanner_state_t<max_states * class_count>;
+
+		std::array<std::uint8_t, 256> byte_class{};
+		std::array<row_type, max_states * class_count> next{};
+		// Rows at or past this one belong to states where at least one pattern ends.
+		std::size_t first_output_row = 0;
+		// The longest pattern ending at each state, or no_pattern.
+		std::array<std::uint32_t, max_states> pattern{};
+		// From a state where a pattern ends, the next state (following failure links) where a shorter one does, or 0 for none.
+		std::array<std::uint32_t, max_states> next_output{};
+		std::array<std::size_t, pattern_count + 1> lengths{ { size<Patterns>..., 0 } };
+		bool duplicate_patterns = false;
+
+		constexpr scanner_automaton()
+		{
+			byte_class = scanner_byte_classes<Patterns...>();
+
+			// Build the trie.  State 0 is the root, so 0 doubles as "no transition yet" (nothing can go back to the root in a trie).
+			std::array<std::uint32_t, max_states * class_count> trie{};
+			std::array<std::uint32_t, max_states> ends{};
+			for (std::size_t s = 0; s < max_states; ++s)
+				ends[s] = no_pattern;
+			std::size_t state_count = 1;
+			std::uint32_t index = 0;
+			static_cast<void>((... , insert(trie, ends, state_count, data<Patterns>, size<Patterns>, index++)));
+
+			// Breadth-first, fill in failure transitions and find each state's nearest output state.
+			std::array<std::uint32_t, max_states> fail{};
+			std::array<std::uint32_t, max_states> output{};
+			std::array<std::uint32_t, max_states> shorter{};
+			std::array<std::uint32_t, max_states> queue{};
+			std::size_t head = 0, tail = 0;
+			for (std::size_t c = 0; c < class_count; ++c)
+				if (trie[c] != 0)
+					queue[tail++] = trie[c];
+			while (head < tail)
+			{
+				std::uint32_t u = queue[head++];
+				shorter[u] = output[fail[u]];
+				output[u] = ends[u] != no_pattern? u : shorter[u];
+				for (std::size_t c = 0; c < class_count; ++c)
+				{
+					std::uint32_t v = trie[u * class_count + c];
+					if (v != 0)
+					{
+						fail[v] = trie[fail[u] * class_count + c];
+						queue[tail++] = v;
+					}
+					else
+						trie[u * class_count + c] = trie[fail[u] * class_count + c];
+				}
+			}
+
+			// Renumber: states with no output first (the root stays 0), then the rest.
+			std::array<std::uint32_t, max_states> renumbered{};
+			std::uint32_t count = 0;
+			for (std::size_t pass = 0; pass < 2; ++pass)
+			{
+				if (pass == 1)
+					first_output_row = count * class_count;
+				for (std::size_t s = 0; s < state_count; ++s)
+					if ((output[s] != 0) == (pass == 1))
+						renumbered[s] = count++;
+			}
+
+			for (std::size_t s = 0; s < max_states; ++s)
+				pattern[s] = no_pattern;
+			for (std::size_t s = 0; s < state_count; ++s)
+			{
+				std::uint32_t id = renumbered[s];
+				for (std::size_t c = 0; c < class_count; ++c)
+					next[id * class_count + c] = static_cast<row_type>(renumbered[trie[s * class_count + c]] * class_count);
+				if (output[s] != 0)
+				{
+					// A state where only shorter patterns end still reports those, starting from the longest.
+					pattern[id] = ends[output[s]];
+					next_output[id] = shorter[output[s]] != 0? renumbered[shorter[output[s]]] : 0;
+				}
+			}
+		}
+
+		template <typename CharType>
+		constexpr void insert(std::array<std::uint32_t, max_states * class_count>& trie, std::array<std::uint32_t, max_states>& ends, std::size_t& state_count,
+		                      const CharType* str, std::size_t length, std::uint32_t index)
+		{
+			std::size_t state = 0;
+			for (std::size_t i = 0; i < length; ++i)
+			{
+				std::size_t slot = state * class_count + byte_class[static_cast<unsigned char>(str[i])];
+				if (trie[slot] == 0)
+					trie[slot] = static_cast<std::uint32_t>(state_count++);
+				state = trie[slot];
+			}
+			if (ends[state] != no_pattern)
+				duplicate_patterns = true;
+			ends[state] = index;
+		}
+	};
+
+	template <typename...Patterns>
+	struct scanner_storage
+	{
+		static constexpr scanner_automaton<Patterns...> automaton{};
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SCANNER
+/// \brief Finds every occurrence of any of \c Patterns in a stream of bytes
+///
+/// The Aho-Corasick automaton for the patterns is built at compile time and stored as one flat,
+/// read-only transition table (rows are states, columns are the bytes that appear in the patterns),
+/// so scanning is a single table lookup per input byte.
+///
+/// The input can be fed in as many pieces as you like; matches that straddle two pieces are still found.
+/// \code
+/// ctstr::scanner<string_to_type("ERROR"), string_to_type("WARN")> scanner;
+/// for (auto chunk : chunks)
+///     scanner.feed(chunk.data(), chunk.size(), [](std::size_t pattern, std::uint64_t offset) { ... });
+/// \endcode
+///
+/// Overlapping matches are all reported, in the order in which they end; matches that end at the same byte are reported longest first.
+////////////////////////////////////////////////////////////
+template <typename...Patterns>
+class scanner
+{
+	using automaton_type = detail::scanner_automaton<Patterns...>;
+	static constexpr const automaton_type& automaton = detail::scanner_storage<Patterns...>::automaton;
+
+	static_assert(sizeof...(Patterns) > 0, "A scanner needs at least one pattern.");
+	static_assert(((sizeof(typename sequence_type<Patterns>::type) == 1) && ...), "Scanner patterns must be made of single-byte characters.");
+	static_assert(((size<Patterns> > 0) && ...), "Scanner patterns can't be empty.");
+	static_assert(!automaton.duplicate_patterns, "The same pattern was given to the scanner more than once.");
+
+public:
+	/// Number of patterns being searched for.
+	static constexpr std::size_t pattern_count = sizeof...(Patterns);
+
+	////////////////////////////////////////////////////////////
+	/// \brief Scans the next \c length bytes of the stream
+	///
+	/// \param on_match Called as <tt>on_match(pattern, offset)</tt> for each match, where \c pattern is the index
+	/// of the pattern in \c Patterns and \c offset is where the match starts, counted from the beginning of the stream.
+	////////////////////////////////////////////////////////////
+	template <typename Callback>
+	void feed(const void* data, std::size_t length, Callback&& on_match)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		std::size_t row = m_row;
+		for (std::size_t i = 0; i < length; ++i)
+		{
+			row = automaton.next[row + automaton.byte_class[bytes[i]]];
+			if (row >= automaton.first_output_row)
+				report(row / automaton_type::class_count, m_position + i + 1, on_match);
+		}
+		m_row = static_cast<typename automaton_type::row_type>(row);
+		m_position += length;
+	}
+
+	/// Forgets any partial match and starts counting offsets from 0 again.
+	void reset()
+	{
+		m_row = 0;
+		m_position = 0;
+	}
+
+	/// Scans a complete buffer in one go.
+	template <typename Callback>
+	static void scan(const void* data, std::size_t length, Callback&& on_match)
+	{
+		scanner s;
+		s.feed(data, length, on_match);
+	}
+
+private:
+	template <typename Callback>
+	static void report(std::size_t state, std::uint64_t end, Callback& on_match)
+	{
+		// Matches are rare, so keep this out of the scanning loop.
+		do
+		{
+			std::uint32_t pattern = automaton.pattern[state];
+			on_match(static_cast<std::size_t>(pattern), end - automaton.lengths[pattern]);
+			state = automaton.next_output[state];
+		} while (state != 0);
+	}
+
+	typename automaton_type::row_type m_row = 0;
+	std::uint64_t m_position = 0;
+};
+
+}
@@ -0,0 +1,730 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Algorithms.hpp"
+#include "Dispatch.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Serialize.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_SERIALIZE Serialization
+///
+/// Writing structs as JSON or CSV, and reading them back from JSON, with the field names as \c string_to_type strings.
+///
+/// \code
+/// struct point { int x; int y; std::string label; };
+///
+/// template <>
+/// struct ctstr::fields_of<point> : ctstr::fields<
+///     ctstr::field<string_to_type("x"), &point::x>,
+///     ctstr::field<string_to_type("y"), &point::y>,
+///     ctstr::field<string_to_type("label"), &point::label>> {};
+///
+/// std::string out;
+/// ctstr::write_json(out, point{ 1, 2, "A" });   // {"x":1,"y":2,"label":"A"}
+/// ctstr::write_csv_header<point>(out);          // x,y,label
+/// ctstr::write_csv(out, point{ 1, 2, "A" });    // 1,2,A
+/// \endcode
+///
+/// Everything between the values (<tt>{"x":</tt>, <tt>,"y":</tt>, the CSV header and so on) is escaped and put together at
+/// compile time, so writing a struct is one \c append of a constant string per field plus writing the values.
+/// Reading matches each key with \c ctstr::dispatch, so it costs one hash no matter how many fields there are.
+///
+/// Fields can be \c bool, \c char (a string of one character), any other integer or floating point type, \c std::string,
+/// \c std::string_view or any struct that has \c fields_of itself (JSON only).  Floating point values are written in
+/// shortest round-trip form, and as \c null if they're infinite or NaN.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SERIALIZE
+/// \brief A field called \c SeqType, stored in the data member \c Member
+////////////////////////////////////////////////////////////
+template <typename SeqType, auto Member>
+struct field
+{
+	static_assert(std::is_same<typename sequence_type<SeqType>::type, char>::value, "Field names must be strings of char.");
+	static_assert(std::is_member_object_pointer<decltype(Member)>::value, "A field must be a pointer to a data member.");
+
+	using key = SeqType;
+	static constexpr auto member = Member;
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SERIALIZE
+/// \brief The fields of a struct, in the order they're written
+////////////////////////////////////////////////////////////
+template <typename...Fields>
+struct fields
+{
+	using field_list = fields;
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SERIALIZE
+/// \brief Specialize this, deriving from \c fields, to make a struct serializable
+////////////////////////////////////////////////////////////
+template <typename T>
+struct fields_of {};
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	template <typename T, typename = void>
+	struct has_fields : std::false_type {};
+
+	template <typename T>
+	struct has_fields<T, std::void_t<typename fields_of<T>::field_list>> : std::true_type {};
+
+	template <typename T>
+	struct unsupported_field : std::false_type {};
+
+	// How many characters c becomes in a JSON string, and (if out isn't null) those characters.
+	constexpr std::size_t json_escape(unsigned char c, char* out)
+	{
+		char short_form = c == '"'? '"' : c == '\\'? '\\' : c == '\n'? 'n' : c == '\r'? 'r' : c == '\t'? 't' : c == '\b'? 'b' : c == '\f'? 'f' : 0;
+		if (short_form)
+		{
+			if (out)
+			{
+				out[0] = '\\';
+				out[1] = short_form;
+			}
+			return 2;
+		}
+		if (c < 0x20)
+		{
+			if (out)
+			{
+				const char digits[] = "0123456789abcdef";
+				out[0] = '\\'; out[1] = 'u'; out[2] = '0'; out[3] = '0';
+				out[4] = digits[c >> 4];
+				out[5] = digits[c & 0xF];
+			}
+			return 6;
+		}
+		if (out)
+			out[0] = static_cast<char>(c);
+		return 1;
+	}
+
+	constexpr bool csv_needs_quotes(std::string_view str)
+	{
+		for (char c : str)
+			if (c == ',' || c == '"' || c == '\n' || c == '\r')
+				return true;
+		return false;
+	}
+
+	// The text that goes before each value: <tt>{"key":</tt> for the first field, and <tt>,"key":</tt> for the others.
+	template <bool First, typename Key>
+	struct json_key_fragment
+	{
+		static constexpr std::size_t length()
+		{
+			const auto key = chars(Key{});
+			std::size_t n = 4;
+			for (std::size_t i = 0; i < size<Key>; ++i)
+				n += json_escape(static_cast<unsigned char>(key[i]), nullptr);
+			return n;
+		}
+
+		static constexpr std::array<char, length()> make()
+		{
+			const auto key = chars(Key{});
+			std::array<char, length()> out{};
+			std::size_t o = 0;
+			out[o++] = First? '{' : ',';
+			out[o++] = '"';
+			for (std::size_t i = 0; i < size<Key>; ++i)
+				o += json_escape(static_cast<unsigned char>(key[i]), out.data() + o);
+			out[o++] = '"';
+			out[o++] = ':';
+			return out;
+		}
+
+		static constexpr auto value = make();
+		using type = array_to_sequence_t<char, json_key_fragment>;
+	};
+
+	// The whole header row, with names quoted where CSV needs them to be.
+	template <typename...Keys>
+	struct csv_header
+	{
+		static constexpr std::size_t length()
+		{
+			std::size_t n = 0;
+			auto add = [&](auto key) {
+				const auto str = chars(key);
+				std::string_view name(str.data(), key.size());
+				n += name.size() + 1;
+				if (csv_needs_quotes(name))
+				{
+					n += 2;
+					for (char c : name)
+						n += c == '"';
+				}
+			};
+			(add(Keys{}), ...);
+			return n == 0? 1 : n;
+		}
+
+		static constexpr std::array<char, length()> make()
+		{
+			std::array<char, length()> out{};
+			std::size_t o = 0;
+			auto add = [&](auto key) {
+				const auto str = chars(key);
+				std::string_view name(str.data(), key.size());
+				bool quoted = csv_needs_quotes(name);
+				if (o != 0)
+					out[o++] = ',';
+				if (quoted)
+					out[o++] = '"';
+				for (char c : name)
+				{
+					if (c == '"')
+						out[o++] = '"';
+					out[o++] = c;
+				}
+				if (quoted)
+					out[o++] = '"';
+			};
+			(add(Keys{}), ...);
+			out[o++] = '\n';
+			return out;
+		}
+
+		static constexpr auto value = make();
+		using type = array_to_sequence_t<char, csv_header>;
+	};
+
+	template <typename SeqType>
+	void append(std::string& out, SeqType)
+	{
+		out.append(data<SeqType>, size<SeqType>);
+	}
+
+	inline void json_write_string(std::string& out, std::string_view str)
+	{
+		out += '"';
+		std::size_t start = 0;
+		for (std::size_t i = 0; i < str.size(); ++i)
+		{
+			unsigned char c = static_cast<unsigned char>(str[i]);
+			if (c >= 0x20 && c != '"' && c != '\\')
+				continue;
+			out.append(str.data() + start, i - start);
+			char escaped[6];
+			out.append(escaped, json_escape(c, escaped));
+			start = i + 1;
+		}
+		out.append(str.data() + start, str.size() - start);
+		out += '"';
+	}
+
+	inline void csv_write_string(std::string& out, std::string_view str)
+	{
+		if (!csv_needs_quotes(str))
+		{
+			out.append(str);
+			return;
+		}
+		out += '"';
+		std::size_t start = 0;
+		for (std::size_t i = 0; i < str.size(); ++i)
+		{
+			if (str[i] != '"')
+				continue;
+			// Write up to and including the quote, and start the next run with it again, so it's doubled.
+			out.append(str.data() + start, i + 1 - start);
+			start = i;
+		}
+		out.append(str.data() + start, str.size() - start);
+		out += '"';
+	}
+
+	template <typename T>
+	void write_number(std::string& out, T value)
+	{
+		char buffer[48];
+		out.append(buffer, static_cast<std::size_t>(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer));
+	}
+
+	template <typename T>
+	void json_write_value(std::string& out, const T& value);
+
+	template <typename T, typename...Fields>
+	void json_write_object(std::string& out, const T& value, fields<Fields...>)
+	{
+		if constexpr (sizeof...(Fields) == 0)
+			out.append("{}", 2);
+		else
+		{
+			std::size_t index = 0;
+			auto write = [&](auto f) {
+				using F = decltype(f);
+				if (index++ == 0)
+					append(out, typename json_key_fragment<true, typename F::key>::type{});
+				else
+					append(out, typename json_key_fragment<false, typename F::key>::type{});
+				json_write_value(out, value.*F::member);
+			};
+			(write(Fields{}), ...);
+			out += '}';
+		}
+	}
+
+	template <typename T>
+	void json_write_value(std::string& out, const T& value)
+	{
+		if constexpr (std::is_same<T, bool>::value)
+			value? out.append("true", 4) : out.append("false", 5);
+		else if constexpr (std::is_same<T, char>::value)
+			json_write_string(out, std::string_view(&value, 1));
+		else if constexpr (std::is_integral<T>::value)
+			write_number(out, value);
+		else if constexpr (std::is_floating_point<T>::value)
+		{
+			if (std::isfinite(value))
+				write_number(out, value);
+			else
+				out.append("null", 4);
+		}
+		else if constexpr (std::is_convertible<const T&, std::string_view>::value)
+			json_write_string(out, std::string_view(value));
+		else if constexpr (has_fields<T>::value)
+			json_write_object(out, value, typename fields_of<T>::field_list{});
+		else
+			static_assert(unsupported_field<T>::value, "Can't serialize a field of this type.");
+	}
+
+	template <typename T>
+	void csv_write_value(std::string& out, const T& value)
+	{
+		if constexpr (std::is_same<T, bool>::value)
+			value? out.append("true", 4) : out.append("false", 5);
+		else if constexpr (std::is_same<T, char>::value)
+			csv_write_string(out, std::string_view(&value, 1));
+		else if constexpr (std::is_arithmetic<T>::value)
+		{
+			if constexpr (std::is_floating_point<T>::value)
+				if (!std::isfinite(value))
+					return;
+			write_number(out, value);
+		}
+		else if constexpr (std::is_convertible<const T&, std::string_view>::value)
+			csv_write_string(out, std::string_view(value));
+		else
+			static_assert(unsupported_field<T>::value, "Can't write a field of this type as CSV.");
+	}
+
+	template <typename...Fields>
+	void csv_write_header(std::string& out, fields<Fields...>)
+	{
+		append(out, typename csv_header<typename Fields::key...>::type{});
+	}
+
+	template <typename T, typename...Fields>
+	void csv_write_row(std::string& out, const T& value, fields<Fields...>)
+	{
+		std::size_t index = 0;
+		auto write = [&](auto f) {
+			if (index++ != 0)
+				out += ',';
+			csv_write_value(out, value.*decltype(f)::member);
+		};
+		static_cast<void>(write);
+		(write(Fields{}), ...);
+		out += '\n';
+	}
+
+	template <typename Key, typename...Fields>
+	constexpr std::size_t field_index()
+	{
+		constexpr bool matches[] = { std::is_same<typename Fields::key, Key>::value... };
+		for (std::size_t i = 0; i < sizeof...(Fields); ++i)
+			if (matches[i])
+				return i;
+		return sizeof...(Fields);
+	}
+
+	// A JSON parser that reads straight into the fields, with no DOM in between.
+	class json_reader
+	{
+	public:
+		explicit json_reader(std::string_view in) : m_begin(in.data()), m_p(in.data()), m_end(in.data() + in.size()) {}
+
+		std::size_t position() const { return static_cast<std::size_t>(m_p - m_begin); }
+
+		void skip_space()
+		{
+			while (m_p != m_end && (*m_p == ' ' || *m_p == '\t' || *m_p == '\n' || *m_p == '\r'))
+				++m_p;
+		}
+
+		bool consume(char c)
+		{
+			skip_space();
+			if (m_p == m_end || *m_p != c)
+				return false;
+			++m_p;
+			return true;
+		}
+
+		// The string at m_p, as a view of the input if it has no escapes or of scratch if it does.
+		bool read_string(std::string_view& result, std::string& scratch)
+		{
+			if (!consume('"'))
+				return false;
+			const char* start = m_p;
+			while (m_p != m_end && *m_p != '"' && *m_p != '\\')
+				++m_p;
+			if (m_p == m_end)
+				return false;
+			if (*m_p == '"')
+			{
+				result = std::string_view(start, static_cast<std::size_t>(m_p++ - start));
+				return true;
+			}
+
+			scratch.assign(start, m_p);
+			while (m_p != m_end && *m_p != '"')
+			{
+				char c = *m_p++;
+				if (c != '\\')
+				{
+					scratch += c;
+					continue;
+				}
+				if (m_p == m_end)
+					return false;
+				switch (*m_p++)
+				{
+				case '"':  scratch += '"'; break;
+				case '\\': scratch += '\\'; break;
+				case '/':  scratch += '/'; break;
+				case 'b':  scratch += '\b'; break;
+				case 'f':  scratch += '\f'; break;
+				case 'n':  scratch += '\n'; break;
+				case 'r':  scratch += '\r'; break;
+				case 't':  scratch += '\t'; break;
+				case 'u':
+				{
+					std::uint32_t code;
+					if (!read_hex4(code))
+						return false;
+					if (code >= 0xD800 && code < 0xDC00)
+					{
+						std::uint32_t low;
+						if (m_end - m_p < 2 || m_p[0] != '\\' || m_p[1] != 'u')
+							return false;
+						m_p += 2;
+						if (!read_hex4(low) || low < 0xDC00 || low >= 0xE000)
+							return false;
+						code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+					}
+					else if (code >= 0xDC00 && code < 0xE000)
+						return false;
+					append_utf8(scratch, code);
+					break;
+				}
+				default:
+					return false;
+				}
+			}
+			if (m_p == m_end)
+				return false;
+			++m_p;
+			result = scratch;
+			return true;
+		}
+
+		// Skips over any one value, however deeply nested.
+		bool skip_value()
+		{
+			skip_space();
+			if (m_p == m_end)
+				return false;
+			if (*m_p == '"')
+			{
+				std::string_view ignored;
+				return read_string(ignored, m_scratch);
+			}
+			if (*m_p == '{' || *m_p == '[')
+			{
+				char close = *m_p++ == '{'? '}' : ']';
+				if (consume(close))
+					return true;
+				do
+				{
+					if (close == '}')
+					{
+						std::string_view ignored;
+						if (!read_string(ignored, m_scratch) || !consume(':'))
+							return false;
+					}
+					if (!skip_value())
+						return false;
+				} while (consume(','));
+				return consume(close);
+			}
+			const char* start = m_p;
+			while (m_p != m_end && *m_p != ',' && *m_p != '}' && *m_p != ']' && *m_p != ' ' && *m_p != '\t' && *m_p != '\n' && *m_p != '\r')
+				++m_p;
+			return m_p != start;
+		}
+
+		template <typename T>
+		bool read(T& value)
+		{
+			skip_space();
+			if constexpr (std::is_same<T, bool>::value)
+			{
+				if (m_end - m_p >= 4 && std::string_view(m_p, 4) == "true")
+				{
+					m_p += 4;
+					value = true;
+					return true;
+				}
+				if (m_end - m_p >= 5 && std::string_view(m_p, 5) == "false")
+				{
+					m_p += 5;
+					value = false;
+					return true;
+				}
+				return false;
+			}
+			else if constexpr (std::is_same<T, char>::value)
+			{
+				std::string_view str;
+				if (!read_string(str, m_scratch) || str.size() != 1)
+					return false;
+				value = str[0];
+				return true;
+			}
+			else if constexpr (std::is_arithmetic<T>::value)
+			{
+				if constexpr (std::is_floating_point<T>::value)
+				{
+					if (m_end - m_p >= 4 && std::string_view(m_p, 4) == "null")
+					{
+						m_p += 4;
+						value = std::numeric_limits<T>::quiet_NaN();
+						return true;
+					}
+				}
+				auto result = std::from_chars(m_p, m_end, value);
+				if (result.ec != std::errc())
+					return false;
+				m_p = result.ptr;
+				return true;
+			}
+			else if constexpr (std::is_same<T, std::string>::value)
+			{
+				std::string_view str;
+				if (!read_string(str, value))
+					return false;
+				// Only copy if it wasn't unescaped into value already.
+				if (str.data() != value.data())
+					value.assign(str.data(), str.size());
+				return true;
+			}
+			else if constexpr (std::is_same<T, std::string_view>::value)
+			{
+				// A view has to point into the input, so this only works for strings without escapes.
+				std::string_view str;
+				if (!read_string(str, m_scratch) || str.data() == m_scratch.data())
+					return false;
+				value = str;
+				return true;
+			}
+			else if constexpr (has_fields<T>::value)
+				return read_object(value, typename fields_of<T>::field_list{});
+			else
+			{
+				static_assert(unsupported_field<T>::value, "Can't read a field of this type.");
+				return false;
+			}
+		}
+
+		template <typename T, typename...Fields>
+		bool read_object(T& value, fields<Fields...>)
+		{
+			if (!consume('{'))
+				return false;
+			if (consume('}'))
+				return true;
+			do
+			{
+				std::string_view key;
+				if (!read_string(key, m_key) || !consume(':'))
+					return false;
+				bool ok = dispatch<typename Fields::key...>(key,
+					[&](auto matched) {
+						using F = std::tuple_element_t<field_index<decltype(matched), Fields...>(), std::tuple<Fields...>>;
+						return read(value.*F::member);
+					},
+					[&]() { return skip_value(); });
+				if (!ok)
+					return false;
+			} while (consume(','));
+			return consume('}');
+		}
+
+	private:
+		bool read_hex4(std::uint32_t& code)
+		{
+			if (m_end - m_p < 4)
+				return false;
+			code = 0;
+			for (int i = 0; i < 4; ++i)
+			{
+				char c = *m_p++;
+				code <<= 4;
+				if (c >= '0' && c <= '9') code |= static_cast<std::uint32_t>(c - '0');
+				else if (c >= 'a' && c <= 'f') code |= static_cast<std::uint32_t>(c - 'a' + 10);
+				else if (c >= 'A' && c <= 'F') code |= static_cast<std::uint32_t>(c - 'A' + 10);
+				else return false;
+			}
+			return true;
+		}
+
+		static void append_utf8(std::string& out, std::uint32_t code)
+		{
+			if (code < 0x80)
+				out += static_cast<char>(code);
+			else if (code < 0x800)
+			{
+				out += static_cast<char>(0xC0 | (code >> 6));
+				out += static_cast<char>(0x80 | (code & 0x3F));
+			}
+			else if (code < 0x10000)
+			{
+				out += static_cast<char>(0xE0 | (code >> 12));
+				out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+				out += static_cast<char>(0x80 | (code & 0x3F));
+			}
+			else
+			{
+				out += static_cast<char>(0xF0 | (code >> 18));
+				out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+				out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+				out += static_cast<char>(0x80 | (code & 0x3F));
+			}
+		}
+
+		const char* m_begin;
+		const char* m_p;
+		const char* m_end;
+		std::string m_key;
+		std::string m_scratch;
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SERIALIZE
+/// \brief Appends \c value to \c out as a JSON object
+////////////////////////////////////////////////////////////
+template <typename T>
+void write_json(std::string& out, const T& value)
+{
+	static_assert(detail::has_fields<T>::value, "Specialize ctstr::fields_of for this type first.");
+	detail::json_write_object(out, value, typename fields_of<T>::field_list{});
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SERIALIZE
+/// \brief Appends a CSV header row, with the name of each of \c T's fields, to \c out
+////////////////////////////////////////////////////////////
+template <typename T>
+void write_csv_header(std::string& out)
+{
+	static_assert(detail::has_fields<T>::value, "Specialize ctstr::fields_of for this type first.");
+	detail::csv_write_header(out, typename fields_of<T>::field_list{});
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SERIALIZE
+/// \brief Appends \c value to \c out as a CSV row
+///
+/// Strings are quoted only if they need to be.  Infinite and NaN floating point values are left empty.
+////////////////////////////////////////////////////////////
+template <typename T>
+void write_csv(std::string& out, const T& value)
+{
+	static_assert(detail::has_fields<T>::value, "Specialize ctstr::fields_of for this type first.");
+	detail::csv_write_row(out, value, typename fields_of<T>::field_list{});
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SERIALIZE
+/// \brief Reads a JSON object from the start of \c in into \c value
+///
+/// Fields missing from the input are left as they were, and keys that aren't fields are skipped.
+/// \c std::string_view fields point into \c in, so they can only be read from strings without escapes.
+///
+/// \return The number of characters read (the object and any whitespace around it), or 0 if the input wasn't valid
+////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t read_json(std::string_view in, T& value)
+{
+	static_assert(detail::has_fields<T>::value, "Specialize ctstr::fields_of for this type first.");
+	detail::json_reader reader(in);
+	if (!reader.read(value))
+		return 0;
+	reader.skip_space();
+	return reader.position();
+}
+
+}
@@ -0,0 +1,196 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Symbols.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_SYMBOLS Symbols
+///
+/// Small, dense integer ids for \c string_to_type strings, for using strings as names (of events, metrics, and so on)
+/// where comparing and hashing the text would be too slow.
+///
+/// Every string whose \c id() is used anywhere in the program is registered before \c main() starts,
+/// and they're numbered 0, 1, 2, ... in the order they're registered.  So an id can index a plain array,
+/// comparing two is comparing integers, and \c symbols can turn one back into its text.
+///
+/// The ids are the same in every translation unit, but the numbering depends on the order the program
+/// happens to initialize in, so it can change from one build to the next.  Don't store them anywhere that outlives the process;
+/// write out the name (or \c ctstr::xxh64_v from \c Hash.hpp) instead.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	// Strings of different character types are different symbols, even when their bytes are the same, so each type
+	// gets its own table.  The last one is for char8_t, the only other single-byte character type.
+	constexpr std::size_t symbol_kinds = 5;
+
+	template <typename CharType>
+	constexpr std::size_t symbol_kind()
+	{
+		return std::is_same<CharType, char>::value?          0
+		     : std::is_same<CharType, signed char>::value?   1
+		     : std::is_same<CharType, unsigned char>::value? 2
+		     : std::is_same<CharType, bool>::value?          3
+		     :                                               4;
+	}
+
+	class symbol_registry
+	{
+	public:
+		std::uint32_t add(std::size_t kind, std::string_view name)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto inserted = m_ids[kind].emplace(name, static_cast<std::uint32_t>(m_names.size()));
+			if (inserted.second)
+				m_names.push_back(name);
+			return inserted.first->second;
+		}
+
+		std::size_t count()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_names.size();
+		}
+
+		std::string_view name(std::uint32_t id)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			assert(id < m_names.size() && "Not a symbol id!");
+			return id < m_names.size()? m_names[id] : std::string_view();
+		}
+
+		std::optional<std::uint32_t> find(std::size_t kind, std::string_view name)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto it = m_ids[kind].find(name);
+			if (it == m_ids[kind].end())
+				return std::nullopt;
+			return it->second;
+		}
+
+	private:
+		std::mutex m_mutex;
+		std::vector<std::string_view> m_names;
+		std::unordered_map<std::string_view, std::uint32_t> m_ids[symbol_kinds];
+	};
+
+	// Made on first use, since symbol<...>::registered runs during static initialization, in whichever translation unit comes first.
+	inline symbol_registry& symbols()
+	{
+		static symbol_registry registry;
+		return registry;
+	}
+
+	template <typename SeqType>
+	struct symbol
+	{
+		static_assert(sizeof(typename sequence_type<SeqType>::type) == 1, "Symbols must be made of single-byte characters.");
+
+		static std::uint32_t get()
+		{
+			// Using registered here is what makes it exist (and so register this symbol at startup) in the first place.
+			static_cast<void>(&registered);
+			static const std::uint32_t value = symbols().add(symbol_kind<typename sequence_type<SeqType>::type>(), std::string_view(reinterpret_cast<const char*>(data<SeqType>), size<SeqType>));
+			return value;
+		}
+
+		static inline const std::uint32_t registered = get();
+	};
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SYMBOLS
+/// \brief The dense id of a \c string_to_type string
+///
+/// \code
+/// std::uint32_t frame = ctstr::id<string_to_type("frame")>();
+/// counters[frame] += 1;
+/// \endcode
+///
+/// Always the same value for the same string.  It's safe to call at any time, even from other static initializers.
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+std::uint32_t id(SeqType sequence = SeqType{})
+{
+	static_cast<void>(sequence);
+	return detail::symbol<SeqType>::get();
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_SYMBOLS
+/// \brief Every string that's been given an \c id()
+///
+/// All of these are thread-safe.  Names are views of the strings' static storage, so they never dangle.
+////////////////////////////////////////////////////////////
+struct symbols
+{
+	/// Number of registered strings; the ids are 0 to <tt>count() - 1</tt>.
+	static std::size_t count() { return detail::symbols().count(); }
+
+	/// The text of the string with this id.
+	static std::string_view name(std::uint32_t id) { return detail::symbols().name(id); }
+
+	/// The id of the \c char string with this text, if one was registered.
+	static std::optional<std::uint32_t> find(std::string_view name) { return detail::symbols().find(detail::symbol_kind<char>(), name); }
+
+#if defined(__cpp_lib_char8_t)
+	/// The id of the \c char8_t string with this text, if one was registered.
+	static std::optional<std::uint32_t> find(std::u8string_view name)
+	{
+		return detail::symbols().find(detail::symbol_kind<char8_t>(), std::string_view(reinterpret_cast<const char*>(name.data()), name.size()));
+	}
+#endif
+};
+
+}
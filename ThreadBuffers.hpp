@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+// The per-thread buffer registry that Trace.hpp and Log.hpp share.  Nothing in here is meant to be used directly.
+
+#pragma once
+
+#include "CTStr.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error ThreadBuffers.hpp requires C++17
+#endif
+
+/// \cond INTERNAL
+namespace ctstr
+{
+namespace detail
+{
+	// Every thread that records something gets a Buffer of its own, which it fills without locking, and a single reader
+	// drains them all.  Buffer needs finish(), finished(), dropped() and drain(f); if it can be made from a
+	// std::uint32_t it's given the number of its thread, counting from 0 in the order they started.
+	template <typename Buffer>
+	class thread_buffers
+	{
+	public:
+		std::shared_ptr<Buffer> add()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if constexpr (std::is_constructible_v<Buffer, std::uint32_t>)
+				m_buffers.push_back(std::make_shared<Buffer>(m_next_thread++));
+			else
+				m_buffers.push_back(std::make_shared<Buffer>());
+			return m_buffers.back();
+		}
+
+		// Passes f to every buffer's drain().  Buffers whose threads have exited are let go of once they're empty.
+		template <typename F>
+		void drain(F&& f)
+		{
+			std::lock_guard<std::mutex> drain_lock(m_drain_mutex);
+			std::vector<std::shared_ptr<Buffer>> buffers;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				buffers = m_buffers;
+			}
+
+			std::vector<Buffer*> done;
+			for (const std::shared_ptr<Buffer>& buffer : buffers)
+			{
+				// Checked before draining, so that everything the thread wrote before it finished gets drained.
+				bool finished = buffer->finished();
+				buffer->drain(f);
+				if (finished)
+					done.push_back(buffer.get());
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for (Buffer* buffer : done)
+			{
+				m_dropped += buffer->dropped();
+				m_buffers.erase(std::find_if(m_buffers.begin(), m_buffers.end(), [&](const std::shared_ptr<Buffer>& b) { return b.get() == buffer; }));
+			}
+		}
+
+		std::uint64_t dropped()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			std::uint64_t total = m_dropped;
+			for (const std::shared_ptr<Buffer>& buffer : m_buffers)
+				total += buffer->dropped();
+			return total;
+		}
+
+	private:
+		std::mutex m_mutex;
+		std::mutex m_drain_mutex;
+		std::vector<std::shared_ptr<Buffer>> m_buffers;
+		std::uint32_t m_next_thread = 0;
+		std::uint64_t m_dropped = 0;
+	};
+
+	// The calling thread's buffer from the thread_buffers that Registry() returns, added the first time it's asked for.
+	// It's marked finished when the thread exits, and the registry lets it go once it's been drained.
+	template <auto Registry>
+	auto& this_thread_buffer()
+	{
+		struct owner
+		{
+			decltype(Registry().add()) buffer = Registry().add();
+			~owner() { buffer->finish(); }
+		};
+		thread_local owner thread;
+		return *thread.buffer;
+	}
+}
+}
+/// \endcond
@@ -0,0 +1,381 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "CTStr.hpp"
+#include "Symbols.hpp"
+#include "ThreadBuffers.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Trace.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_TRACE Tracing
+///
+/// Timing zones and counters named by \c string_to_type strings, cheap enough to leave in hot code.
+///
+/// \code
+/// void query()
+/// {
+///     CTSTR_TRACE_ZONE("db.query");
+///     if (!cached)
+///         CTSTR_COUNTER("cache.miss");
+///     ...
+/// }
+///
+/// int main()
+/// {
+///     ctstr::trace_collector collector("trace.json");
+///     ...
+/// }
+/// \endcode
+///
+/// Each name is given an \c id() from \c Symbols.hpp, so its text is stored once and an event is just that id,
+/// a timestamp and what kind of event it is.  Every thread writes its events to its own ring buffer without
+/// taking a lock or copying any strings, and a \c trace_collector drains all of them on a thread of its own into a
+/// Chrome trace (JSON) file that \c chrome://tracing and Perfetto can open.  If a buffer fills up before it's drained,
+/// new events are dropped (and counted) rather than making the traced thread wait.
+///
+/// Unless \c CTSTR_TRACING is 1 the macros expand to nothing, so their names aren't even turned into types.
+////////////////////////////////////////////////////////////
+
+#ifndef CTSTR_TRACING
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_TRACE
+/// \brief Turns tracing on
+///
+/// \c #define this to 1 (in every translation unit) to make \c CTSTR_TRACE_ZONE and \c CTSTR_COUNTER record events.
+/// Otherwise they compile to nothing at all.
+////////////////////////////////////////////////////////////
+#define CTSTR_TRACING 0
+#endif
+
+#ifndef CTSTR_TRACE_BUFFER_SIZE
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_TRACE
+/// \brief How many events each thread's buffer holds; must be a power of 2
+///
+/// Each event is 16 bytes, so the default is 256KB per thread that records any.
+////////////////////////////////////////////////////////////
+#define CTSTR_TRACE_BUFFER_SIZE 0x4000
+#endif
+
+#define CTSTR_TRACE_CONCAT_IMPL(a, b) a##b
+#define CTSTR_TRACE_CONCAT(a, b) CTSTR_TRACE_CONCAT_IMPL(a, b)
+
+// Names each zone's variable; __COUNTER__ where there is one, so two zones on the same line (say, from a macro) don't clash.
+#if defined(__COUNTER__)
+#define CTSTR_TRACE_UNIQUE __COUNTER__
+#else
+#define CTSTR_TRACE_UNIQUE __LINE__
+#endif
+
+#if CTSTR_TRACING
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_TRACE
+/// \brief Times the rest of the enclosing scope as a zone called \c name
+////////////////////////////////////////////////////////////
+#define CTSTR_TRACE_ZONE(name) const ::ctstr::trace_zone<string_to_type(name)> CTSTR_TRACE_CONCAT(ctstr_trace_zone_, CTSTR_TRACE_UNIQUE)
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_TRACE
+/// \brief Adds 1 to the counter called \c name
+////////////////////////////////////////////////////////////
+#define CTSTR_COUNTER(name) ::ctstr::trace_count<string_to_type(name)>()
+#else
+#define CTSTR_TRACE_ZONE(name) static_cast<void>(0)
+#define CTSTR_COUNTER(name) static_cast<void>(0)
+#endif
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	enum class trace_kind : std::uint32_t { begin, end, counter };
+
+	struct trace_event
+	{
+		std::uint64_t time;
+		std::uint32_t id;
+		trace_kind kind;
+	};
+
+	inline std::uint64_t trace_now()
+	{
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+
+	// A single-producer, single-consumer ring of events.  The thread that owns it pushes, and the collector drains.
+	class trace_buffer
+	{
+	public:
+		static constexpr std::size_t capacity = CTSTR_TRACE_BUFFER_SIZE;
+		static_assert(capacity != 0 && (capacity & (capacity - 1)) == 0, "CTSTR_TRACE_BUFFER_SIZE must be a power of 2.");
+
+		explicit trace_buffer(std::uint32_t thread) : m_events(new trace_event[capacity]), m_thread(thread) {}
+
+		void push(const trace_event& event)
+		{
+			std::size_t head = m_head.load(std::memory_order_relaxed);
+			if (head - m_tail_seen == capacity)
+			{
+				// Only go and look at the collector's side (another cache line) when it seems to be full.
+				m_tail_seen = m_tail.load(std::memory_order_acquire);
+				if (head - m_tail_seen == capacity)
+				{
+					m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+					return;
+				}
+			}
+			m_events[head & (capacity - 1)] = event;
+			m_head.store(head + 1, std::memory_order_release);
+		}
+
+		template <typename F>
+		void drain(F&& f)
+		{
+			std::size_t tail = m_tail.load(std::memory_order_relaxed);
+			std::size_t head = m_head.load(std::memory_order_acquire);
+			for (; tail != head; ++tail)
+				f(m_events[tail & (capacity - 1)], m_thread);
+			m_tail.store(tail, std::memory_order_release);
+		}
+
+		void finish() { m_finished.store(true, std::memory_order_release); }
+		bool finished() const { return m_finished.load(std::memory_order_acquire); }
+		std::uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+	private:
+		std::unique_ptr<trace_event[]> m_events;
+		std::uint32_t m_thread;
+		std::atomic<bool> m_finished{ false };
+
+		// Written by the owning thread.
+		alignas(64) std::atomic<std::size_t> m_head{ 0 };
+		std::size_t m_tail_seen = 0;
+		std::atomic<std::uint64_t> m_dropped{ 0 };
+
+		// Written by the collector.
+		alignas(64) std::atomic<std::size_t> m_tail{ 0 };
+	};
+
+	// Zones can be entered from static initializers, before a registry at namespace scope would have been constructed.
+	inline thread_buffers<trace_buffer>& traces()
+	{
+		static thread_buffers<trace_buffer> registry;
+		return registry;
+	}
+
+	inline void trace(std::uint32_t id, trace_kind kind)
+	{
+		this_thread_buffer<&traces>().push(trace_event{ trace_now(), id, kind });
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_TRACE
+/// \brief Records the start of a zone when it's made and the end when it's destroyed
+///
+/// Use \c CTSTR_TRACE_ZONE rather than making these directly, so that they go away when tracing is off.
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+class trace_zone
+{
+public:
+	trace_zone() { detail::trace(id<SeqType>(), detail::trace_kind::begin); }
+	~trace_zone() { detail::trace(id<SeqType>(), detail::trace_kind::end); }
+
+	trace_zone(const trace_zone&) = delete;
+	trace_zone& operator=(const trace_zone&) = delete;
+};
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_TRACE
+/// \brief Adds 1 to a counter
+///
+/// Use \c CTSTR_COUNTER rather than calling this directly, so that it goes away when tracing is off.
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+void trace_count(SeqType sequence = SeqType{})
+{
+	static_cast<void>(sequence);
+	detail::trace(id<SeqType>(), detail::trace_kind::counter);
+}
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_TRACE
+/// \brief Writes every thread's events to a Chrome trace file as they come in
+///
+/// Starts a thread that drains the buffers every \c interval, and finishes the file when it's destroyed.
+/// Events recorded before it was made (but not yet dropped) are included.  Zones are written as
+/// \c "B"/\c "E" pairs on the thread that recorded them, and counters as \c "C" events carrying the total
+/// across all threads so far.
+///
+/// Keep one of these for as long as you're tracing.  If there's more than one at a time, each event
+/// goes to only one of their files.
+////////////////////////////////////////////////////////////
+class trace_collector
+{
+public:
+	////////////////////////////////////////////////////////////
+	/// \brief Creates (or overwrites) the file at \c path and starts collecting
+	///
+	/// \throw std::runtime_error if the file can't be opened
+	////////////////////////////////////////////////////////////
+	explicit trace_collector(const std::string& path, std::chrono::milliseconds interval = std::chrono::milliseconds(10))
+		: m_out(path, std::ios::binary | std::ios::trunc)
+		, m_interval(interval)
+	{
+		if (!m_out)
+			throw std::runtime_error("ctstr::trace_collector: couldn't open " + path);
+		m_out << "{\"traceEvents\":[";
+		m_thread = std::thread([this] { run(); });
+	}
+
+	~trace_collector()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_wake.notify_one();
+		m_thread.join();
+		flush();
+		m_out << "\n]}\n";
+	}
+
+	trace_collector(const trace_collector&) = delete;
+	trace_collector& operator=(const trace_collector&) = delete;
+
+	/// Drains every buffer now, instead of waiting for the next interval.
+	void flush()
+	{
+		std::lock_guard<std::mutex> lock(m_write_mutex);
+		detail::traces().drain([this](const detail::trace_event& event, std::uint32_t thread) { write(event, thread); });
+		m_out.flush();
+	}
+
+	/// How many events have been lost so far because a thread's buffer was full.
+	static std::uint64_t dropped() { return detail::traces().dropped(); }
+
+private:
+	void run()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		while (!m_wake.wait_for(lock, m_interval, [this] { return m_stop; }))
+		{
+			lock.unlock();
+			flush();
+			lock.lock();
+		}
+	}
+
+	// The name of each id, already escaped for JSON.  Looked up once each, since symbols::name takes a lock.
+	const std::string& name(std::uint32_t id)
+	{
+		if (id >= m_names.size())
+			m_names.resize(id + 1);
+		std::string& escaped = m_names[id];
+		if (escaped.empty())
+		{
+			for (char c : symbols::name(id))
+			{
+				if (c == '"' || c == '\\')
+					escaped += '\\';
+				if (static_cast<unsigned char>(c) < 0x20)
+				{
+					char buffer[8];
+					std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+					escaped += buffer;
+				}
+				else
+					escaped += c;
+			}
+			escaped.insert(escaped.begin(), '"');
+			escaped += '"';
+		}
+		return escaped;
+	}
+
+	void write(const detail::trace_event& event, std::uint32_t thread)
+	{
+		static const char phases[] = { 'B', 'E', 'C' };
+		char time[32];
+		std::snprintf(time, sizeof(time), "%llu.%03llu", static_cast<unsigned long long>(event.time / 1000), static_cast<unsigned long long>(event.time % 1000));
+
+		m_out << (m_first? "\n" : ",\n") << "{\"name\":" << name(event.id) << ",\"ph\":\"" << phases[static_cast<std::uint32_t>(event.kind)]
+			<< "\",\"ts\":" << time << ",\"pid\":1,\"tid\":" << thread;
+		if (event.kind == detail::trace_kind::counter)
+		{
+			if (event.id >= m_counts.size())
+				m_counts.resize(event.id + 1);
+			m_out << ",\"args\":{\"value\":" << ++m_counts[event.id] << "}";
+		}
+		m_out << "}";
+		m_first = false;
+	}
+
+	std::ofstream m_out;
+	std::chrono::milliseconds m_interval;
+	std::vector<std::string> m_names;
+	std::vector<std::uint64_t> m_counts;
+	bool m_first = true;
+
+	std::mutex m_write_mutex;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	bool m_stop = false;
+	std::thread m_thread;
+};
+
+}
@@ -0,0 +1,545 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Algorithms.hpp"
+#include "UnicodeTables.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#if CTSTR_CPLUSPLUS < 201703L
+#error Unicode.hpp requires C++17
+#endif
+
+////////////////////////////////////////////////////////////
+/// \file
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// \defgroup CTSTR_UNICODE Unicode
+///
+/// Converting \c string_to_type strings between UTF-8, UTF-16 and UTF-32, and into Unicode normalization forms C and D,
+/// at compile time.
+///
+/// \c string_to_type(U"á") is a different type depending on whether the editor saved the \c á as one code point or as
+/// an \c a and a combining accent.  \c nfc_t<string_to_type(U"á")> is the same type either way, so canonically
+/// equivalent strings can be used as the same template argument.  Strings that arrive at runtime can be put through
+/// \c ctstr::nfc too, and then compared with \c to_string_view<nfc_t<S>>() directly.
+///
+/// The encoding comes from the character type: \c char and \c char8_t are UTF-8, \c char16_t is UTF-16, \c char32_t
+/// is UTF-32, and \c wchar_t is whichever of UTF-16 or UTF-32 is its size.  A string that isn't valid in its encoding
+/// is a compile error.  The normalization data is generated into \c UnicodeTables.hpp by \c tools/unicode_tables.py;
+/// \c CTSTR_UNICODE_VERSION says which version of Unicode it came from.
+////////////////////////////////////////////////////////////
+
+namespace ctstr
+{
+
+////////////////////////////////////////////////////////////
+/// \cond INTERNAL
+////////////////////////////////////////////////////////////
+namespace detail
+{
+	enum class unicode_form { none, nfd, nfc };
+
+	constexpr char32_t unicode_replacement = 0xFFFD;
+
+	// Bits per code unit, or 0 for a type with no known encoding.
+	template <typename T>
+	constexpr int utf_bits()
+	{
+		if (std::is_same<T, char>::value || std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value || std::is_same<T, wchar_t>::value)
+			return sizeof(T) == 1? 8 : sizeof(T) == 2? 16 : sizeof(T) == 4? 32 : 0;
+#if defined(__cpp_char8_t)
+		if (std::is_same<T, char8_t>::value)
+			return 8;
+#endif
+		return 0;
+	}
+
+	template <typename T>
+	constexpr std::uint32_t code_unit(T c)
+	{
+		return static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<T>>(c));
+	}
+
+	// Decodes the code point at str[i] and moves i past it.  Anything that isn't valid (a stray continuation byte, an overlong
+	// or truncated sequence, a lone surrogate or a value past U+10FFFF) is one unit long and decodes to U+FFFD, with valid cleared.
+	template <typename T>
+	constexpr char32_t utf_decode(const T* str, std::size_t length, std::size_t& i, bool& valid)
+	{
+		const std::uint32_t c = code_unit(str[i++]);
+		if constexpr (utf_bits<T>() == 8)
+		{
+			if (c < 0x80)
+				return c;
+			std::size_t extra = c >= 0xC2 && c < 0xE0? 1 : c >= 0xE0 && c < 0xF0? 2 : c >= 0xF0 && c < 0xF5? 3 : 0;
+			if (extra == 0 || length - i < extra)
+			{
+				valid = false;
+				return unicode_replacement;
+			}
+			std::uint32_t cp = c & (0x3F >> extra);
+			for (std::size_t j = 0; j < extra; ++j)
+			{
+				const std::uint32_t next = code_unit(str[i + j]);
+				if ((next & 0xC0) != 0x80)
+				{
+					valid = false;
+					return unicode_replacement;
+				}
+				cp = cp << 6 | (next & 0x3F);
+			}
+			constexpr std::uint32_t smallest[] = { 0, 0x80, 0x800, 0x10000 };
+			if (cp < smallest[extra] || cp > 0x10FFFF || (cp >= 0xD800 && cp < 0xE000))
+			{
+				valid = false;
+				return unicode_replacement;
+			}
+			i += extra;
+			return cp;
+		}
+		else if constexpr (utf_bits<T>() == 16)
+		{
+			if (c < 0xD800 || c >= 0xE000)
+				return c;
+			if (c < 0xDC00 && i < length && code_unit(str[i]) >= 0xDC00 && code_unit(str[i]) < 0xE000)
+				return 0x10000 + ((c - 0xD800) << 10 | (code_unit(str[i++]) - 0xDC00));
+			valid = false;
+			return unicode_replacement;
+		}
+		else
+		{
+			if (c <= 0x10FFFF && (c < 0xD800 || c >= 0xE000))
+				return c;
+			valid = false;
+			return unicode_replacement;
+		}
+	}
+
+	// Writes c to out, unless out is null, and returns how many code units it takes.
+	template <typename T>
+	constexpr std::size_t utf_encode(char32_t c, T* out)
+	{
+		if constexpr (utf_bits<T>() == 8)
+		{
+			const std::size_t length = c < 0x80? 1 : c < 0x800? 2 : c < 0x10000? 3 : 4;
+			if (out)
+			{
+				if (length == 1)
+					out[0] = static_cast<T>(c);
+				else
+				{
+					constexpr std::uint32_t leads[] = { 0, 0, 0xC0, 0xE0, 0xF0 };
+					out[0] = static_cast<T>(leads[length] | c >> 6 * (length - 1));
+					for (std::size_t j = 1; j < length; ++j)
+						out[j] = static_cast<T>(0x80 | (c >> 6 * (length - 1 - j) & 0x3F));
+				}
+			}
+			return length;
+		}
+		else if constexpr (utf_bits<T>() == 16)
+		{
+			if (c < 0x10000)
+			{
+				if (out)
+					out[0] = static_cast<T>(c);
+				return 1;
+			}
+			if (out)
+			{
+				out[0] = static_cast<T>(0xD800 + ((c - 0x10000) >> 10));
+				out[1] = static_cast<T>(0xDC00 + ((c - 0x10000) & 0x3FF));
+			}
+			return 2;
+		}
+		else
+		{
+			if (out)
+				out[0] = static_cast<T>(c);
+			return 1;
+		}
+	}
+
+	// The entry of a sorted table whose bits above Shift are key, or 0.
+	template <typename Int, std::size_t N>
+	constexpr Int unicode_lookup(const Int (&table)[N], Int key, int shift)
+	{
+		std::size_t first = 0;
+		std::size_t last = N;
+		while (first < last)
+		{
+			const std::size_t middle = first + (last - first) / 2;
+			const Int found = table[middle] >> shift;
+			if (found == key)
+				return table[middle];
+			if (found < key)
+				first = middle + 1;
+			else
+				last = middle;
+		}
+		return 0;
+	}
+
+	// Hangul syllables are composed from their jamo arithmetically, so they aren't in the tables.
+	constexpr char32_t hangul_s = 0xAC00;
+	constexpr char32_t hangul_l = 0x1100;
+	constexpr char32_t hangul_v = 0x1161;
+	constexpr char32_t hangul_t = 0x11A7;
+	constexpr char32_t hangul_v_count = 21;
+	constexpr char32_t hangul_t_count = 28;
+	constexpr char32_t hangul_count = 19 * hangul_v_count * hangul_t_count;
+
+	// Nothing below U+0300 has a combining class, nothing below U+00C0 decomposes, and nothing below U+0300 is the
+	// second half of a composition, so text that's all below U+00C0 is already in both forms.
+	constexpr char32_t unicode_stable_below = 0xC0;
+
+	constexpr std::uint8_t combining_class(char32_t c)
+	{
+		if (c < 0x300)
+			return 0;
+		return static_cast<std::uint8_t>(unicode_lookup(unicode_combining_classes, static_cast<std::uint32_t>(c), 8) & 0xFF);
+	}
+
+	// Writes the full canonical decomposition of c to out, which needs room for 4 code points, and returns its length.
+	constexpr std::size_t decompose(char32_t c, char32_t* out)
+	{
+		if (c < unicode_stable_below)
+		{
+			out[0] = c;
+			return 1;
+		}
+		if (c >= hangul_s && c < hangul_s + hangul_count)
+		{
+			const char32_t s = c - hangul_s;
+			out[0] = hangul_l + s / (hangul_v_count * hangul_t_count);
+			out[1] = hangul_v + s % (hangul_v_count * hangul_t_count) / hangul_t_count;
+			if (s % hangul_t_count == 0)
+				return 2;
+			out[2] = hangul_t + s % hangul_t_count;
+			return 3;
+		}
+		const std::uint64_t entry = unicode_lookup(unicode_decompositions, static_cast<std::uint64_t>(c), 42);
+		if (entry == 0)
+		{
+			out[0] = c;
+			return 1;
+		}
+		const char32_t first = static_cast<char32_t>(entry >> 21 & 0x1FFFFF);
+		const char32_t second = static_cast<char32_t>(entry & 0x1FFFFF);
+		std::size_t length = decompose(first, out);
+		if (second)
+			length += decompose(second, out + length);
+		return length;
+	}
+
+	// The primary composite of first and second, or 0 if they don't compose.
+	constexpr char32_t compose(char32_t first, char32_t second)
+	{
+		if (first >= hangul_l && first < hangul_l + 19 && second >= hangul_v && second < hangul_v + hangul_v_count)
+			return hangul_s + ((first - hangul_l) * hangul_v_count + (second - hangul_v)) * hangul_t_count;
+		if (first >= hangul_s && first < hangul_s + hangul_count && (first - hangul_s) % hangul_t_count == 0 &&
+			second > hangul_t && second < hangul_t + hangul_t_count)
+			return first + (second - hangul_t);
+		if (second < 0x300)
+			return 0;
+		const std::uint64_t key = static_cast<std::uint64_t>(first) << 21 | second;
+		return static_cast<char32_t>(unicode_lookup(unicode_compositions, key, 21) & 0x1FFFFF);
+	}
+
+	// Stable-sorts every run of non-starters by combining class.
+	constexpr void canonical_order(char32_t* cps, std::size_t length)
+	{
+		for (std::size_t i = 1; i < length; ++i)
+		{
+			const char32_t c = cps[i];
+			const std::uint8_t ccc = combining_class(c);
+			if (ccc == 0)
+				continue;
+			std::size_t j = i;
+			for (; j > 0 && combining_class(cps[j - 1]) > ccc; --j)
+				cps[j] = cps[j - 1];
+			cps[j] = c;
+		}
+	}
+
+	// The canonical composition algorithm, in place.  Returns the new length.
+	constexpr std::size_t canonical_compose(char32_t* cps, std::size_t length)
+	{
+		constexpr std::size_t no_starter = static_cast<std::size_t>(-1);
+		std::size_t starter = no_starter;
+		std::uint8_t last_ccc = 0;
+		std::size_t out = 0;
+		for (std::size_t i = 0; i < length; ++i)
+		{
+			const char32_t c = cps[i];
+			const std::uint8_t ccc = combining_class(c);
+			// c can join the last starter if nothing in between has blocked it: either there's nothing in between,
+			// or everything in between has a lower (non-zero) combining class than c does.
+			if (starter != no_starter && (out == starter + 1 || (last_ccc != 0 && last_ccc < ccc)))
+			{
+				const char32_t composite = compose(cps[starter], c);
+				if (composite)
+				{
+					cps[starter] = composite;
+					continue;
+				}
+			}
+			if (ccc == 0)
+				starter = out;
+			last_ccc = ccc;
+			cps[out++] = c;
+		}
+		return out;
+	}
+
+	// Decodes str into out, which needs room for 4 code points per code unit unless form is none, and normalizes it.
+	// Returns the number of code points.
+	template <typename T>
+	constexpr std::size_t unicode_normalize(const T* str, std::size_t length, char32_t* out, unicode_form form, bool& valid)
+	{
+		std::size_t count = 0;
+		bool stable = true;
+		for (std::size_t i = 0; i < length; )
+		{
+			const char32_t c = utf_decode(str, length, i, valid);
+			if (c < unicode_stable_below || form == unicode_form::none)
+				out[count++] = c;
+			else
+			{
+				count += decompose(c, out + count);
+				stable = false;
+			}
+		}
+		if (stable)
+			return count;
+		canonical_order(out, count);
+		return form == unicode_form::nfc? canonical_compose(out, count) : count;
+	}
+
+	template <typename SeqType, typename Out, unicode_form Form>
+	struct unicode_transform
+	{
+		using T = typename sequence_type<SeqType>::type;
+		static_assert(utf_bits<T>() != 0, "Only strings of char, char8_t, char16_t, char32_t or wchar_t have a Unicode encoding.");
+		static_assert(utf_bits<Out>() != 0, "Strings can only be converted to char, char8_t, char16_t, char32_t or wchar_t.");
+
+		static constexpr std::size_t capacity = (Form == unicode_form::none? 1 : 4) * size<SeqType> + 1;
+
+		struct measure
+		{
+			std::size_t length = 0;
+			bool valid = true;
+
+			constexpr measure()
+			{
+				const auto str = chars(SeqType{});
+				std::array<char32_t, capacity> cps{};
+				const std::size_t count = unicode_normalize(str.data(), size<SeqType>, cps.data(), Form, valid);
+				for (std::size_t i = 0; i < count; ++i)
+					length += utf_encode<Out>(cps[i], nullptr);
+			}
+		};
+
+		static constexpr measure measured{};
+		static_assert(measured.valid, "The string isn't valid UTF-8, UTF-16 or UTF-32 (whichever its character type uses).");
+
+		static constexpr std::array<Out, measured.length> make()
+		{
+			const auto str = chars(SeqType{});
+			std::array<char32_t, capacity> cps{};
+			bool valid = true;
+			const std::size_t count = unicode_normalize(str.data(), size<SeqType>, cps.data(), Form, valid);
+			std::array<Out, measured.length> out{};
+			std::size_t o = 0;
+			for (std::size_t i = 0; i < count; ++i)
+				o += utf_encode(cps[i], out.data() + o);
+			return out;
+		}
+
+		static constexpr auto value = make();
+		using type = array_to_sequence_t<Out, unicode_transform>;
+	};
+
+	// Nothing to do for a string that's already in the right encoding and doesn't need normalizing.
+	template <typename T, T...t>
+	struct unicode_transform<std::integer_sequence<T, t...>, T, unicode_form::none>
+	{
+		static_assert(utf_bits<T>() != 0, "Only strings of char, char8_t, char16_t, char32_t or wchar_t have a Unicode encoding.");
+		static_assert(unicode_transform<std::integer_sequence<T, t...>, char32_t, unicode_form::none>::measured.valid,
+			"The string isn't valid UTF-8, UTF-16 or UTF-32 (whichever its character type uses).");
+		using type = std::integer_sequence<T, t...>;
+	};
+
+	template <typename T>
+	std::basic_string<T> normalize_string(std::basic_string_view<T> str, unicode_form form)
+	{
+		// Bytes from 0x80 up are parts of longer UTF-8 sequences, but otherwise each code unit is a code point.
+		constexpr std::uint32_t stable_below = utf_bits<T>() == 8? 0x80 : unicode_stable_below;
+		bool stable = true;
+		for (T c : str)
+			stable = stable && code_unit(c) < stable_below;
+		if (stable)
+			return std::basic_string<T>(str);
+
+		std::u32string cps(4 * str.size(), U'\0');
+		bool valid = true;
+		cps.resize(unicode_normalize(str.data(), str.size(), &cps[0], form, valid));
+		std::size_t length = 0;
+		for (char32_t c : cps)
+			length += utf_encode<T>(c, nullptr);
+		std::basic_string<T> out(length, T());
+		std::size_t o = 0;
+		for (char32_t c : cps)
+			o += utf_encode(c, &out[o]);
+		return out;
+	}
+}
+////////////////////////////////////////////////////////////
+/// \endcond
+////////////////////////////////////////////////////////////
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_UNICODE
+/// \brief \c SeqType as UTF-8, with \c CharT as the character type
+///
+/// \code
+/// static_assert(std::is_same<ctstr::to_utf8_t<string_to_type(U"é")>, std::integer_sequence<char, '\xC3', '\xA9'>>::value, "");
+/// \endcode
+////////////////////////////////////////////////////////////
+template <typename SeqType, typename CharT = char>
+using to_utf8_t = typename detail::unicode_transform<SeqType, CharT, detail::unicode_form::none>::type;
+
+/// \ingroup CTSTR_UNICODE
+/// \brief <tt>to_utf8_t<SeqType>{}</tt>
+template <typename SeqType>
+constexpr to_utf8_t<SeqType> to_utf8(SeqType) { return {}; }
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_UNICODE
+/// \brief \c SeqType as UTF-16
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+using to_utf16_t = typename detail::unicode_transform<SeqType, char16_t, detail::unicode_form::none>::type;
+
+/// \ingroup CTSTR_UNICODE
+/// \brief <tt>to_utf16_t<SeqType>{}</tt>
+template <typename SeqType>
+constexpr to_utf16_t<SeqType> to_utf16(SeqType) { return {}; }
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_UNICODE
+/// \brief \c SeqType as UTF-32, one \c char32_t per code point
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+using to_utf32_t = typename detail::unicode_transform<SeqType, char32_t, detail::unicode_form::none>::type;
+
+/// \ingroup CTSTR_UNICODE
+/// \brief <tt>to_utf32_t<SeqType>{}</tt>
+template <typename SeqType>
+constexpr to_utf32_t<SeqType> to_utf32(SeqType) { return {}; }
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_UNICODE
+/// \brief \c SeqType in Normalization Form C (composed), in the same encoding
+///
+/// \code
+/// static_assert(std::is_same<ctstr::nfc_t<string_to_type(U"á")>, string_to_type(U"á")>::value, "");
+/// \endcode
+///
+/// Strings that only use code points below U+00C0 (including all of ASCII) are already normalized and come back unchanged.
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+using nfc_t = typename detail::unicode_transform<SeqType, typename sequence_type<SeqType>::type, detail::unicode_form::nfc>::type;
+
+/// \ingroup CTSTR_UNICODE
+/// \brief <tt>nfc_t<SeqType>{}</tt>
+template <typename SeqType, typename = std::enable_if_t<is_sequence<SeqType>::value>>
+constexpr nfc_t<SeqType> nfc(SeqType) { return {}; }
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_UNICODE
+/// \brief \c SeqType in Normalization Form D (decomposed), in the same encoding
+///
+/// \see nfc_t
+////////////////////////////////////////////////////////////
+template <typename SeqType>
+using nfd_t = typename detail::unicode_transform<SeqType, typename sequence_type<SeqType>::type, detail::unicode_form::nfd>::type;
+
+/// \ingroup CTSTR_UNICODE
+/// \brief <tt>nfd_t<SeqType>{}</tt>
+template <typename SeqType, typename = std::enable_if_t<is_sequence<SeqType>::value>>
+constexpr nfd_t<SeqType> nfd(SeqType) { return {}; }
+
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_UNICODE
+/// \brief A runtime string in Normalization Form C, to compare with an \c nfc_t string
+///
+/// \code
+/// if (ctstr::nfc(input) == ctstr::to_string_view<ctstr::nfc_t<string_to_type(u8"café")>>())
+/// \endcode
+///
+/// Uses the same tables as \c nfc_t, so the two always agree.  Anything that isn't valid in the string's encoding is
+/// replaced by U+FFFD.  Strings with nothing above U+007F are copied without being decoded.
+////////////////////////////////////////////////////////////
+inline std::string nfc(std::string_view str) { return detail::normalize_string(str, detail::unicode_form::nfc); }
+/// \ingroup CTSTR_UNICODE
+inline std::u16string nfc(std::u16string_view str) { return detail::normalize_string(str, detail::unicode_form::nfc); }
+/// \ingroup CTSTR_UNICODE
+inline std::u32string nfc(std::u32string_view str) { return detail::normalize_string(str, detail::unicode_form::nfc); }
+/// \ingroup CTSTR_UNICODE
+inline std::wstring nfc(std::wstring_view str) { return detail::normalize_string(str, detail::unicode_form::nfc); }
+#if defined(__cpp_lib_char8_t)
+/// \ingroup CTSTR_UNICODE
+inline std::u8string nfc(std::u8string_view str) { return detail::normalize_string(str, detail::unicode_form::nfc); }
+#endif
+
+////////////////////////////////////////////////////////////
+/// \ingroup CTSTR_UNICODE
+/// \brief A runtime string in Normalization Form D, to compare with an \c nfd_t string
+///
+/// \see nfc(std::string_view)
+////////////////////////////////////////////////////////////
+inline std::string nfd(std::string_view str) { return detail::normalize_string(str, detail::unicode_form::nfd); }
+/// \ingroup CTSTR_UNICODE
+inline std::u16string nfd(std::u16string_view str) { return detail::normalize_string(str, detail::unicode_form::nfd); }
+/// \ingroup CTSTR_UNICODE
+inline std::u32string nfd(std::u32string_view str) { return detail::normalize_string(str, detail::unicode_form::nfd); }
+/// \ingroup CTSTR_UNICODE
+inline std::wstring nfd(std::wstring_view str) { return detail::normalize_string(str, detail::unicode_form::nfd); }
+#if defined(__cpp_lib_char8_t)
+/// \ingroup CTSTR_UNICODE
+inline std::u8string nfd(std::u8string_view str) { return detail::normalize_string(str, detail::unicode_form::nfd); }
+#endif
+
+}
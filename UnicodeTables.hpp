@@ -0,0 +1,920 @@
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+
+// Generated by tools/unicode_tables.py from the Unicode 14.0.0 data.  Don't edit it by hand.
+
+#pragma once
+
+#include <cstdint>
+
+#define CTSTR_UNICODE_VERSION "14.0.0"
+
+/// \cond INTERNAL
+namespace ctstr
+{
+namespace detail
+{
+	// (code point << 8) | canonical combining class, for every code point whose class isn't 0.
+	inline constexpr std::uint32_t unicode_combining_classes[] =
+	{
+		0x300e6, 0x301e6, 0x302e6, 0x303e6, 0x304e6, 0x305e6, 0x306e6, 0x307e6,
+		0x308e6, 0x309e6, 0x30ae6, 0x30be6, 0x30ce6, 0x30de6, 0x30ee6, 0x30fe6,
+		0x310e6, 0x311e6, 0x312e6, 0x313e6, 0x314e6, 0x315e8, 0x316dc, 0x317dc,
+		0x318dc, 0x319dc, 0x31ae8, 0x31bd8, 0x31cdc, 0x31ddc, 0x31edc, 0x31fdc,
+		0x320dc, 0x321ca, 0x322ca, 0x323dc, 0x324dc, 0x325dc, 0x326dc, 0x327ca,
+		0x328ca, 0x329dc, 0x32adc, 0x32bdc, 0x32cdc, 0x32ddc, 0x32edc, 0x32fdc,
+		0x330dc, 0x331dc, 0x332dc, 0x333dc, 0x33401, 0x33501, 0x33601, 0x33701,
+		0x33801, 0x339dc, 0x33adc, 0x33bdc, 0x33cdc, 0x33de6, 0x33ee6, 0x33fe6,
+		0x340e6, 0x341e6, 0x342e6, 0x343e6, 0x344e6, 0x345f0, 0x346e6, 0x347dc,
+		0x348dc, 0x349dc, 0x34ae6, 0x34be6, 0x34ce6, 0x34ddc, 0x34edc, 0x350e6,
+		0x351e6, 0x352e6, 0x353dc, 0x354dc, 0x355dc, 0x356dc, 0x357e6, 0x358e8,
+		0x359dc, 0x35adc, 0x35be6, 0x35ce9, 0x35dea, 0x35eea, 0x35fe9, 0x360ea,
+		0x361ea, 0x362e9, 0x363e6, 0x364e6, 0x365e6, 0x366e6, 0x367e6, 0x368e6,
+		0x369e6, 0x36ae6, 0x36be6, 0x36ce6, 0x36de6, 0x36ee6, 0x36fe6, 0x483e6,
+		0x484e6, 0x485e6, 0x486e6, 0x487e6, 0x591dc, 0x592e6, 0x593e6, 0x594e6,
+		0x595e6, 0x596dc, 0x597e6, 0x598e6, 0x599e6, 0x59ade, 0x59bdc, 0x59ce6,
+		0x59de6, 0x59ee6, 0x59fe6, 0x5a0e6, 0x5a1e6, 0x5a2dc, 0x5a3dc, 0x5a4dc,
+		0x5a5dc, 0x5a6dc, 0x5a7dc, 0x5a8e6, 0x5a9e6, 0x5aadc, 0x5abe6, 0x5ace6,
+		0x5adde, 0x5aee4, 0x5afe6, 0x5b00a, 0x5b10b, 0x5b20c, 0x5b30d, 0x5b40e,
+		0x5b50f, 0x5b610, 0x5b711, 0x5b812, 0x5b913, 0x5ba13, 0x5bb14, 0x5bc15,
+		0x5bd16, 0x5bf17, 0x5c118, 0x5c219, 0x5c4e6, 0x5c5dc, 0x5c712, 0x610e6,
+		0x611e6, 0x612e6, 0x613e6, 0x614e6, 0x615e6, 0x616e6, 0x617e6, 0x6181e,
+		0x6191f, 0x61a20, 0x64b1b, 0x64c1c, 0x64d1d, 0x64e1e, 0x64f1f, 0x65020,
+		0x65121, 0x65222, 0x653e6, 0x654e6, 0x655dc, 0x656dc, 0x657e6, 0x658e6,
+		0x659e6, 0x65ae6, 0x65be6, 0x65cdc, 0x65de6, 0x65ee6, 0x65fdc, 0x67023,
+		0x6d6e6, 0x6d7e6, 0x6d8e6, 0x6d9e6, 0x6dae6, 0x6dbe6, 0x6dce6, 0x6dfe6,
+		0x6e0e6, 0x6e1e6, 0x6e2e6, 0x6e3dc, 0x6e4e6, 0x6e7e6, 0x6e8e6, 0x6eadc,
+		0x6ebe6, 0x6ece6, 0x6eddc, 0x71124, 0x730e6, 0x731dc, 0x732e6, 0x733e6,
+		0x734dc, 0x735e6, 0x736e6, 0x737dc, 0x738dc, 0x739dc, 0x73ae6, 0x73bdc,
+		0x73cdc, 0x73de6, 0x73edc, 0x73fe6, 0x740e6, 0x741e6, 0x742dc, 0x743e6,
+		0x744dc, 0x745e6, 0x746dc, 0x747e6, 0x748dc, 0x749e6, 0x74ae6, 0x7ebe6,
+		0x7ece6, 0x7ede6, 0x7eee6, 0x7efe6, 0x7f0e6, 0x7f1e6, 0x7f2dc, 0x7f3e6,
+		0x7fddc, 0x816e6, 0x817e6, 0x818e6, 0x819e6, 0x81be6, 0x81ce6, 0x81de6,
+		0x81ee6, 0x81fe6, 0x820e6, 0x821e6, 0x822e6, 0x823e6, 0x825e6, 0x826e6,
+		0x827e6, 0x829e6, 0x82ae6, 0x82be6, 0x82ce6, 0x82de6, 0x859dc, 0x85adc,
+		0x85bdc, 0x898e6, 0x899dc, 0x89adc, 0x89bdc, 0x89ce6, 0x89de6, 0x89ee6,
+		0x89fe6, 0x8cae6, 0x8cbe6, 0x8cce6, 0x8cde6, 0x8cee6, 0x8cfdc, 0x8d0dc,
+		0x8d1dc, 0x8d2dc, 0x8d3dc, 0x8d4e6, 0x8d5e6, 0x8d6e6, 0x8d7e6, 0x8d8e6,
+		0x8d9e6, 0x8dae6, 0x8dbe6, 0x8dce6, 0x8dde6, 0x8dee6, 0x8dfe6, 0x8e0e6,
+		0x8e1e6, 0x8e3dc, 0x8e4e6, 0x8e5e6, 0x8e6dc, 0x8e7e6, 0x8e8e6, 0x8e9dc,
+		0x8eae6, 0x8ebe6, 0x8ece6, 0x8eddc, 0x8eedc, 0x8efdc, 0x8f01b, 0x8f11c,
+		0x8f21d, 0x8f3e6, 0x8f4e6, 0x8f5e6, 0x8f6dc, 0x8f7e6, 0x8f8e6, 0x8f9dc,
+		0x8fadc, 0x8fbe6, 0x8fce6, 0x8fde6, 0x8fee6, 0x8ffe6, 0x93c07, 0x94d09,
+		0x951e6, 0x952dc, 0x953e6, 0x954e6, 0x9bc07, 0x9cd09, 0x9fee6, 0xa3c07,
+		0xa4d09, 0xabc07, 0xacd09, 0xb3c07, 0xb4d09, 0xbcd09, 0xc3c07, 0xc4d09,
+		0xc5554, 0xc565b, 0xcbc07, 0xccd09, 0xd3b09, 0xd3c09, 0xd4d09, 0xdca09,
+		0xe3867, 0xe3967, 0xe3a09, 0xe486b, 0xe496b, 0xe4a6b, 0xe4b6b, 0xeb876,
+		0xeb976, 0xeba09, 0xec87a, 0xec97a, 0xeca7a, 0xecb7a, 0xf18dc, 0xf19dc,
+		0xf35dc, 0xf37dc, 0xf39d8, 0xf7181, 0xf7282, 0xf7484, 0xf7a82, 0xf7b82,
+		0xf7c82, 0xf7d82, 0xf8082, 0xf82e6, 0xf83e6, 0xf8409, 0xf86e6, 0xf87e6,
+		0xfc6dc, 0x103707, 0x103909, 0x103a09, 0x108ddc, 0x135de6, 0x135ee6, 0x135fe6,
+		0x171409, 0x171509, 0x173409, 0x17d209, 0x17dde6, 0x18a9e4, 0x1939de, 0x193ae6,
+		0x193bdc, 0x1a17e6, 0x1a18dc, 0x1a6009, 0x1a75e6, 0x1a76e6, 0x1a77e6, 0x1a78e6,
+		0x1a79e6, 0x1a7ae6, 0x1a7be6, 0x1a7ce6, 0x1a7fdc, 0x1ab0e6, 0x1ab1e6, 0x1ab2e6,
+		0x1ab3e6, 0x1ab4e6, 0x1ab5dc, 0x1ab6dc, 0x1ab7dc, 0x1ab8dc, 0x1ab9dc, 0x1abadc,
+		0x1abbe6, 0x1abce6, 0x1abddc, 0x1abfdc, 0x1ac0dc, 0x1ac1e6, 0x1ac2e6, 0x1ac3dc,
+		0x1ac4dc, 0x1ac5e6, 0x1ac6e6, 0x1ac7e6, 0x1ac8e6, 0x1ac9e6, 0x1acadc, 0x1acbe6,
+		0x1acce6, 0x1acde6, 0x1acee6, 0x1b3407, 0x1b4409, 0x1b6be6, 0x1b6cdc, 0x1b6de6,
+		0x1b6ee6, 0x1b6fe6, 0x1b70e6, 0x1b71e6, 0x1b72e6, 0x1b73e6, 0x1baa09, 0x1bab09,
+		0x1be607, 0x1bf209, 0x1bf309, 0x1c3707, 0x1cd0e6, 0x1cd1e6, 0x1cd2e6, 0x1cd401,
+		0x1cd5dc, 0x1cd6dc, 0x1cd7dc, 0x1cd8dc, 0x1cd9dc, 0x1cdae6, 0x1cdbe6, 0x1cdcdc,
+		0x1cdddc, 0x1cdedc, 0x1cdfdc, 0x1ce0e6, 0x1ce201, 0x1ce301, 0x1ce401, 0x1ce501,
+		0x1ce601, 0x1ce701, 0x1ce801, 0x1ceddc, 0x1cf4e6, 0x1cf8e6, 0x1cf9e6, 0x1dc0e6,
+		0x1dc1e6, 0x1dc2dc, 0x1dc3e6, 0x1dc4e6, 0x1dc5e6, 0x1dc6e6, 0x1dc7e6, 0x1dc8e6,
+		0x1dc9e6, 0x1dcadc, 0x1dcbe6, 0x1dcce6, 0x1dcdea, 0x1dced6, 0x1dcfdc, 0x1dd0ca,
+		0x1dd1e6, 0x1dd2e6, 0x1dd3e6, 0x1dd4e6, 0x1dd5e6, 0x1dd6e6, 0x1dd7e6, 0x1dd8e6,
+		0x1dd9e6, 0x1ddae6, 0x1ddbe6, 0x1ddce6, 0x1ddde6, 0x1ddee6, 0x1ddfe6, 0x1de0e6,
+		0x1de1e6, 0x1de2e6, 0x1de3e6, 0x1de4e6, 0x1de5e6, 0x1de6e6, 0x1de7e6, 0x1de8e6,
+		0x1de9e6, 0x1deae6, 0x1debe6, 0x1dece6, 0x1dede6, 0x1deee6, 0x1defe6, 0x1df0e6,
+		0x1df1e6, 0x1df2e6, 0x1df3e6, 0x1df4e6, 0x1df5e6, 0x1df6e8, 0x1df7e4, 0x1df8e4,
+		0x1df9dc, 0x1dfada, 0x1dfbe6, 0x1dfce9, 0x1dfddc, 0x1dfee6, 0x1dffdc, 0x20d0e6,
+		0x20d1e6, 0x20d201, 0x20d301, 0x20d4e6, 0x20d5e6, 0x20d6e6, 0x20d7e6, 0x20d801,
+		0x20d901, 0x20da01, 0x20dbe6, 0x20dce6, 0x20e1e6, 0x20e501, 0x20e601, 0x20e7e6,
+		0x20e8dc, 0x20e9e6, 0x20ea01, 0x20eb01, 0x20ecdc, 0x20eddc, 0x20eedc, 0x20efdc,
+		0x20f0e6, 0x2cefe6, 0x2cf0e6, 0x2cf1e6, 0x2d7f09, 0x2de0e6, 0x2de1e6, 0x2de2e6,
+		0x2de3e6, 0x2de4e6, 0x2de5e6, 0x2de6e6, 0x2de7e6, 0x2de8e6, 0x2de9e6, 0x2deae6,
+		0x2debe6, 0x2dece6, 0x2dede6, 0x2deee6, 0x2defe6, 0x2df0e6, 0x2df1e6, 0x2df2e6,
+		0x2df3e6, 0x2df4e6, 0x2df5e6, 0x2df6e6, 0x2df7e6, 0x2df8e6, 0x2df9e6, 0x2dfae6,
+		0x2dfbe6, 0x2dfce6, 0x2dfde6, 0x2dfee6, 0x2dffe6, 0x302ada, 0x302be4, 0x302ce8,
+		0x302dde, 0x302ee0, 0x302fe0, 0x309908, 0x309a08, 0xa66fe6, 0xa674e6, 0xa675e6,
+		0xa676e6, 0xa677e6, 0xa678e6, 0xa679e6, 0xa67ae6, 0xa67be6, 0xa67ce6, 0xa67de6,
+		0xa69ee6, 0xa69fe6, 0xa6f0e6, 0xa6f1e6, 0xa80609, 0xa82c09, 0xa8c409, 0xa8e0e6,
+		0xa8e1e6, 0xa8e2e6, 0xa8e3e6, 0xa8e4e6, 0xa8e5e6, 0xa8e6e6, 0xa8e7e6, 0xa8e8e6,
+		0xa8e9e6, 0xa8eae6, 0xa8ebe6, 0xa8ece6, 0xa8ede6, 0xa8eee6, 0xa8efe6, 0xa8f0e6,
+		0xa8f1e6, 0xa92bdc, 0xa92cdc, 0xa92ddc, 0xa95309, 0xa9b307, 0xa9c009, 0xaab0e6,
+		0xaab2e6, 0xaab3e6, 0xaab4dc, 0xaab7e6, 0xaab8e6, 0xaabee6, 0xaabfe6, 0xaac1e6,
+		0xaaf609, 0xabed09, 0xfb1e1a, 0xfe20e6, 0xfe21e6, 0xfe22e6, 0xfe23e6, 0xfe24e6,
+		0xfe25e6, 0xfe26e6, 0xfe27dc, 0xfe28dc, 0xfe29dc, 0xfe2adc, 0xfe2bdc, 0xfe2cdc,
+		0xfe2ddc, 0xfe2ee6, 0xfe2fe6, 0x101fddc, 0x102e0dc, 0x10376e6, 0x10377e6, 0x10378e6,
+		0x10379e6, 0x1037ae6, 0x10a0ddc, 0x10a0fe6, 0x10a38e6, 0x10a3901, 0x10a3adc, 0x10a3f09,
+		0x10ae5e6, 0x10ae6dc, 0x10d24e6, 0x10d25e6, 0x10d26e6, 0x10d27e6, 0x10eabe6, 0x10eace6,
+		0x10f46dc, 0x10f47dc, 0x10f48e6, 0x10f49e6, 0x10f4ae6, 0x10f4bdc, 0x10f4ce6, 0x10f4ddc,
+		0x10f4edc, 0x10f4fdc, 0x10f50dc, 0x10f82e6, 0x10f83dc, 0x10f84e6, 0x10f85dc, 0x1104609,
+		0x1107009, 0x1107f09, 0x110b909, 0x110ba07, 0x11100e6, 0x11101e6, 0x11102e6, 0x1113309,
+		0x1113409, 0x1117307, 0x111c009, 0x111ca07, 0x1123509, 0x1123607, 0x112e907, 0x112ea09,
+		0x1133b07, 0x1133c07, 0x1134d09, 0x11366e6, 0x11367e6, 0x11368e6, 0x11369e6, 0x1136ae6,
+		0x1136be6, 0x1136ce6, 0x11370e6, 0x11371e6, 0x11372e6, 0x11373e6, 0x11374e6, 0x1144209,
+		0x1144607, 0x1145ee6, 0x114c209, 0x114c307, 0x115bf09, 0x115c007, 0x1163f09, 0x116b609,
+		0x116b707, 0x1172b09, 0x1183909, 0x1183a07, 0x1193d09, 0x1193e09, 0x1194307, 0x119e009,
+		0x11a3409, 0x11a4709, 0x11a9909, 0x11c3f09, 0x11d4207, 0x11d4409, 0x11d4509, 0x11d9709,
+		0x16af001, 0x16af101, 0x16af201, 0x16af301, 0x16af401, 0x16b30e6, 0x16b31e6, 0x16b32e6,
+		0x16b33e6, 0x16b34e6, 0x16b35e6, 0x16b36e6, 0x16ff006, 0x16ff106, 0x1bc9e01, 0x1d165d8,
+		0x1d166d8, 0x1d16701, 0x1d16801, 0x1d16901, 0x1d16de2, 0x1d16ed8, 0x1d16fd8, 0x1d170d8,
+		0x1d171d8, 0x1d172d8, 0x1d17bdc, 0x1d17cdc, 0x1d17ddc, 0x1d17edc, 0x1d17fdc, 0x1d180dc,
+		0x1d181dc, 0x1d182dc, 0x1d185e6, 0x1d186e6, 0x1d187e6, 0x1d188e6, 0x1d189e6, 0x1d18adc,
+		0x1d18bdc, 0x1d1aae6, 0x1d1abe6, 0x1d1ace6, 0x1d1ade6, 0x1d242e6, 0x1d243e6, 0x1d244e6,
+		0x1e000e6, 0x1e001e6, 0x1e002e6, 0x1e003e6, 0x1e004e6, 0x1e005e6, 0x1e006e6, 0x1e008e6,
+		0x1e009e6, 0x1e00ae6, 0x1e00be6, 0x1e00ce6, 0x1e00de6, 0x1e00ee6, 0x1e00fe6, 0x1e010e6,
+		0x1e011e6, 0x1e012e6, 0x1e013e6, 0x1e014e6, 0x1e015e6, 0x1e016e6, 0x1e017e6, 0x1e018e6,
+		0x1e01be6, 0x1e01ce6, 0x1e01de6, 0x1e01ee6, 0x1e01fe6, 0x1e020e6, 0x1e021e6, 0x1e023e6,
+		0x1e024e6, 0x1e026e6, 0x1e027e6, 0x1e028e6, 0x1e029e6, 0x1e02ae6, 0x1e130e6, 0x1e131e6,
+		0x1e132e6, 0x1e133e6, 0x1e134e6, 0x1e135e6, 0x1e136e6, 0x1e2aee6, 0x1e2ece6, 0x1e2ede6,
+		0x1e2eee6, 0x1e2efe6, 0x1e8d0dc, 0x1e8d1dc, 0x1e8d2dc, 0x1e8d3dc, 0x1e8d4dc, 0x1e8d5dc,
+		0x1e8d6dc, 0x1e944e6, 0x1e945e6, 0x1e946e6, 0x1e947e6, 0x1e948e6, 0x1e949e6, 0x1e94a07,
+	};
+
+	// (code point << 42) | (first << 21) | second: single-level canonical decompositions, second is 0 for singletons.
+	inline constexpr std::uint64_t unicode_decompositions[] =
+	{
+		0x3000008200300ull, 0x3040008200301ull, 0x3080008200302ull, 0x30c0008200303ull,
+		0x3100008200308ull, 0x314000820030aull, 0x31c0008600327ull, 0x3200008a00300ull,
+		0x3240008a00301ull, 0x3280008a00302ull, 0x32c0008a00308ull, 0x3300009200300ull,
+		0x3340009200301ull, 0x3380009200302ull, 0x33c0009200308ull, 0x3440009c00303ull,
+		0x3480009e00300ull, 0x34c0009e00301ull, 0x3500009e00302ull, 0x3540009e00303ull,
+		0x3580009e00308ull, 0x364000aa00300ull, 0x368000aa00301ull, 0x36c000aa00302ull,
+		0x370000aa00308ull, 0x374000b200301ull, 0x380000c200300ull, 0x384000c200301ull,
+		0x388000c200302ull, 0x38c000c200303ull, 0x390000c200308ull, 0x394000c20030aull,
+		0x39c000c600327ull, 0x3a0000ca00300ull, 0x3a4000ca00301ull, 0x3a8000ca00302ull,
+		0x3ac000ca00308ull, 0x3b0000d200300ull, 0x3b4000d200301ull, 0x3b8000d200302ull,
+		0x3bc000d200308ull, 0x3c4000dc00303ull, 0x3c8000de00300ull, 0x3cc000de00301ull,
+		0x3d0000de00302ull, 0x3d4000de00303ull, 0x3d8000de00308ull, 0x3e4000ea00300ull,
+		0x3e8000ea00301ull, 0x3ec000ea00302ull, 0x3f0000ea00308ull, 0x3f4000f200301ull,
+		0x3fc000f200308ull, 0x4000008200304ull, 0x404000c200304ull, 0x4080008200306ull,
+		0x40c000c200306ull, 0x4100008200328ull, 0x414000c200328ull, 0x4180008600301ull,
+		0x41c000c600301ull, 0x4200008600302ull, 0x424000c600302ull, 0x4280008600307ull,
+		0x42c000c600307ull, 0x430000860030cull, 0x434000c60030cull, 0x438000880030cull,
+		0x43c000c80030cull, 0x4480008a00304ull, 0x44c000ca00304ull, 0x4500008a00306ull,
+		0x454000ca00306ull, 0x4580008a00307ull, 0x45c000ca00307ull, 0x4600008a00328ull,
+		0x464000ca00328ull, 0x4680008a0030cull, 0x46c000ca0030cull, 0x4700008e00302ull,
+		0x474000ce00302ull, 0x4780008e00306ull, 0x47c000ce00306ull, 0x4800008e00307ull,
+		0x484000ce00307ull, 0x4880008e00327ull, 0x48c000ce00327ull, 0x4900009000302ull,
+		0x494000d000302ull, 0x4a00009200303ull, 0x4a4000d200303ull, 0x4a80009200304ull,
+		0x4ac000d200304ull, 0x4b00009200306ull, 0x4b4000d200306ull, 0x4b80009200328ull,
+		0x4bc000d200328ull, 0x4c00009200307ull, 0x4d00009400302ull, 0x4d4000d400302ull,
+		0x4d80009600327ull, 0x4dc000d600327ull, 0x4e40009800301ull, 0x4e8000d800301ull,
+		0x4ec0009800327ull, 0x4f0000d800327ull, 0x4f4000980030cull, 0x4f8000d80030cull,
+		0x50c0009c00301ull, 0x510000dc00301ull, 0x5140009c00327ull, 0x518000dc00327ull,
+		0x51c0009c0030cull, 0x520000dc0030cull, 0x5300009e00304ull, 0x534000de00304ull,
+		0x5380009e00306ull, 0x53c000de00306ull, 0x5400009e0030bull, 0x544000de0030bull,
+		0x550000a400301ull, 0x554000e400301ull, 0x558000a400327ull, 0x55c000e400327ull,
+		0x560000a40030cull, 0x564000e40030cull, 0x568000a600301ull, 0x56c000e600301ull,
+		0x570000a600302ull, 0x574000e600302ull, 0x578000a600327ull, 0x57c000e600327ull,
+		0x580000a60030cull, 0x584000e60030cull, 0x588000a800327ull, 0x58c000e800327ull,
+		0x590000a80030cull, 0x594000e80030cull, 0x5a0000aa00303ull, 0x5a4000ea00303ull,
+		0x5a8000aa00304ull, 0x5ac000ea00304ull, 0x5b0000aa00306ull, 0x5b4000ea00306ull,
+		0x5b8000aa0030aull, 0x5bc000ea0030aull, 0x5c0000aa0030bull, 0x5c4000ea0030bull,
+		0x5c8000aa00328ull, 0x5cc000ea00328ull, 0x5d0000ae00302ull, 0x5d4000ee00302ull,
+		0x5d8000b200302ull, 0x5dc000f200302ull, 0x5e0000b200308ull, 0x5e4000b400301ull,
+		0x5e8000f400301ull, 0x5ec000b400307ull, 0x5f0000f400307ull, 0x5f4000b40030cull,
+		0x5f8000f40030cull, 0x6800009e0031bull, 0x684000de0031bull, 0x6bc000aa0031bull,
+		0x6c0000ea0031bull, 0x734000820030cull, 0x738000c20030cull, 0x73c000920030cull,
+		0x740000d20030cull, 0x7440009e0030cull, 0x748000de0030cull, 0x74c000aa0030cull,
+		0x750000ea0030cull, 0x754001b800304ull, 0x758001f800304ull, 0x75c001b800301ull,
+		0x760001f800301ull, 0x764001b80030cull, 0x768001f80030cull, 0x76c001b800300ull,
+		0x770001f800300ull, 0x7780018800304ull, 0x77c001c800304ull, 0x7800044c00304ull,
+		0x7840044e00304ull, 0x7880018c00304ull, 0x78c001cc00304ull, 0x7980008e0030cull,
+		0x79c000ce0030cull, 0x7a0000960030cull, 0x7a4000d60030cull, 0x7a80009e00328ull,
+		0x7ac000de00328ull, 0x7b0003d400304ull, 0x7b4003d600304ull, 0x7b80036e0030cull,
+		0x7bc005240030cull, 0x7c0000d40030cull, 0x7d00008e00301ull, 0x7d4000ce00301ull,
+		0x7e00009c00300ull, 0x7e4000dc00300ull, 0x7e80018a00301ull, 0x7ec001ca00301ull,
+		0x7f00018c00301ull, 0x7f4001cc00301ull, 0x7f8001b000301ull, 0x7fc001f000301ull,
+		0x800000820030full, 0x804000c20030full, 0x8080008200311ull, 0x80c000c200311ull,
+		0x8100008a0030full, 0x814000ca0030full, 0x8180008a00311ull, 0x81c000ca00311ull,
+		0x820000920030full, 0x824000d20030full, 0x8280009200311ull, 0x82c000d200311ull,
+		0x8300009e0030full, 0x834000de0030full, 0x8380009e00311ull, 0x83c000de00311ull,
+		0x840000a40030full, 0x844000e40030full, 0x848000a400311ull, 0x84c000e400311ull,
+		0x850000aa0030full, 0x854000ea0030full, 0x858000aa00311ull, 0x85c000ea00311ull,
+		0x860000a600326ull, 0x864000e600326ull, 0x868000a800326ull, 0x86c000e800326ull,
+		0x878000900030cull, 0x87c000d00030cull, 0x8980008200307ull, 0x89c000c200307ull,
+		0x8a00008a00327ull, 0x8a4000ca00327ull, 0x8a8001ac00304ull, 0x8ac001ec00304ull,
+		0x8b0001aa00304ull, 0x8b4001ea00304ull, 0x8b80009e00307ull, 0x8bc000de00307ull,
+		0x8c00045c00304ull, 0x8c40045e00304ull, 0x8c8000b200304ull, 0x8cc000f200304ull,
+		0xd000060000000ull, 0xd040060200000ull, 0xd0c0062600000ull, 0xd100061000301ull,
+		0xdd00057200000ull, 0xdf80007600000ull, 0xe140015000301ull, 0xe180072200301ull,
+		0xe1c0016e00000ull, 0xe200072a00301ull, 0xe240072e00301ull, 0xe280073200301ull,
+		0xe300073e00301ull, 0xe380074a00301ull, 0xe3c0075200301ull, 0xe400079400301ull,
+		0xea80073200308ull, 0xeac0074a00308ull, 0xeb00076200301ull, 0xeb40076a00301ull,
+		0xeb80076e00301ull, 0xebc0077200301ull, 0xec00079600301ull, 0xf280077200308ull,
+		0xf2c0078a00308ull, 0xf300077e00301ull, 0xf340078a00301ull, 0xf380079200301ull,
+		0xf4c007a400301ull, 0xf50007a400308ull, 0x10000082a00300ull, 0x10040082a00308ull,
+		0x100c0082600301ull, 0x101c0080c00308ull, 0x10300083400301ull, 0x10340083000300ull,
+		0x10380084600306ull, 0x10640083000306ull, 0x10e40087000306ull, 0x11400086a00300ull,
+		0x11440086a00308ull, 0x114c0086600301ull, 0x115c008ac00308ull, 0x11700087400301ull,
+		0x11740087000300ull, 0x11780088600306ull, 0x11d8008e80030full, 0x11dc008ea0030full,
+		0x13040082c00306ull, 0x13080086c00306ull, 0x13400082000306ull, 0x13440086000306ull,
+		0x13480082000308ull, 0x134c0086000308ull, 0x13580082a00306ull, 0x135c0086a00306ull,
+		0x1368009b000308ull, 0x136c009b200308ull, 0x13700082c00308ull, 0x13740086c00308ull,
+		0x13780082e00308ull, 0x137c0086e00308ull, 0x13880083000304ull, 0x138c0087000304ull,
+		0x13900083000308ull, 0x13940087000308ull, 0x13980083c00308ull, 0x139c0087c00308ull,
+		0x13a8009d000308ull, 0x13ac009d200308ull, 0x13b00085a00308ull, 0x13b40089a00308ull,
+		0x13b80084600304ull, 0x13bc0088600304ull, 0x13c00084600308ull, 0x13c40088600308ull,
+		0x13c8008460030bull, 0x13cc008860030bull, 0x13d00084e00308ull, 0x13d40088e00308ull,
+		0x13e00085600308ull, 0x13e40089600308ull, 0x188800c4e00653ull, 0x188c00c4e00654ull,
+		0x189000c9000654ull, 0x189400c4e00655ull, 0x189800c9400654ull, 0x1b0000daa00654ull,
+		0x1b0800d8200654ull, 0x1b4c00da400654ull, 0x24a4012500093cull, 0x24c4012600093cull,
+		0x24d0012660093cull, 0x25600122a0093cull, 0x25640122c0093cull, 0x25680122e0093cull,
+		0x256c012380093cull, 0x2570012420093cull, 0x2574012440093cull, 0x2578012560093cull,
+		0x257c0125e0093cull, 0x272c0138e009beull, 0x27300138e009d7ull, 0x277001342009bcull,
+		0x277401344009bcull, 0x277c0135e009bcull, 0x28cc0146400a3cull, 0x28d80147000a3cull,
+		0x29640142c00a3cull, 0x29680142e00a3cull, 0x296c0143800a3cull, 0x29780145600a3cull,
+		0x2d200168e00b56ull, 0x2d2c0168e00b3eull, 0x2d300168e00b57ull, 0x2d700164200b3cull,
+		0x2d740164400b3cull, 0x2e500172400bd7ull, 0x2f280178c00bbeull, 0x2f2c0178e00bbeull,
+		0x2f300178c00bd7ull, 0x31200188c00c56ull, 0x33000197e00cd5ull, 0x331c0198c00cd5ull,
+		0x33200198c00cd6ull, 0x33280198c00cc2ull, 0x332c0199400cd5ull, 0x352801a8c00d3eull,
+		0x352c01a8e00d3eull, 0x353001a8c00d57ull, 0x376801bb200dcaull, 0x377001bb200dcfull,
+		0x377401bb800dcaull, 0x377801bb200ddfull, 0x3d0c01e8400fb7ull, 0x3d3401e9800fb7ull,
+		0x3d4801ea200fb7ull, 0x3d5c01eac00fb7ull, 0x3d7001eb600fb7ull, 0x3da401e8000fb5ull,
+		0x3dcc01ee200f72ull, 0x3dd401ee200f74ull, 0x3dd801f6400f80ull, 0x3de001f6600f80ull,
+		0x3e0401ee200f80ull, 0x3e4c01f2400fb7ull, 0x3e7401f3800fb7ull, 0x3e8801f4200fb7ull,
+		0x3e9c01f4c00fb7ull, 0x3eb001f5600fb7ull, 0x3ee401f2000fb5ull, 0x40980204a0102eull,
+		0x6c180360a01b35ull, 0x6c200360e01b35ull, 0x6c280361201b35ull, 0x6c300361601b35ull,
+		0x6c380361a01b35ull, 0x6c480362201b35ull, 0x6cec0367401b35ull, 0x6cf40367801b35ull,
+		0x6d000367c01b35ull, 0x6d040367e01b35ull, 0x6d0c0368401b35ull, 0x78000008200325ull,
+		0x7804000c200325ull, 0x78080008400307ull, 0x780c000c400307ull, 0x78100008400323ull,
+		0x7814000c400323ull, 0x78180008400331ull, 0x781c000c400331ull, 0x78200018e00301ull,
+		0x7824001ce00301ull, 0x78280008800307ull, 0x782c000c800307ull, 0x78300008800323ull,
+		0x7834000c800323ull, 0x78380008800331ull, 0x783c000c800331ull, 0x78400008800327ull,
+		0x7844000c800327ull, 0x7848000880032dull, 0x784c000c80032dull, 0x78500022400300ull,
+		0x78540022600300ull, 0x78580022400301ull, 0x785c0022600301ull, 0x78600008a0032dull,
+		0x7864000ca0032dull, 0x78680008a00330ull, 0x786c000ca00330ull, 0x78700045000306ull,
+		0x78740045200306ull, 0x78780008c00307ull, 0x787c000cc00307ull, 0x78800008e00304ull,
+		0x7884000ce00304ull, 0x78880009000307ull, 0x788c000d000307ull, 0x78900009000323ull,
+		0x7894000d000323ull, 0x78980009000308ull, 0x789c000d000308ull, 0x78a00009000327ull,
+		0x78a4000d000327ull, 0x78a8000900032eull, 0x78ac000d00032eull, 0x78b00009200330ull,
+		0x78b4000d200330ull, 0x78b80019e00301ull, 0x78bc001de00301ull, 0x78c00009600301ull,
+		0x78c4000d600301ull, 0x78c80009600323ull, 0x78cc000d600323ull, 0x78d00009600331ull,
+		0x78d4000d600331ull, 0x78d80009800323ull, 0x78dc000d800323ull, 0x78e003c6c00304ull,
+		0x78e403c6e00304ull, 0x78e80009800331ull, 0x78ec000d800331ull, 0x78f0000980032dull,
+		0x78f4000d80032dull, 0x78f80009a00301ull, 0x78fc000da00301ull, 0x79000009a00307ull,
+		0x7904000da00307ull, 0x79080009a00323ull, 0x790c000da00323ull, 0x79100009c00307ull,
+		0x7914000dc00307ull, 0x79180009c00323ull, 0x791c000dc00323ull, 0x79200009c00331ull,
+		0x7924000dc00331ull, 0x79280009c0032dull, 0x792c000dc0032dull, 0x7930001aa00301ull,
+		0x7934001ea00301ull, 0x7938001aa00308ull, 0x793c001ea00308ull, 0x79400029800300ull,
+		0x79440029a00300ull, 0x79480029800301ull, 0x794c0029a00301ull, 0x7950000a000301ull,
+		0x7954000e000301ull, 0x7958000a000307ull, 0x795c000e000307ull, 0x7960000a400307ull,
+		0x7964000e400307ull, 0x7968000a400323ull, 0x796c000e400323ull, 0x797003cb400304ull,
+		0x797403cb600304ull, 0x7978000a400331ull, 0x797c000e400331ull, 0x7980000a600307ull,
+		0x7984000e600307ull, 0x7988000a600323ull, 0x798c000e600323ull, 0x7990002b400307ull,
+		0x7994002b600307ull, 0x7998002c000307ull, 0x799c002c200307ull, 0x79a003cc400307ull,
+		0x79a403cc600307ull, 0x79a8000a800307ull, 0x79ac000e800307ull, 0x79b0000a800323ull,
+		0x79b4000e800323ull, 0x79b8000a800331ull, 0x79bc000e800331ull, 0x79c0000a80032dull,
+		0x79c4000e80032dull, 0x79c8000aa00324ull, 0x79cc000ea00324ull, 0x79d0000aa00330ull,
+		0x79d4000ea00330ull, 0x79d8000aa0032dull, 0x79dc000ea0032dull, 0x79e0002d000301ull,
+		0x79e4002d200301ull, 0x79e8002d400308ull, 0x79ec002d600308ull, 0x79f0000ac00303ull,
+		0x79f4000ec00303ull, 0x79f8000ac00323ull, 0x79fc000ec00323ull, 0x7a00000ae00300ull,
+		0x7a04000ee00300ull, 0x7a08000ae00301ull, 0x7a0c000ee00301ull, 0x7a10000ae00308ull,
+		0x7a14000ee00308ull, 0x7a18000ae00307ull, 0x7a1c000ee00307ull, 0x7a20000ae00323ull,
+		0x7a24000ee00323ull, 0x7a28000b000307ull, 0x7a2c000f000307ull, 0x7a30000b000308ull,
+		0x7a34000f000308ull, 0x7a38000b200307ull, 0x7a3c000f200307ull, 0x7a40000b400302ull,
+		0x7a44000f400302ull, 0x7a48000b400323ull, 0x7a4c000f400323ull, 0x7a50000b400331ull,
+		0x7a54000f400331ull, 0x7a58000d000331ull, 0x7a5c000e800308ull, 0x7a60000ee0030aull,
+		0x7a64000f20030aull, 0x7a6c002fe00307ull, 0x7a800008200323ull, 0x7a84000c200323ull,
+		0x7a880008200309ull, 0x7a8c000c200309ull, 0x7a900018400301ull, 0x7a94001c400301ull,
+		0x7a980018400300ull, 0x7a9c001c400300ull, 0x7aa00018400309ull, 0x7aa4001c400309ull,
+		0x7aa80018400303ull, 0x7aac001c400303ull, 0x7ab003d4000302ull, 0x7ab403d4200302ull,
+		0x7ab80020400301ull, 0x7abc0020600301ull, 0x7ac00020400300ull, 0x7ac40020600300ull,
+		0x7ac80020400309ull, 0x7acc0020600309ull, 0x7ad00020400303ull, 0x7ad40020600303ull,
+		0x7ad803d4000306ull, 0x7adc03d4200306ull, 0x7ae00008a00323ull, 0x7ae4000ca00323ull,
+		0x7ae80008a00309ull, 0x7aec000ca00309ull, 0x7af00008a00303ull, 0x7af4000ca00303ull,
+		0x7af80019400301ull, 0x7afc001d400301ull, 0x7b000019400300ull, 0x7b04001d400300ull,
+		0x7b080019400309ull, 0x7b0c001d400309ull, 0x7b100019400303ull, 0x7b14001d400303ull,
+		0x7b1803d7000302ull, 0x7b1c03d7200302ull, 0x7b200009200309ull, 0x7b24000d200309ull,
+		0x7b280009200323ull, 0x7b2c000d200323ull, 0x7b300009e00323ull, 0x7b34000de00323ull,
+		0x7b380009e00309ull, 0x7b3c000de00309ull, 0x7b40001a800301ull, 0x7b44001e800301ull,
+		0x7b48001a800300ull, 0x7b4c001e800300ull, 0x7b50001a800309ull, 0x7b54001e800309ull,
+		0x7b58001a800303ull, 0x7b5c001e800303ull, 0x7b6003d9800302ull, 0x7b6403d9a00302ull,
+		0x7b680034000301ull, 0x7b6c0034200301ull, 0x7b700034000300ull, 0x7b740034200300ull,
+		0x7b780034000309ull, 0x7b7c0034200309ull, 0x7b800034000303ull, 0x7b840034200303ull,
+		0x7b880034000323ull, 0x7b8c0034200323ull, 0x7b90000aa00323ull, 0x7b94000ea00323ull,
+		0x7b98000aa00309ull, 0x7b9c000ea00309ull, 0x7ba00035e00301ull, 0x7ba40036000301ull,
+		0x7ba80035e00300ull, 0x7bac0036000300ull, 0x7bb00035e00309ull, 0x7bb40036000309ull,
+		0x7bb80035e00303ull, 0x7bbc0036000303ull, 0x7bc00035e00323ull, 0x7bc40036000323ull,
+		0x7bc8000b200300ull, 0x7bcc000f200300ull, 0x7bd0000b200323ull, 0x7bd4000f200323ull,
+		0x7bd8000b200309ull, 0x7bdc000f200309ull, 0x7be0000b200303ull, 0x7be4000f200303ull,
+		0x7c000076200313ull, 0x7c040076200314ull, 0x7c0803e0000300ull, 0x7c0c03e0200300ull,
+		0x7c1003e0000301ull, 0x7c1403e0200301ull, 0x7c1803e0000342ull, 0x7c1c03e0200342ull,
+		0x7c200072200313ull, 0x7c240072200314ull, 0x7c2803e1000300ull, 0x7c2c03e1200300ull,
+		0x7c3003e1000301ull, 0x7c3403e1200301ull, 0x7c3803e1000342ull, 0x7c3c03e1200342ull,
+		0x7c400076a00313ull, 0x7c440076a00314ull, 0x7c4803e2000300ull, 0x7c4c03e2200300ull,
+		0x7c5003e2000301ull, 0x7c5403e2200301ull, 0x7c600072a00313ull, 0x7c640072a00314ull,
+		0x7c6803e3000300ull, 0x7c6c03e3200300ull, 0x7c7003e3000301ull, 0x7c7403e3200301ull,
+		0x7c800076e00313ull, 0x7c840076e00314ull, 0x7c8803e4000300ull, 0x7c8c03e4200300ull,
+		0x7c9003e4000301ull, 0x7c9403e4200301ull, 0x7c9803e4000342ull, 0x7c9c03e4200342ull,
+		0x7ca00072e00313ull, 0x7ca40072e00314ull, 0x7ca803e5000300ull, 0x7cac03e5200300ull,
+		0x7cb003e5000301ull, 0x7cb403e5200301ull, 0x7cb803e5000342ull, 0x7cbc03e5200342ull,
+		0x7cc00077200313ull, 0x7cc40077200314ull, 0x7cc803e6000300ull, 0x7ccc03e6200300ull,
+		0x7cd003e6000301ull, 0x7cd403e6200301ull, 0x7cd803e6000342ull, 0x7cdc03e6200342ull,
+		0x7ce00073200313ull, 0x7ce40073200314ull, 0x7ce803e7000300ull, 0x7cec03e7200300ull,
+		0x7cf003e7000301ull, 0x7cf403e7200301ull, 0x7cf803e7000342ull, 0x7cfc03e7200342ull,
+		0x7d000077e00313ull, 0x7d040077e00314ull, 0x7d0803e8000300ull, 0x7d0c03e8200300ull,
+		0x7d1003e8000301ull, 0x7d1403e8200301ull, 0x7d200073e00313ull, 0x7d240073e00314ull,
+		0x7d2803e9000300ull, 0x7d2c03e9200300ull, 0x7d3003e9000301ull, 0x7d3403e9200301ull,
+		0x7d400078a00313ull, 0x7d440078a00314ull, 0x7d4803ea000300ull, 0x7d4c03ea200300ull,
+		0x7d5003ea000301ull, 0x7d5403ea200301ull, 0x7d5803ea000342ull, 0x7d5c03ea200342ull,
+		0x7d640074a00314ull, 0x7d6c03eb200300ull, 0x7d7403eb200301ull, 0x7d7c03eb200342ull,
+		0x7d800079200313ull, 0x7d840079200314ull, 0x7d8803ec000300ull, 0x7d8c03ec200300ull,
+		0x7d9003ec000301ull, 0x7d9403ec200301ull, 0x7d9803ec000342ull, 0x7d9c03ec200342ull,
+		0x7da00075200313ull, 0x7da40075200314ull, 0x7da803ed000300ull, 0x7dac03ed200300ull,
+		0x7db003ed000301ull, 0x7db403ed200301ull, 0x7db803ed000342ull, 0x7dbc03ed200342ull,
+		0x7dc00076200300ull, 0x7dc40075800000ull, 0x7dc80076a00300ull, 0x7dcc0075a00000ull,
+		0x7dd00076e00300ull, 0x7dd40075c00000ull, 0x7dd80077200300ull, 0x7ddc0075e00000ull,
+		0x7de00077e00300ull, 0x7de40079800000ull, 0x7de80078a00300ull, 0x7dec0079a00000ull,
+		0x7df00079200300ull, 0x7df40079c00000ull, 0x7e0003e0000345ull, 0x7e0403e0200345ull,
+		0x7e0803e0400345ull, 0x7e0c03e0600345ull, 0x7e1003e0800345ull, 0x7e1403e0a00345ull,
+		0x7e1803e0c00345ull, 0x7e1c03e0e00345ull, 0x7e2003e1000345ull, 0x7e2403e1200345ull,
+		0x7e2803e1400345ull, 0x7e2c03e1600345ull, 0x7e3003e1800345ull, 0x7e3403e1a00345ull,
+		0x7e3803e1c00345ull, 0x7e3c03e1e00345ull, 0x7e4003e4000345ull, 0x7e4403e4200345ull,
+		0x7e4803e4400345ull, 0x7e4c03e4600345ull, 0x7e5003e4800345ull, 0x7e5403e4a00345ull,
+		0x7e5803e4c00345ull, 0x7e5c03e4e00345ull, 0x7e6003e5000345ull, 0x7e6403e5200345ull,
+		0x7e6803e5400345ull, 0x7e6c03e5600345ull, 0x7e7003e5800345ull, 0x7e7403e5a00345ull,
+		0x7e7803e5c00345ull, 0x7e7c03e5e00345ull, 0x7e8003ec000345ull, 0x7e8403ec200345ull,
+		0x7e8803ec400345ull, 0x7e8c03ec600345ull, 0x7e9003ec800345ull, 0x7e9403eca00345ull,
+		0x7e9803ecc00345ull, 0x7e9c03ece00345ull, 0x7ea003ed000345ull, 0x7ea403ed200345ull,
+		0x7ea803ed400345ull, 0x7eac03ed600345ull, 0x7eb003ed800345ull, 0x7eb403eda00345ull,
+		0x7eb803edc00345ull, 0x7ebc03ede00345ull, 0x7ec00076200306ull, 0x7ec40076200304ull,
+		0x7ec803ee000345ull, 0x7ecc0076200345ull, 0x7ed00075800345ull, 0x7ed80076200342ull,
+		0x7edc03f6c00345ull, 0x7ee00072200306ull, 0x7ee40072200304ull, 0x7ee80072200300ull,
+		0x7eec0070c00000ull, 0x7ef00072200345ull, 0x7ef80077200000ull, 0x7f040015000342ull,
+		0x7f0803ee800345ull, 0x7f0c0076e00345ull, 0x7f100075c00345ull, 0x7f180076e00342ull,
+		0x7f1c03f8c00345ull, 0x7f200072a00300ull, 0x7f240071000000ull, 0x7f280072e00300ull,
+		0x7f2c0071200000ull, 0x7f300072e00345ull, 0x7f3403f7e00300ull, 0x7f3803f7e00301ull,
+		0x7f3c03f7e00342ull, 0x7f400077200306ull, 0x7f440077200304ull, 0x7f480079400300ull,
+		0x7f4c0072000000ull, 0x7f580077200342ull, 0x7f5c0079400342ull, 0x7f600073200306ull,
+		0x7f640073200304ull, 0x7f680073200300ull, 0x7f6c0071400000ull, 0x7f7403ffc00300ull,
+		0x7f7803ffc00301ull, 0x7f7c03ffc00342ull, 0x7f800078a00306ull, 0x7f840078a00304ull,
+		0x7f880079600300ull, 0x7f8c0076000000ull, 0x7f900078200313ull, 0x7f940078200314ull,
+		0x7f980078a00342ull, 0x7f9c0079600342ull, 0x7fa00074a00306ull, 0x7fa40074a00304ull,
+		0x7fa80074a00300ull, 0x7fac0071c00000ull, 0x7fb00074200314ull, 0x7fb40015000300ull,
+		0x7fb80070a00000ull, 0x7fbc000c000000ull, 0x7fc803ef800345ull, 0x7fcc0079200345ull,
+		0x7fd00079c00345ull, 0x7fd80079200342ull, 0x7fdc03fec00345ull, 0x7fe00073e00300ull,
+		0x7fe40071800000ull, 0x7fe80075200300ull, 0x7fec0071e00000ull, 0x7ff00075200345ull,
+		0x7ff40016800000ull, 0x80000400400000ull, 0x80040400600000ull, 0x84980075200000ull,
+		0x84a80009600000ull, 0x84ac0018a00000ull, 0x86680432000338ull, 0x866c0432400338ull,
+		0x86b80432800338ull, 0x8734043a000338ull, 0x8738043a800338ull, 0x873c043a400338ull,
+		0x88100440600338ull, 0x88240441000338ull, 0x88300441600338ull, 0x88900444600338ull,
+		0x88980444a00338ull, 0x89040447800338ull, 0x89100448600338ull, 0x891c0448a00338ull,
+		0x89240449000338ull, 0x89800007a00338ull, 0x8988044c200338ull, 0x89b40449a00338ull,
+		0x89b80007800338ull, 0x89bc0007c00338ull, 0x89c0044c800338ull, 0x89c4044ca00338ull,
+		0x89d0044e400338ull, 0x89d4044e600338ull, 0x89e0044ec00338ull, 0x89e4044ee00338ull,
+		0x8a00044f400338ull, 0x8a04044f600338ull, 0x8a100450400338ull, 0x8a140450600338ull,
+		0x8a200450c00338ull, 0x8a240450e00338ull, 0x8ab00454400338ull, 0x8ab40455000338ull,
+		0x8ab80455200338ull, 0x8abc0455600338ull, 0x8b80044f800338ull, 0x8b84044fa00338ull,
+		0x8b880452200338ull, 0x8b8c0452400338ull, 0x8ba80456400338ull, 0x8bac0456600338ull,
+		0x8bb00456800338ull, 0x8bb40456a00338ull, 0x8ca40601000000ull, 0x8ca80601200000ull,
+		0xab70055ba00338ull, 0xc1300609603099ull, 0xc1380609a03099ull, 0xc1400609e03099ull,
+		0xc148060a203099ull, 0xc150060a603099ull, 0xc158060aa03099ull, 0xc160060ae03099ull,
+		0xc168060b203099ull, 0xc170060b603099ull, 0xc178060ba03099ull, 0xc180060be03099ull,
+		0xc188060c203099ull, 0xc194060c803099ull, 0xc19c060cc03099ull, 0xc1a4060d003099ull,
+		0xc1c0060de03099ull, 0xc1c4060de0309aull, 0xc1cc060e403099ull, 0xc1d0060e40309aull,
+		0xc1d8060ea03099ull, 0xc1dc060ea0309aull, 0xc1e4060f003099ull, 0xc1e8060f00309aull,
+		0xc1f0060f603099ull, 0xc1f4060f60309aull, 0xc2500608c03099ull, 0xc2780613a03099ull,
+		0xc2b00615603099ull, 0xc2b80615a03099ull, 0xc2c00615e03099ull, 0xc2c80616203099ull,
+		0xc2d00616603099ull, 0xc2d80616a03099ull, 0xc2e00616e03099ull, 0xc2e80617203099ull,
+		0xc2f00617603099ull, 0xc2f80617a03099ull, 0xc3000617e03099ull, 0xc3080618203099ull,
+		0xc3140618803099ull, 0xc31c0618c03099ull, 0xc3240619003099ull, 0xc3400619e03099ull,
+		0xc3440619e0309aull, 0xc34c061a403099ull, 0xc350061a40309aull, 0xc358061aa03099ull,
+		0xc35c061aa0309aull, 0xc364061b003099ull, 0xc368061b00309aull, 0xc370061b603099ull,
+		0xc374061b60309aull, 0xc3d00614c03099ull, 0xc3dc061de03099ull, 0xc3e0061e003099ull,
+		0xc3e4061e203099ull, 0xc3e8061e403099ull, 0xc3f8061fa03099ull, 0x3e4001189000000ull,
+		0x3e4040cde800000ull, 0x3e40811d9400000ull, 0x3e40c1199000000ull, 0x3e4100dda200000ull,
+		0x3e41409c6400000ull, 0x3e4180a7ca00000ull, 0x3e41c13f3800000ull, 0x3e42013f3800000ull,
+		0x3e4240b2a200000ull, 0x3e428123a200000ull, 0x3e42c0ab0e00000ull, 0x3e4300b29000000ull,
+		0x3e4340c3ec00000ull, 0x3e4380ecd200000ull, 0x3e43c0ff0a00000ull, 0x3e44010c7e00000ull,
+		0x3e44410f7400000ull, 0x3e448111f000000ull, 0x3e44c1211e00000ull, 0x3e4500d40400000ull,
+		0x3e4540da3600000ull, 0x3e4580e1b200000ull, 0x3e45c0e7bc00000ull, 0x3e4601087a00000ull,
+		0x3e464122d400000ull, 0x3e468133e200000ull, 0x3e46c09d0400000ull, 0x3e4700a6ea00000ull,
+		0x3e4740d60800000ull, 0x3e4780e43600000ull, 0x3e47c10c5a00000ull, 0x3e48013c3c00000ull,
+		0x3e4840baa000000ull, 0x3e4880dfd600000ull, 0x3e48c10b9a00000ull, 0x3e490112c800000ull,
+		0x3e4940c59200000ull, 0x3e498103b000000ull, 0x3e49c1103e00000ull, 0x3e4a00bd9400000ull,
+		0x3e4a40ce2e00000ull, 0x3e4a80dad400000ull, 0x3e4ac0e5f800000ull, 0x3e4b01219c00000ull,
+		0x3e4b409f0c00000ull, 0x3e4b80a36e00000ull, 0x3e4bc0a5bc00000ull, 0x3e4c00c98800000ull,
+		0x3e4c40d5a600000ull, 0x3e4c80e42000000ull, 0x3e4cc0edce00000ull, 0x3e4d01000200000ull,
+		0x3e4d410c0c00000ull, 0x3e4d810cb800000ull, 0x3e4dc11bde00000ull, 0x3e4e012e6400000ull,
+		0x3e4e4136de00000ull, 0x3e4e813bf400000ull, 0x3e4ec0f11800000ull, 0x3e4f00f2fe00000ull,
+		0x3e4f40fb4000000ull, 0x3e4f81079200000ull, 0x3e4fc1260800000ull, 0x3e50013cfe00000ull,
+		0x3e504115ac00000ull, 0x3e5080b1be00000ull, 0x3e50c0be0800000ull, 0x3e5100f8c000000ull,
+		0x3e514100fc00000ull, 0x3e5180e4c400000ull, 0x3e51c0f19400000ull, 0x3e5201198400000ull,
+		0x3e52412dee00000ull, 0x3e5280b1b000000ull, 0x3e52c0b8c400000ull, 0x3e5300d42600000ull,
+		0x3e5340dbb400000ull, 0x3e5380de1e00000ull, 0x3e53c0fa5e00000ull, 0x3e5400fc6e00000ull,
+		0x3e54412c9600000ull, 0x3e5480a5a400000ull, 0x3e54c1011600000ull, 0x3e5500a3b800000ull,
+		0x3e5540a39800000ull, 0x3e5580f43800000ull, 0x3e55c0fb7c00000ull, 0x3e560107e200000ull,
+		0x3e56412cea00000ull, 0x3e5681170000000ull, 0x3e56c0c59e00000ull, 0x3e5700d40400000ull,
+		0x3e574115fc00000ull, 0x3e57809c7200000ull, 0x3e57c0b7ce00000ull, 0x3e5800c02400000ull,
+		0x3e5840e70e00000ull, 0x3e5880eae000000ull, 0x3e58c0a62e00000ull, 0x3e5900f1f600000ull,
+		0x3e59409f7e00000ull, 0x3e5980bf5200000ull, 0x3e59c09c1a00000ull, 0x3e5a00d99800000ull,
+		0x3e5a40caf000000ull, 0x3e5a80fa4400000ull, 0x3e5ac0a78600000ull, 0x3e5b00b0bc00000ull,
+		0x3e5b40ee0200000ull, 0x3e5b81089200000ull, 0x3e5bc1155400000ull, 0x3e5c00d77400000ull,
+		0x3e5c411f6000000ull, 0x3e5c80d91000000ull, 0x3e5cc0c5fc00000ull, 0x3e5d0105ca00000ull,
+		0x3e5d40c74000000ull, 0x3e5d80eaca00000ull, 0x3e5dc09d5c00000ull, 0x3e5e00a2d200000ull,
+		0x3e5e40a39200000ull, 0x3e5e80d10200000ull, 0x3e5ec0f9ce00000ull, 0x3e5f0104de00000ull,
+		0x3e5f4115a400000ull, 0x3e5f81239e00000ull, 0x3e5fc0a5ea00000ull, 0x3e6000a88400000ull,
+		0x3e6040b2e600000ull, 0x3e6080bdd800000ull, 0x3e60c0cb8a00000ull, 0x3e6100dffc00000ull,
+		0x3e6140f25400000ull, 0x3e61812b5a00000ull, 0x3e61c134d400000ull, 0x3e62013d2e00000ull,
+		0x3e62413d9c00000ull, 0x3e6280a53600000ull, 0x3e62c0cd8c00000ull, 0x3e6300d6ee00000ull,
+		0x3e63411ec400000ull, 0x3e6380bce800000ull, 0x3e63c0c32000000ull, 0x3e6400c40000000ull,
+		0x3e6440c93400000ull, 0x3e6480de4600000ull, 0x3e64c0e29200000ull, 0x3e6500e91200000ull,
+		0x3e6540f39400000ull, 0x3e6580fbe800000ull, 0x3e65c100de00000ull, 0x3e66011e4c00000ull,
+		0x3e664109dc00000ull, 0x3e6681204600000ull, 0x3e66c1269400000ull, 0x3e6700a42e00000ull,
+		0x3e6740a54600000ull, 0x3e6780a97a00000ull, 0x3e67c0e19000000ull, 0x3e6801118400000ull,
+		0x3e6841155400000ull, 0x3e6880bd9200000ull, 0x3e68c0bfea00000ull, 0x3e6900c6f600000ull,
+		0x3e6940d75c00000ull, 0x3e6980f87c00000ull, 0x3e69c0e6ea00000ull, 0x3e6a009dc800000ull,
+		0x3e6a40adf200000ull, 0x3e6a80b7ce00000ull, 0x3e6ac0bb7400000ull, 0x3e6b00c03800000ull,
+		0x3e6b40e76400000ull, 0x3e6b80e8d200000ull, 0x3e6bc0ff3400000ull, 0x3e6c01008c00000ull,
+		0x3e6c41246800000ull, 0x3e6c812dec00000ull, 0x3e6cc12e9000000ull, 0x3e6d01303000000ull,
+		0x3e6d409f1600000ull, 0x3e6d80f35c00000ull, 0x3e6dc1236800000ull, 0x3e6e012d7000000ull,
+		0x3e6e40c1c200000ull, 0x3e6e809d0c00000ull, 0x3e6ec0a1b400000ull, 0x3e6f00b7dc00000ull,
+		0x3e6f40b87e00000ull, 0x3e6f80cb3200000ull, 0x3e6fc0d40400000ull, 0x3e7000e39c00000ull,
+		0x3e7040ec8400000ull, 0x3e708109f800000ull, 0x3e70c120f800000ull, 0x3e71013f1a00000ull,
+		0x3e7140cd1000000ull, 0x3e71812c5c00000ull, 0x3e71c0a51200000ull, 0x3e7200cef600000ull,
+		0x3e7240cfe600000ull, 0x3e7280da8200000ull, 0x3e72c0dd3800000ull, 0x3e7300e81200000ull,
+		0x3e7340eab200000ull, 0x3e7380f0d600000ull, 0x3e73c0fa2000000ull, 0x3e740130bc00000ull,
+		0x3e7440a2da00000ull, 0x3e7480c45c00000ull, 0x3e74c12cf000000ull, 0x3e7500a05600000ull,
+		0x3e7540ba3200000ull, 0x3e7580dbd400000ull, 0x3e75c11e5400000ull, 0x3e7600bf1600000ull,
+		0x3e7640c28800000ull, 0x3e7680d02e00000ull, 0x3e76c0e70e00000ull, 0x3e77012d0c00000ull,
+		0x3e7740a45200000ull, 0x3e7780a81e00000ull, 0x3e77c0b8ca00000ull, 0x3e7800cc2600000ull,
+		0x3e7840ce9c00000ull, 0x3e7880d15000000ull, 0x3e78c0d9ca00000ull, 0x3e7900e80c00000ull,
+		0x3e7940ebc400000ull, 0x3e7980fef200000ull, 0x3e79c1119e00000ull, 0x3e7a0111c200000ull,
+		0x3e7a41239800000ull, 0x3e7a812dc400000ull, 0x3e7ac0a67e00000ull, 0x3e7b00dd7400000ull,
+		0x3e7b40a83a00000ull, 0x3e7b80e3a000000ull, 0x3e7bc0e93000000ull, 0x3e7c010bf400000ull,
+		0x3e7c412d4600000ull, 0x3e7c8138ae00000ull, 0x3e7cc13d3e00000ull, 0x3e7d00cf2e00000ull,
+		0x3e7d40db9600000ull, 0x3e7d8103d000000ull, 0x3e7dc0f59600000ull, 0x3e7e00f64000000ull,
+		0x3e7e40f92400000ull, 0x3e7e80e58000000ull, 0x3e7ec0e13200000ull, 0x3e7f0116b000000ull,
+		0x3e7f409d8000000ull, 0x3e7f81066c00000ull, 0x3e7fc0a47400000ull, 0x3e8000a40e00000ull,
+		0x3e8040bd4c00000ull, 0x3e8080c5a600000ull, 0x3e80c0f9ac00000ull, 0x3e8100b70a00000ull,
+		0x3e8140da3c00000ull, 0x3e8180cd6800000ull, 0x3e81c11e7600000ull, 0x3e8201109800000ull,
+		0x3e82412c9a00000ull, 0x3e8281131600000ull, 0x3e82c0bda600000ull, 0x3e8300a28000000ull,
+		0x3e8340ab8000000ull, 0x3e8400b0b400000ull, 0x3e8480cce800000ull, 0x3e8540a3bc00000ull,
+		0x3e8580e65400000ull, 0x3e85c0ed9400000ull, 0x3e8600f27800000ull, 0x3e8640f2bc00000ull,
+		0x3e8680f2ca00000ull, 0x3e86c0f31e00000ull, 0x3e87012eac00000ull, 0x3e8740f97c00000ull,
+		0x3e8780ff7a00000ull, 0x3e88010c2400000ull, 0x3e888115f000000ull, 0x3e8941207000000ull,
+		0x3e898121fa00000ull, 0x3e8a8131de00000ull, 0x3e8ac131f800000ull, 0x3e8b01325000000ull,
+		0x3e8b413b6800000ull, 0x3e8b8121bc00000ull, 0x3e8bc12d6e00000ull, 0x3e8c009f5c00000ull,
+		0x3e8c40a1ce00000ull, 0x3e8c80a29a00000ull, 0x3e8cc0a59200000ull, 0x3e8d00a5c800000ull,
+		0x3e8d40a6a200000ull, 0x3e8d80ab3a00000ull, 0x3e8dc0ac0c00000ull, 0x3e8e00acd000000ull,
+		0x3e8e40b08000000ull, 0x3e8e80b15000000ull, 0x3e8ec0b8c800000ull, 0x3e8f00b8dc00000ull,
+		0x3e8f40c12800000ull, 0x3e8f80c2d000000ull, 0x3e8fc0c31c00000ull, 0x3e9000c3e400000ull,
+		0x3e9040ca9e00000ull, 0x3e9080cbc400000ull, 0x3e90c0cd2200000ull, 0x3e9100d10a00000ull,
+		0x3e9140daee00000ull, 0x3e9180dc3400000ull, 0x3e91c0de4400000ull, 0x3e9200e2dc00000ull,
+		0x3e9240e45600000ull, 0x3e9280e84400000ull, 0x3e92c0f12200000ull, 0x3e9300f27c00000ull,
+		0x3e9340f29200000ull, 0x3e9380f29000000ull, 0x3e93c0f2a000000ull, 0x3e9400f2ac00000ull,
+		0x3e9440f2ba00000ull, 0x3e9480f31a00000ull, 0x3e94c0f31c00000ull, 0x3e9500f48000000ull,
+		0x3e9540f50200000ull, 0x3e9580f78000000ull, 0x3e95c0fbe800000ull, 0x3e9600fc1200000ull,
+		0x3e9640fc8200000ull, 0x3e9680fee400000ull, 0x3e96c1000a00000ull, 0x3e970103da00000ull,
+		0x3e974104f200000ull, 0x3e978104f200000ull, 0x3e97c108ae00000ull, 0x3e9801122000000ull,
+		0x3e9841132c00000ull, 0x3e9881160200000ull, 0x3e98c1167200000ull, 0x3e990119a600000ull,
+		0x3e99411a1000000ull, 0x3e99811f6c00000ull, 0x3e99c1207000000ull, 0x3e9a012dc600000ull,
+		0x3e9a412ffe00000ull, 0x3e9a81307600000ull, 0x3e9ac0c0ea00000ull, 0x3e9b0485dc00000ull,
+		0x3e9b41043000000ull, 0x3e9c009c4c00000ull, 0x3e9c40a36a00000ull, 0x3e9c80a2d000000ull,
+		0x3e9cc09f0000000ull, 0x3e9d00a28a00000ull, 0x3e9d40a30000000ull, 0x3e9d80a58e00000ull,
+		0x3e9dc0a5f400000ull, 0x3e9e00ab3a00000ull, 0x3e9e40aaaa00000ull, 0x3e9e80ab3200000ull,
+		0x3e9ec0abc400000ull, 0x3e9f00b0b400000ull, 0x3e9f40b16600000ull, 0x3e9f80b28800000ull,
+		0x3e9fc0b2a800000ull, 0x3ea000b4c400000ull, 0x3ea040b65000000ull, 0x3ea080bda400000ull,
+		0x3ea0c0bdb200000ull, 0x3ea100bed200000ull, 0x3ea140bf5a00000ull, 0x3ea180c1b000000ull,
+		0x3ea1c0c29c00000ull, 0x3ea200c21000000ull, 0x3ea240c31c00000ull, 0x3ea280c2c000000ull,
+		0x3ea2c0c3e400000ull, 0x3ea300c46800000ull, 0x3ea340c78800000ull, 0x3ea380c83800000ull,
+		0x3ea3c0c8a400000ull, 0x3ea400caac00000ull, 0x3ea440cce800000ull, 0x3ea480ce2e00000ull,
+		0x3ea4c0ce3600000ull, 0x3ea500ceac00000ull, 0x3ea540d6f200000ull, 0x3ea580d77400000ull,
+		0x3ea5c0da8200000ull, 0x3ea600ddb600000ull, 0x3ea640dd9600000ull, 0x3ea680de4400000ull,
+		0x3ea6c0e03c00000ull, 0x3ea700e2dc00000ull, 0x3ea740ef4e00000ull, 0x3ea780e46a00000ull,
+		0x3ea7c0e55e00000ull, 0x3ea800e65400000ull, 0x3ea840e8e200000ull, 0x3ea880ea0c00000ull,
+		0x3ea8c0ea7600000ull, 0x3ea900ec3a00000ull, 0x3ea940ec3e00000ull, 0x3ea980ed9400000ull,
+		0x3ea9c0edb600000ull, 0x3eaa00ede800000ull, 0x3eaa40ee9400000ull, 0x3eaa80ee8000000ull,
+		0x3eaac0f19800000ull, 0x3eab00f56200000ull, 0x3eab40f78000000ull, 0x3eab80f8f600000ull,
+		0x3eabc0fab600000ull, 0x3eac00fbe800000ull, 0x3eac40fe7c00000ull, 0x3eac81000a00000ull,
+		0x3eacc106a400000ull, 0x3ead0107de00000ull, 0x3ead410ef200000ull, 0x3ead81128200000ull,
+		0x3eadc1130c00000ull, 0x3eae01132c00000ull, 0x3eae41157e00000ull, 0x3eae8115f000000ull,
+		0x3eaec1159600000ull, 0x3eaf01160200000ull, 0x3eaf4115fc00000ull, 0x3eaf8115da00000ull,
+		0x3eafc1167200000ull, 0x3eb001171400000ull, 0x3eb0411a1000000ull, 0x3eb0811e7000000ull,
+		0x3eb0c120e400000ull, 0x3eb101233200000ull, 0x3eb14124ec00000ull, 0x3eb1812cf800000ull,
+		0x3eb1c12dc600000ull, 0x3eb2012eac00000ull, 0x3eb2412fb600000ull, 0x3eb2812ffe00000ull,
+		0x3eb2c1301600000ull, 0x3eb301307600000ull, 0x3eb341362400000ull, 0x3eb3813f3800000ull,
+		0x3eb3c4509400000ull, 0x3eb404508800000ull, 0x3eb44467aa00000ull, 0x3eb480773a00000ull,
+		0x3eb4c0803000000ull, 0x3eb500807200000ull, 0x3eb544a49200000ull, 0x3eb584b9a000000ull,
+		0x3eb5c4fda600000ull, 0x3eb6013e8600000ull, 0x3eb6413f1c00000ull, 0x3ec7400bb2005b4ull,
+		0x3ec7c00be4005b7ull, 0x3eca800bd2005c1ull, 0x3ecac00bd2005c2ull, 0x3ecb01f692005c1ull,
+		0x3ecb41f692005c2ull, 0x3ecb800ba0005b7ull, 0x3ecbc00ba0005b8ull, 0x3ecc000ba0005bcull,
+		0x3ecc400ba2005bcull, 0x3ecc800ba4005bcull, 0x3eccc00ba6005bcull, 0x3ecd000ba8005bcull,
+		0x3ecd400baa005bcull, 0x3ecd800bac005bcull, 0x3ece000bb0005bcull, 0x3ece400bb2005bcull,
+		0x3ece800bb4005bcull, 0x3ecec00bb6005bcull, 0x3ecf000bb8005bcull, 0x3ecf800bbc005bcull,
+		0x3ed0000bc0005bcull, 0x3ed0400bc2005bcull, 0x3ed0c00bc6005bcull, 0x3ed1000bc8005bcull,
+		0x3ed1800bcc005bcull, 0x3ed1c00bce005bcull, 0x3ed2000bd0005bcull, 0x3ed2400bd2005bcull,
+		0x3ed2800bd4005bcull, 0x3ed2c00baa005b9ull, 0x3ed3000ba2005bfull, 0x3ed3400bb6005bfull,
+		0x3ed3800bc8005bfull, 0x4426822132110baull, 0x4427022136110baull, 0x442ac2214a110baull,
+		0x444b82226211127ull, 0x444bc2226411127ull, 0x44d2c2268e1133eull, 0x44d302268e11357ull,
+		0x452ec22972114baull, 0x452f022972114b0ull, 0x452f822972114bdull, 0x456e822b70115afull,
+		0x456ec22b72115afull, 0x464e02326a11930ull, 0x745783a2ae1d165ull, 0x7457c3a2b01d165ull,
+		0x745803a2be1d16eull, 0x745843a2be1d16full, 0x745883a2be1d170ull, 0x7458c3a2be1d171ull,
+		0x745903a2be1d172ull, 0x746ec3a3721d165ull, 0x746f03a3741d165ull, 0x746f43a3761d16eull,
+		0x746f83a3781d16eull, 0x746fc3a3761d16full, 0x747003a3781d16full, 0xbe00009c7a00000ull,
+		0xbe00409c7000000ull, 0xbe00809c8200000ull, 0xbe00c4024400000ull, 0xbe01009ec000000ull,
+		0xbe01409f5c00000ull, 0xbe01809f7600000ull, 0xbe01c0a00400000ull, 0xbe0200a0f400000ull,
+		0xbe0240a13200000ull, 0xbe0280a1ce00000ull, 0xbe02c0a19e00000ull, 0xbe0300693c00000ull,
+		0xbe03440c7400000ull, 0xbe0380a29a00000ull, 0xbe03c0a2a800000ull, 0xbe0400a2c800000ull,
+		0xbe0440a2ee00000ull, 0xbe04840a3800000ull, 0xbe04c0697200000ull, 0xbe0500a2ce00000ull,
+		0xbe0540a31a00000ull, 0xbe05840a9600000ull, 0xbe05c0a32e00000ull, 0xbe0600a34800000ull,
+		0xbe06409d9800000ull, 0xbe0680a35800000ull, 0xbe06c0a36a00000ull, 0xbe070523be00000ull,
+		0xbe0740a3ea00000ull, 0xbe0780a40600000ull, 0xbe07c069be00000ull, 0xbe0800a47600000ull,
+		0xbe0840a48c00000ull, 0xbe0880a4e400000ull, 0xbe08c0a4ee00000ull, 0xbe09006a2a00000ull,
+		0xbe0940a58e00000ull, 0xbe0980a59200000ull, 0xbe09c0a5c800000ull, 0xbe0a00a5f400000ull,
+		0xbe0a40a60a00000ull, 0xbe0a80a60c00000ull, 0xbe0ac0a62e00000ull, 0xbe0b00a69200000ull,
+		0xbe0b40a6a200000ull, 0xbe0b80a6b400000ull, 0xbe0bc0a6e600000ull, 0xbe0c00a6fa00000ull,
+		0xbe0c40a6fe00000ull, 0xbe0c80a6fe00000ull, 0xbe0cc0a6fe00000ull, 0xbe0d04145800000ull,
+		0xbe0d40e0e000000ull, 0xbe0d80a79400000ull, 0xbe0dc0a7be00000ull, 0xbe0e0416c600000ull,
+		0xbe0e40a7d600000ull, 0xbe0e80a7e200000ull, 0xbe0ec0a80c00000ull, 0xbe0f00a93c00000ull,
+		0xbe0f40a87000000ull, 0xbe0f80a89000000ull, 0xbe0fc0a8d000000ull, 0xbe1000a94400000ull,
+		0xbe1040a9ec00000ull, 0xbe1080aa2000000ull, 0xbe10c0aaa600000ull, 0xbe1100aac600000ull,
+		0xbe1140ab0800000ull, 0xbe1180ab0800000ull, 0xbe11c0ab3200000ull, 0xbe1200ab5600000ull,
+		0xbe1240ab6600000ull, 0xbe1280ab8400000ull, 0xbe12c0ae2c00000ull, 0xbe1300ac0c00000ull,
+		0xbe1340ae2e00000ull, 0xbe1380aca200000ull, 0xbe13c0ace800000ull, 0xbe1400a40e00000ull,
+		0xbe1440b1dc00000ull, 0xbe1480af9c00000ull, 0xbe14c0afe800000ull, 0xbe1500b01a00000ull,
+		0xbe1540af1600000ull, 0xbe1580b06400000ull, 0xbe15c0b06200000ull, 0xbe1600b15800000ull,
+		0xbe164429c800000ull, 0xbe1680b1e400000ull, 0xbe16c0b1ee00000ull, 0xbe1700b20c00000ull,
+		0xbe1740b23400000ull, 0xbe1780b24400000ull, 0xbe17c0b2c400000ull, 0xbe18042d5000000ull,
+		0xbe18442dd400000ull, 0xbe1880b3d800000ull, 0xbe18c0b43600000ull, 0xbe1900b44e00000ull,
+		0xbe1940b3b000000ull, 0xbe1980b4cc00000ull, 0xbe19c06ddc00000ull, 0xbe1a006df800000ull,
+		0xbe1a40b61000000ull, 0xbe1a80b67c00000ull, 0xbe1ac0b67c00000ull, 0xbe1b04339000000ull,
+		0xbe1b40b78600000ull, 0xbe1b80b7b000000ull, 0xbe1bc0b7ce00000ull, 0xbe1c00b7e600000ull,
+		0xbe1c44363000000ull, 0xbe1c80b7fe00000ull, 0xbe1cc0b80c00000ull, 0xbe1d00bea600000ull,
+		0xbe1d40b84400000ull, 0xbe1d806f0200000ull, 0xbe1dc0b8c000000ull, 0xbe1e00b8dc00000ull,
+		0xbe1e40b98000000ull, 0xbe1e80b91a00000ull, 0xbe1ec43bc800000ull, 0xbe1f00ba8600000ull,
+		0xbe1f443bcc00000ull, 0xbe1f80badc00000ull, 0xbe1fc0bad600000ull, 0xbe2000baf800000ull,
+		0xbe2040bbc200000ull, 0xbe2080bbc400000ull, 0xbe20c0705e00000ull, 0xbe2100bbfa00000ull,
+		0xbe2140bc5000000ull, 0xbe2180bc7a00000ull, 0xbe21c0bcd200000ull, 0xbe220070c400000ull,
+		0xbe2244430600000ull, 0xbe228070f800000ull, 0xbe22c0bd6000000ull, 0xbe2300bd6600000ull,
+		0xbe2340bd6c00000ull, 0xbe2380bd9400000ull, 0xbe23c5472400000ull, 0xbe2400bdfc00000ull,
+		0xbe2444466200000ull, 0xbe2484466200000ull, 0xbe24c1040200000ull, 0xbe2500be4400000ull,
+		0xbe2540be4400000ull, 0xbe2580718e00000ull, 0xbe25c4657000000ull, 0xbe2604c3b400000ull,
+		0xbe2640bec400000ull, 0xbe2680bed600000ull, 0xbe26c071c600000ull, 0xbe2700bf3400000ull,
+		0xbe2740bf9a00000ull, 0xbe2780bfae00000ull, 0xbe27c0bff200000ull, 0xbe2800c10200000ull,
+		0xbe2840727400000ull, 0xbe2880723800000ull, 0xbe28c0c12800000ull, 0xbe29044da800000ull,
+		0xbe2940c18e00000ull, 0xbe2980c29000000ull, 0xbe29c0c29800000ull, 0xbe2a00c29c00000ull,
+		0xbe2a40c29800000ull, 0xbe2a80c2f400000ull, 0xbe2ac0c31c00000ull, 0xbe2b00c36400000ull,
+		0xbe2b40c34800000ull, 0xbe2b80c35e00000ull, 0xbe2bc0c3bc00000ull, 0xbe2c00c3e400000ull,
+		0xbe2c40c3ec00000ull, 0xbe2c80c42000000ull, 0xbe2cc0c43600000ull, 0xbe2d00c4ba00000ull,
+		0xbe2d40c56200000ull, 0xbe2d80c5a800000ull, 0xbe2dc0c6a000000ull, 0xbe2e04561800000ull,
+		0xbe2e40c67a00000ull, 0xbe2e80c5f800000ull, 0xbe2ec0c6d000000ull, 0xbe2f00c70600000ull,
+		0xbe2f40c7c800000ull, 0xbe2f8457e200000ull, 0xbe2fc0c84400000ull, 0xbe3000c78a00000ull,
+		0xbe3040c75200000ull, 0xbe3080745c00000ull, 0xbe30c0c8d200000ull, 0xbe3100c8fc00000ull,
+		0xbe3140c93a00000ull, 0xbe3180c8ee00000ull, 0xbe31c074d800000ull, 0xbe3200ca9e00000ull,
+		0xbe3240cad800000ull, 0xbe3284601400000ull, 0xbe32c0cbc600000ull, 0xbe3300cdf000000ull,
+		0xbe3340cc9200000ull, 0xbe3380763200000ull, 0xbe33c0cd2200000ull, 0xbe3400761000000ull,
+		0xbe344075c800000ull, 0xbe3480a32400000ull, 0xbe34c0a32a00000ull, 0xbe3500ce0000000ull,
+		0xbe3540cd3800000ull, 0xbe3581015a00000ull, 0xbe35c087b200000ull, 0xbe3600ce2e00000ull,
+		0xbe3640ce3600000ull, 0xbe3680ce4200000ull, 0xbe36c0cebc00000ull, 0xbe3700cea600000ull,
+		0xbe3744678600000ull, 0xbe3780769200000ull, 0xbe37c0cff400000ull, 0xbe3800cf0a00000ull,
+		0xbe3840d0a400000ull, 0xbe3880d10a00000ull, 0xbe38c468da00000ull, 0xbe3900d11c00000ull,
+		0xbe3940d03e00000ull, 0xbe3980d22800000ull, 0xbe39c0773a00000ull, 0xbe3a00d28400000ull,
+		0xbe3a40d34600000ull, 0xbe3a80d3d400000ull, 0xbe3ac0d55000000ull, 0xbe3b046d4600000ull,
+		0xbe3b40d5b600000ull, 0xbe3b80783000000ull, 0xbe3bc0d64200000ull, 0xbe3c04714e00000ull,
+		0xbe3c40d6a800000ull, 0xbe3c80789c00000ull, 0xbe3cc0d6e400000ull, 0xbe3d00d73e00000ull,
+		0xbe3d40d77400000ull, 0xbe3d80d77600000ull, 0xbe3dc4751a00000ull, 0xbe3e043a1600000ull,
+		0xbe3e4475f400000ull, 0xbe3e80d89c00000ull, 0xbe3ec4797800000ull, 0xbe3f00d97e00000ull,
+		0xbe3f40d99a00000ull, 0xbe3f80d8ce00000ull, 0xbe3fc0da2c00000ull, 0xbe4000da7c00000ull,
+		0xbe4040daee00000ull, 0xbe4080da8200000ull, 0xbe40c0dad200000ull, 0xbe4100daf000000ull,
+		0xbe4140db0a00000ull, 0xbe41847a3c00000ull, 0xbe41c0da6800000ull, 0xbe4200dc5e00000ull,
+		0xbe4240dcdc00000ull, 0xbe42807a6600000ull, 0xbe42c0dd9600000ull, 0xbe4300dd8e00000ull,
+		0xbe43447da200000ull, 0xbe4380dbf200000ull, 0xbe43c0dedc00000ull, 0xbe44047ebc00000ull,
+		0xbe44447f1c00000ull, 0xbe4480df8c00000ull, 0xbe44c0e07200000ull, 0xbe4500e03c00000ull,
+		0xbe4540e03600000ull, 0xbe45807b2c00000ull, 0xbe45c0e09400000ull, 0xbe4600e0fa00000ull,
+		0xbe4640e0ee00000ull, 0xbe4680e15a00000ull, 0xbe46c40a4a00000ull, 0xbe4700e28a00000ull,
+		0xbe474484c600000ull, 0xbe4780e33800000ull, 0xbe47c4875600000ull, 0xbe4800e45000000ull,
+		0xbe4840e46a00000ull, 0xbe4880e4a000000ull, 0xbe48c48c1000000ull, 0xbe4900e50000000ull,
+		0xbe4940e52a00000ull, 0xbe49848e6a00000ull, 0xbe49c4902800000ull, 0xbe4a00e6f400000ull,
+		0xbe4a40e71600000ull, 0xbe4a807d5800000ull, 0xbe4ac0e74a00000ull, 0xbe4b007d7000000ull,
+		0xbe4b407d7000000ull, 0xbe4b80e88e00000ull, 0xbe4bc0e8b800000ull, 0xbe4c00e8e200000ull,
+		0xbe4c40e90a00000ull, 0xbe4c80e99400000ull, 0xbe4cc07e3600000ull, 0xbe4d00ea4800000ull,
+		0xbe4d44986c00000ull, 0xbe4d80ea7c00000ull, 0xbe4dc4992400000ull, 0xbe4e00eae000000ull,
+		0xbe4e44433e00000ull, 0xbe4e80ec2000000ull, 0xbe4ec49f4200000ull, 0xbe4f049f7000000ull,
+		0xbe4f44a08800000ull, 0xbe4f807ff800000ull, 0xbe4fc0801000000ull, 0xbe5000ede800000ull,
+		0xbe5044a1e600000ull, 0xbe5084a1e400000ull, 0xbe50c4a23200000ull, 0xbe5104a26600000ull,
+		0xbe5140ee3c00000ull, 0xbe5180ee3e00000ull, 0xbe51c0ee3e00000ull, 0xbe5200ee9400000ull,
+		0xbe5240807200000ull, 0xbe5280ef1600000ull, 0xbe52c0808c00000ull, 0xbe5300812c00000ull,
+		0xbe5344a83a00000ull, 0xbe5380f09c00000ull, 0xbe53c0f11800000ull, 0xbe5400f19800000ull,
+		0xbe544081c600000ull, 0xbe5484ac4c00000ull, 0xbe54c0f2ac00000ull, 0xbe5504ad3400000ull,
+		0xbe5544ad8a00000ull, 0xbe5580f31e00000ull, 0xbe55c0f3d600000ull, 0xbe5600825e00000ull,
+		0xbe5640f48000000ull, 0xbe5680f49400000ull, 0xbe56c0f49e00000ull, 0xbe5704b2f800000ull,
+		0xbe5744b54e00000ull, 0xbe5784b54e00000ull, 0xbe57c0f5dc00000ull, 0xbe5800840400000ull,
+		0xbe5844b75600000ull, 0xbe5880f78c00000ull, 0xbe58c0f79200000ull, 0xbe5900844e00000ull,
+		0xbe5944b90000000ull, 0xbe5980f9a400000ull, 0xbe59c0854000000ull, 0xbe5a00f9d000000ull,
+		0xbe5a40f9c600000ull, 0xbe5a80fa0000000ull, 0xbe5ac4bf0c00000ull, 0xbe5b00fac600000ull,
+		0xbe5b40860200000ull, 0xbe5b80fb8e00000ull, 0xbe5bc0fc0400000ull, 0xbe5c00fc8a00000ull,
+		0xbe5c40866800000ull, 0xbe5c84c45000000ull, 0xbe5cc4c48e00000ull, 0xbe5d0086b200000ull,
+		0xbe5d44c5b200000ull, 0xbe5d80fef400000ull, 0xbe5dc4c67c00000ull, 0xbe5e00ff2a00000ull,
+		0xbe5e40fff400000ull, 0xbe5e81000a00000ull, 0xbe5ec4c9b400000ull, 0xbe5f04ca4600000ull,
+		0xbe5f4100c000000ull, 0xbe5f84cb5000000ull, 0xbe5fc100e000000ull, 0xbe600466be00000ull,
+		0xbe604087aa00000ull, 0xbe6081016400000ull, 0xbe60c1020600000ull, 0xbe6100881600000ull,
+		0xbe6141027c00000ull, 0xbe6180b56a00000ull, 0xbe61c4cf4e00000ull, 0xbe6204cf6a00000ull,
+		0xbe6244672600000ull, 0xbe6284673800000ull, 0xbe62c1040200000ull, 0xbe6301040800000ull,
+		0xbe63411f3c00000ull, 0xbe638088d600000ull, 0xbe63c1052200000ull, 0xbe6401051600000ull,
+		0xbe6441053a00000ull, 0xbe6480a56600000ull, 0xbe64c1056200000ull, 0xbe6501056600000ull,
+		0xbe6541057a00000ull, 0xbe658105cc00000ull, 0xbe65c4d67800000ull, 0xbe660105ca00000ull,
+		0xbe6641063a00000ull, 0xbe668106c600000ull, 0xbe66c1075a00000ull, 0xbe6701064600000ull,
+		0xbe6741077a00000ull, 0xbe678107ce00000ull, 0xbe67c108ae00000ull, 0xbe680106a600000ull,
+		0xbe6841079400000ull, 0xbe6881079800000ull, 0xbe68c107b800000ull, 0xbe6904d86c00000ull,
+		0xbe6944dad600000ull, 0xbe6984d9aa00000ull, 0xbe69c08a5600000ull, 0xbe6a0109e200000ull,
+		0xbe6a4109e600000ull, 0xbe6a810a2c00000ull, 0xbe6ac4e79400000ull, 0xbe6b010ac800000ull,
+		0xbe6b44de5800000ull, 0xbe6b808aba00000ull, 0xbe6bc08ac200000ull, 0xbe6c04df6200000ull,
+		0xbe6c44e1a400000ull, 0xbe6c808ad600000ull, 0xbe6cc10ca000000ull, 0xbe6d010cb800000ull,
+		0xbe6d410cce00000ull, 0xbe6d810cd200000ull, 0xbe6dc10d5200000ull, 0xbe6e010d1000000ull,
+		0xbe6e410e1c00000ull, 0xbe6e810dc400000ull, 0xbe6ec10ef200000ull, 0xbe6f010e5000000ull,
+		0xbe6f410ed600000ull, 0xbe6f810f0c00000ull, 0xbe6fc08bae00000ull, 0xbe70010fc200000ull,
+		0xbe7041100200000ull, 0xbe70808bf200000ull, 0xbe70c110c000000ull, 0xbe710110c600000ull,
+		0xbe7144ecce00000ull, 0xbe718111ae00000ull, 0xbe71c111bc00000ull, 0xbe72008c6a00000ull,
+		0xbe724111f400000ull, 0xbe7280697600000ull, 0xbe72c4f15c00000ull, 0xbe7304f2cc00000ull,
+		0xbe73408d7c00000ull, 0xbe73808d8e00000ull, 0xbe73c1154000000ull, 0xbe740115da00000ull,
+		0xbe7441171400000ull, 0xbe748118aa00000ull, 0xbe74c4f95000000ull, 0xbe7501195600000ull,
+		0xbe7541198200000ull, 0xbe75811a3600000ull, 0xbe75c11aee00000ull, 0xbe7604fe5e00000ull,
+		0xbe7644100800000ull, 0xbe76811b9600000ull, 0xbe76c11b7800000ull, 0xbe77011be000000ull,
+		0xbe774411bc00000ull, 0xbe77811da800000ull, 0xbe77c11e7000000ull, 0xbe78050ba400000ull,
+		0xbe78450bda00000ull, 0xbe7881212800000ull, 0xbe78c121e200000ull, 0xbe7901222200000ull,
+		0xbe79450e5c00000ull, 0xbe7981223600000ull, 0xbe79c1247000000ull, 0xbe7a0125ae00000ull,
+		0xbe7a4125b000000ull, 0xbe7a8124f800000ull, 0xbe7ac127f200000ull, 0xbe7b01282a00000ull,
+		0xbe7b4517f400000ull, 0xbe7b812b1600000ull, 0xbe7bc0932a00000ull, 0xbe7c012b6e00000ull,
+		0xbe7c451aee00000ull, 0xbe7c8093cc00000ull, 0xbe7cc12d8600000ull, 0xbe7d00bb6400000ull,
+		0xbe7d412e4600000ull, 0xbe7d85228a00000ull, 0xbe7dc5243400000ull, 0xbe7e0094dc00000ull,
+		0xbe7e4094ec00000ull, 0xbe7e812fc000000ull, 0xbe7ec5281400000ull, 0xbe7f00956400000ull,
+		0xbe7f45292c00000ull, 0xbe7f81301600000ull, 0xbe7fc1301600000ull, 0xbe8001305200000ull,
+		0xbe80452b6c00000ull, 0xbe808131c400000ull, 0xbe80c0966600000ull, 0xbe8101325200000ull,
+		0xbe8141334e00000ull, 0xbe8181338400000ull, 0xbe81c133fc00000ull, 0xbe8200979c00000ull,
+		0xbe8245366000000ull, 0xbe8281362400000ull, 0xbe82c1388000000ull, 0xbe830139fa00000ull,
+		0xbe8340999c00000ull, 0xbe838099da00000ull, 0xbe83c13ace00000ull, 0xbe8405419c00000ull,
+		0xbe844099f000000ull, 0xbe8485420a00000ull, 0xbe84c5441c00000ull, 0xbe8505452200000ull,
+		0xbe85413d7600000ull, 0xbe85809aac00000ull, 0xbe85c13df200000ull, 0xbe86013dfc00000ull,
+		0xbe86413e0a00000ull, 0xbe86813e1e00000ull, 0xbe86c13e2c00000ull, 0xbe87013e7600000ull,
+		0xbe87454c0000000ull,
+	};
+
+	// (first << 42) | (second << 21) | composite: the pairs canonical composition joins.
+	inline constexpr std::uint64_t unicode_compositions[] =
+	{
+		0xf0006700226eull, 0xf40067002260ull, 0xf8006700226full, 0x10400600000c0ull,
+		0x10400602000c1ull, 0x10400604000c2ull, 0x10400606000c3ull, 0x1040060800100ull,
+		0x1040060c00102ull, 0x1040060e00226ull, 0x10400610000c4ull, 0x1040061201ea2ull,
+		0x10400614000c5ull, 0x10400618001cdull, 0x1040061e00200ull, 0x1040062200202ull,
+		0x1040064601ea0ull, 0x1040064a01e00ull, 0x1040065000104ull, 0x1080060e01e02ull,
+		0x1080064601e04ull, 0x1080066201e06ull, 0x10c0060200106ull, 0x10c0060400108ull,
+		0x10c0060e0010aull, 0x10c006180010cull, 0x10c0064e000c7ull, 0x1100060e01e0aull,
+		0x110006180010eull, 0x1100064601e0cull, 0x1100064e01e10ull, 0x1100065a01e12ull,
+		0x1100066201e0eull, 0x11400600000c8ull, 0x11400602000c9ull, 0x11400604000caull,
+		0x1140060601ebcull, 0x1140060800112ull, 0x1140060c00114ull, 0x1140060e00116ull,
+		0x11400610000cbull, 0x1140061201ebaull, 0x114006180011aull, 0x1140061e00204ull,
+		0x1140062200206ull, 0x1140064601eb8ull, 0x1140064e00228ull, 0x1140065000118ull,
+		0x1140065a01e18ull, 0x1140066001e1aull, 0x1180060e01e1eull, 0x11c00602001f4ull,
+		0x11c006040011cull, 0x11c0060801e20ull, 0x11c0060c0011eull, 0x11c0060e00120ull,
+		0x11c00618001e6ull, 0x11c0064e00122ull, 0x1200060400124ull, 0x1200060e01e22ull,
+		0x1200061001e26ull, 0x120006180021eull, 0x1200064601e24ull, 0x1200064e01e28ull,
+		0x1200065c01e2aull, 0x12400600000ccull, 0x12400602000cdull, 0x12400604000ceull,
+		0x1240060600128ull, 0x124006080012aull, 0x1240060c0012cull, 0x1240060e00130ull,
+		0x12400610000cfull, 0x1240061201ec8ull, 0x12400618001cfull, 0x1240061e00208ull,
+		0x124006220020aull, 0x1240064601ecaull, 0x124006500012eull, 0x1240066001e2cull,
+		0x1280060400134ull, 0x12c0060201e30ull, 0x12c00618001e8ull, 0x12c0064601e32ull,
+		0x12c0064e00136ull, 0x12c0066201e34ull, 0x1300060200139ull, 0x130006180013dull,
+		0x1300064601e36ull, 0x1300064e0013bull, 0x1300065a01e3cull, 0x1300066201e3aull,
+		0x1340060201e3eull, 0x1340060e01e40ull, 0x1340064601e42ull, 0x13800600001f8ull,
+		0x1380060200143ull, 0x13800606000d1ull, 0x1380060e01e44ull, 0x1380061800147ull,
+		0x1380064601e46ull, 0x1380064e00145ull, 0x1380065a01e4aull, 0x1380066201e48ull,
+		0x13c00600000d2ull, 0x13c00602000d3ull, 0x13c00604000d4ull, 0x13c00606000d5ull,
+		0x13c006080014cull, 0x13c0060c0014eull, 0x13c0060e0022eull, 0x13c00610000d6ull,
+		0x13c0061201eceull, 0x13c0061600150ull, 0x13c00618001d1ull, 0x13c0061e0020cull,
+		0x13c006220020eull, 0x13c00636001a0ull, 0x13c0064601eccull, 0x13c00650001eaull,
+		0x1400060201e54ull, 0x1400060e01e56ull, 0x1480060200154ull, 0x1480060e01e58ull,
+		0x1480061800158ull, 0x1480061e00210ull, 0x1480062200212ull, 0x1480064601e5aull,
+		0x1480064e00156ull, 0x1480066201e5eull, 0x14c006020015aull, 0x14c006040015cull,
+		0x14c0060e01e60ull, 0x14c0061800160ull, 0x14c0064601e62ull, 0x14c0064c00218ull,
+		0x14c0064e0015eull, 0x1500060e01e6aull, 0x1500061800164ull, 0x1500064601e6cull,
+		0x1500064c0021aull, 0x1500064e00162ull, 0x1500065a01e70ull, 0x1500066201e6eull,
+		0x15400600000d9ull, 0x15400602000daull, 0x15400604000dbull, 0x1540060600168ull,
+		0x154006080016aull, 0x1540060c0016cull, 0x15400610000dcull, 0x1540061201ee6ull,
+		0x154006140016eull, 0x1540061600170ull, 0x15400618001d3ull, 0x1540061e00214ull,
+		0x1540062200216ull, 0x15400636001afull, 0x1540064601ee4ull, 0x1540064801e72ull,
+		0x1540065000172ull, 0x1540065a01e76ull, 0x1540066001e74ull, 0x1580060601e7cull,
+		0x1580064601e7eull, 0x15c0060001e80ull, 0x15c0060201e82ull, 0x15c0060400174ull,
+		0x15c0060e01e86ull, 0x15c0061001e84ull, 0x15c0064601e88ull, 0x1600060e01e8aull,
+		0x1600061001e8cull, 0x1640060001ef2ull, 0x16400602000ddull, 0x1640060400176ull,
+		0x1640060601ef8ull, 0x1640060800232ull, 0x1640060e01e8eull, 0x1640061000178ull,
+		0x1640061201ef6ull, 0x1640064601ef4ull, 0x1680060200179ull, 0x1680060401e90ull,
+		0x1680060e0017bull, 0x168006180017dull, 0x1680064601e92ull, 0x1680066201e94ull,
+		0x18400600000e0ull, 0x18400602000e1ull, 0x18400604000e2ull, 0x18400606000e3ull,
+		0x1840060800101ull, 0x1840060c00103ull, 0x1840060e00227ull, 0x18400610000e4ull,
+		0x1840061201ea3ull, 0x18400614000e5ull, 0x18400618001ceull, 0x1840061e00201ull,
+		0x1840062200203ull, 0x1840064601ea1ull, 0x1840064a01e01ull, 0x1840065000105ull,
+		0x1880060e01e03ull, 0x1880064601e05ull, 0x1880066201e07ull, 0x18c0060200107ull,
+		0x18c0060400109ull, 0x18c0060e0010bull, 0x18c006180010dull, 0x18c0064e000e7ull,
+		0x1900060e01e0bull, 0x190006180010full, 0x1900064601e0dull, 0x1900064e01e11ull,
+		0x1900065a01e13ull, 0x1900066201e0full, 0x19400600000e8ull, 0x19400602000e9ull,
+		0x19400604000eaull, 0x1940060601ebdull, 0x1940060800113ull, 0x1940060c00115ull,
+		0x1940060e00117ull, 0x19400610000ebull, 0x1940061201ebbull, 0x194006180011bull,
+		0x1940061e00205ull, 0x1940062200207ull, 0x1940064601eb9ull, 0x1940064e00229ull,
+		0x1940065000119ull, 0x1940065a01e19ull, 0x1940066001e1bull, 0x1980060e01e1full,
+		0x19c00602001f5ull, 0x19c006040011dull, 0x19c0060801e21ull, 0x19c0060c0011full,
+		0x19c0060e00121ull, 0x19c00618001e7ull, 0x19c0064e00123ull, 0x1a00060400125ull,
+		0x1a00060e01e23ull, 0x1a00061001e27ull, 0x1a0006180021full, 0x1a00064601e25ull,
+		0x1a00064e01e29ull, 0x1a00065c01e2bull, 0x1a00066201e96ull, 0x1a400600000ecull,
+		0x1a400602000edull, 0x1a400604000eeull, 0x1a40060600129ull, 0x1a4006080012bull,
+		0x1a40060c0012dull, 0x1a400610000efull, 0x1a40061201ec9ull, 0x1a400618001d0ull,
+		0x1a40061e00209ull, 0x1a4006220020bull, 0x1a40064601ecbull, 0x1a4006500012full,
+		0x1a40066001e2dull, 0x1a80060400135ull, 0x1a800618001f0ull, 0x1ac0060201e31ull,
+		0x1ac00618001e9ull, 0x1ac0064601e33ull, 0x1ac0064e00137ull, 0x1ac0066201e35ull,
+		0x1b0006020013aull, 0x1b0006180013eull, 0x1b00064601e37ull, 0x1b00064e0013cull,
+		0x1b00065a01e3dull, 0x1b00066201e3bull, 0x1b40060201e3full, 0x1b40060e01e41ull,
+		0x1b40064601e43ull, 0x1b800600001f9ull, 0x1b80060200144ull, 0x1b800606000f1ull,
+		0x1b80060e01e45ull, 0x1b80061800148ull, 0x1b80064601e47ull, 0x1b80064e00146ull,
+		0x1b80065a01e4bull, 0x1b80066201e49ull, 0x1bc00600000f2ull, 0x1bc00602000f3ull,
+		0x1bc00604000f4ull, 0x1bc00606000f5ull, 0x1bc006080014dull, 0x1bc0060c0014full,
+		0x1bc0060e0022full, 0x1bc00610000f6ull, 0x1bc0061201ecfull, 0x1bc0061600151ull,
+		0x1bc00618001d2ull, 0x1bc0061e0020dull, 0x1bc006220020full, 0x1bc00636001a1ull,
+		0x1bc0064601ecdull, 0x1bc00650001ebull, 0x1c00060201e55ull, 0x1c00060e01e57ull,
+		0x1c80060200155ull, 0x1c80060e01e59ull, 0x1c80061800159ull, 0x1c80061e00211ull,
+		0x1c80062200213ull, 0x1c80064601e5bull, 0x1c80064e00157ull, 0x1c80066201e5full,
+		0x1cc006020015bull, 0x1cc006040015dull, 0x1cc0060e01e61ull, 0x1cc0061800161ull,
+		0x1cc0064601e63ull, 0x1cc0064c00219ull, 0x1cc0064e0015full, 0x1d00060e01e6bull,
+		0x1d00061001e97ull, 0x1d00061800165ull, 0x1d00064601e6dull, 0x1d00064c0021bull,
+		0x1d00064e00163ull, 0x1d00065a01e71ull, 0x1d00066201e6full, 0x1d400600000f9ull,
+		0x1d400602000faull, 0x1d400604000fbull, 0x1d40060600169ull, 0x1d4006080016bull,
+		0x1d40060c0016dull, 0x1d400610000fcull, 0x1d40061201ee7ull, 0x1d4006140016full,
+		0x1d40061600171ull, 0x1d400618001d4ull, 0x1d40061e00215ull, 0x1d40062200217ull,
+		0x1d400636001b0ull, 0x1d40064601ee5ull, 0x1d40064801e73ull, 0x1d40065000173ull,
+		0x1d40065a01e77ull, 0x1d40066001e75ull, 0x1d80060601e7dull, 0x1d80064601e7full,
+		0x1dc0060001e81ull, 0x1dc0060201e83ull, 0x1dc0060400175ull, 0x1dc0060e01e87ull,
+		0x1dc0061001e85ull, 0x1dc0061401e98ull, 0x1dc0064601e89ull, 0x1e00060e01e8bull,
+		0x1e00061001e8dull, 0x1e40060001ef3ull, 0x1e400602000fdull, 0x1e40060400177ull,
+		0x1e40060601ef9ull, 0x1e40060800233ull, 0x1e40060e01e8full, 0x1e400610000ffull,
+		0x1e40061201ef7ull, 0x1e40061401e99ull, 0x1e40064601ef5ull, 0x1e8006020017aull,
+		0x1e80060401e91ull, 0x1e80060e0017cull, 0x1e8006180017eull, 0x1e80064601e93ull,
+		0x1e80066201e95ull, 0x2a00060001fedull, 0x2a00060200385ull, 0x2a00068401fc1ull,
+		0x3080060001ea6ull, 0x3080060201ea4ull, 0x3080060601eaaull, 0x3080061201ea8ull,
+		0x31000608001deull, 0x31400602001faull, 0x31800602001fcull, 0x31800608001e2ull,
+		0x31c0060201e08ull, 0x3280060001ec0ull, 0x3280060201ebeull, 0x3280060601ec4ull,
+		0x3280061201ec2ull, 0x33c0060201e2eull, 0x3500060001ed2ull, 0x3500060201ed0ull,
+		0x3500060601ed6ull, 0x3500061201ed4ull, 0x3540060201e4cull, 0x354006080022cull,
+		0x3540061001e4eull, 0x358006080022aull, 0x36000602001feull, 0x37000600001dbull,
+		0x37000602001d7ull, 0x37000608001d5ull, 0x37000618001d9ull, 0x3880060001ea7ull,
+		0x3880060201ea5ull, 0x3880060601eabull, 0x3880061201ea9ull, 0x39000608001dfull,
+		0x39400602001fbull, 0x39800602001fdull, 0x39800608001e3ull, 0x39c0060201e09ull,
+		0x3a80060001ec1ull, 0x3a80060201ebfull, 0x3a80060601ec5ull, 0x3a80061201ec3ull,
+		0x3bc0060201e2full, 0x3d00060001ed3ull, 0x3d00060201ed1ull, 0x3d00060601ed7ull,
+		0x3d00061201ed5ull, 0x3d40060201e4dull, 0x3d4006080022dull, 0x3d40061001e4full,
+		0x3d8006080022bull, 0x3e000602001ffull, 0x3f000600001dcull, 0x3f000602001d8ull,
+		0x3f000608001d6ull, 0x3f000618001daull, 0x4080060001eb0ull, 0x4080060201eaeull,
+		0x4080060601eb4ull, 0x4080061201eb2ull, 0x40c0060001eb1ull, 0x40c0060201eafull,
+		0x40c0060601eb5ull, 0x40c0061201eb3ull, 0x4480060001e14ull, 0x4480060201e16ull,
+		0x44c0060001e15ull, 0x44c0060201e17ull, 0x5300060001e50ull, 0x5300060201e52ull,
+		0x5340060001e51ull, 0x5340060201e53ull, 0x5680060e01e64ull, 0x56c0060e01e65ull,
+		0x5800060e01e66ull, 0x5840060e01e67ull, 0x5a00060201e78ull, 0x5a40060201e79ull,
+		0x5a80061001e7aull, 0x5ac0061001e7bull, 0x5fc0060e01e9bull, 0x6800060001edcull,
+		0x6800060201edaull, 0x6800060601ee0ull, 0x6800061201edeull, 0x6800064601ee2ull,
+		0x6840060001eddull, 0x6840060201edbull, 0x6840060601ee1ull, 0x6840061201edfull,
+		0x6840064601ee3ull, 0x6bc0060001eeaull, 0x6bc0060201ee8ull, 0x6bc0060601eeeull,
+		0x6bc0061201eecull, 0x6bc0064601ef0ull, 0x6c00060001eebull, 0x6c00060201ee9ull,
+		0x6c00060601eefull, 0x6c00061201eedull, 0x6c00064601ef1ull, 0x6dc00618001eeull,
+		0x7a800608001ecull, 0x7ac00608001edull, 0x89800608001e0ull, 0x89c00608001e1ull,
+		0x8a00060c01e1cull, 0x8a40060c01e1dull, 0x8b80060800230ull, 0x8bc0060800231ull,
+		0xa4800618001efull, 0xe440060001fbaull, 0xe440060200386ull, 0xe440060801fb9ull,
+		0xe440060c01fb8ull, 0xe440062601f08ull, 0xe440062801f09ull, 0xe440068a01fbcull,
+		0xe540060001fc8ull, 0xe540060200388ull, 0xe540062601f18ull, 0xe540062801f19ull,
+		0xe5c0060001fcaull, 0xe5c0060200389ull, 0xe5c0062601f28ull, 0xe5c0062801f29ull,
+		0xe5c0068a01fccull, 0xe640060001fdaull, 0xe64006020038aull, 0xe640060801fd9ull,
+		0xe640060c01fd8ull, 0xe6400610003aaull, 0xe640062601f38ull, 0xe640062801f39ull,
+		0xe7c0060001ff8ull, 0xe7c006020038cull, 0xe7c0062601f48ull, 0xe7c0062801f49ull,
+		0xe840062801fecull, 0xe940060001feaull, 0xe94006020038eull, 0xe940060801fe9ull,
+		0xe940060c01fe8ull, 0xe9400610003abull, 0xe940062801f59ull, 0xea40060001ffaull,
+		0xea4006020038full, 0xea40062601f68ull, 0xea40062801f69ull, 0xea40068a01ffcull,
+		0xeb00068a01fb4ull, 0xeb80068a01fc4ull, 0xec40060001f70ull, 0xec400602003acull,
+		0xec40060801fb1ull, 0xec40060c01fb0ull, 0xec40062601f00ull, 0xec40062801f01ull,
+		0xec40068401fb6ull, 0xec40068a01fb3ull, 0xed40060001f72ull, 0xed400602003adull,
+		0xed40062601f10ull, 0xed40062801f11ull, 0xedc0060001f74ull, 0xedc00602003aeull,
+		0xedc0062601f20ull, 0xedc0062801f21ull, 0xedc0068401fc6ull, 0xedc0068a01fc3ull,
+		0xee40060001f76ull, 0xee400602003afull, 0xee40060801fd1ull, 0xee40060c01fd0ull,
+		0xee400610003caull, 0xee40062601f30ull, 0xee40062801f31ull, 0xee40068401fd6ull,
+		0xefc0060001f78ull, 0xefc00602003ccull, 0xefc0062601f40ull, 0xefc0062801f41ull,
+		0xf040062601fe4ull, 0xf040062801fe5ull, 0xf140060001f7aull, 0xf1400602003cdull,
+		0xf140060801fe1ull, 0xf140060c01fe0ull, 0xf1400610003cbull, 0xf140062601f50ull,
+		0xf140062801f51ull, 0xf140068401fe6ull, 0xf240060001f7cull, 0xf2400602003ceull,
+		0xf240062601f60ull, 0xf240062801f61ull, 0xf240068401ff6ull, 0xf240068a01ff3ull,
+		0xf280060001fd2ull, 0xf280060200390ull, 0xf280068401fd7ull, 0xf2c0060001fe2ull,
+		0xf2c00602003b0ull, 0xf2c0068401fe7ull, 0xf380068a01ff4ull, 0xf4800602003d3ull,
+		0xf4800610003d4ull, 0x10180061000407ull, 0x10400060c004d0ull, 0x104000610004d2ull,
+		0x104c0060200403ull, 0x10540060000400ull, 0x10540060c004d6ull, 0x10540061000401ull,
+		0x10580060c004c1ull, 0x105800610004dcull, 0x105c00610004deull, 0x1060006000040dull,
+		0x106000608004e2ull, 0x10600060c00419ull, 0x106000610004e4ull, 0x1068006020040cull,
+		0x107800610004e6ull, 0x108c00608004eeull, 0x108c0060c0040eull, 0x108c00610004f0ull,
+		0x108c00616004f2ull, 0x109c00610004f4ull, 0x10ac00610004f8ull, 0x10b400610004ecull,
+		0x10c00060c004d1ull, 0x10c000610004d3ull, 0x10cc0060200453ull, 0x10d40060000450ull,
+		0x10d40060c004d7ull, 0x10d40061000451ull, 0x10d80060c004c2ull, 0x10d800610004ddull,
+		0x10dc00610004dfull, 0x10e0006000045dull, 0x10e000608004e3ull, 0x10e00060c00439ull,
+		0x10e000610004e5ull, 0x10e8006020045cull, 0x10f800610004e7ull, 0x110c00608004efull,
+		0x110c0060c0045eull, 0x110c00610004f1ull, 0x110c00616004f3ull, 0x111c00610004f5ull,
+		0x112c00610004f9ull, 0x113400610004edull, 0x11580061000457ull, 0x11d00061e00476ull,
+		0x11d40061e00477ull, 0x136000610004daull, 0x136400610004dbull, 0x13a000610004eaull,
+		0x13a400610004ebull, 0x189c00ca600622ull, 0x189c00ca800623ull, 0x189c00caa00625ull,
+		0x192000ca800624ull, 0x192800ca800626ull, 0x1b0400ca8006c2ull, 0x1b4800ca8006d3ull,
+		0x1b5400ca8006c0ull, 0x24a00127800929ull, 0x24c00127800931ull, 0x24cc0127800934ull,
+		0x271c0137c009cbull, 0x271c013ae009ccull, 0x2d1c0167c00b4bull, 0x2d1c016ac00b48ull,
+		0x2d1c016ae00b4cull, 0x2e48017ae00b94ull, 0x2f180177c00bcaull, 0x2f18017ae00bccull,
+		0x2f1c0177c00bcbull, 0x3118018ac00c48ull, 0x32fc019aa00cc0ull, 0x33180198400ccaull,
+		0x3318019aa00cc7ull, 0x3318019ac00cc8ull, 0x3328019aa00ccbull, 0x351801a7c00d4aull,
+		0x351801aae00d4cull, 0x351c01a7c00d4bull, 0x376401b9400ddaull, 0x376401b9e00ddcull,
+		0x376401bbe00ddeull, 0x377001b9400dddull, 0x40940205c01026ull, 0x6c140366a01b06ull,
+		0x6c1c0366a01b08ull, 0x6c240366a01b0aull, 0x6c2c0366a01b0cull, 0x6c340366a01b0eull,
+		0x6c440366a01b12ull, 0x6ce80366a01b3bull, 0x6cf00366a01b3dull, 0x6cf80366a01b40ull,
+		0x6cfc0366a01b41ull, 0x6d080366a01b43ull, 0x78d80060801e38ull, 0x78dc0060801e39ull,
+		0x79680060801e5cull, 0x796c0060801e5dull, 0x79880060e01e68ull, 0x798c0060e01e69ull,
+		0x7a800060401eacull, 0x7a800060c01eb6ull, 0x7a840060401eadull, 0x7a840060c01eb7ull,
+		0x7ae00060401ec6ull, 0x7ae40060401ec7ull, 0x7b300060401ed8ull, 0x7b340060401ed9ull,
+		0x7c000060001f02ull, 0x7c000060201f04ull, 0x7c000068401f06ull, 0x7c000068a01f80ull,
+		0x7c040060001f03ull, 0x7c040060201f05ull, 0x7c040068401f07ull, 0x7c040068a01f81ull,
+		0x7c080068a01f82ull, 0x7c0c0068a01f83ull, 0x7c100068a01f84ull, 0x7c140068a01f85ull,
+		0x7c180068a01f86ull, 0x7c1c0068a01f87ull, 0x7c200060001f0aull, 0x7c200060201f0cull,
+		0x7c200068401f0eull, 0x7c200068a01f88ull, 0x7c240060001f0bull, 0x7c240060201f0dull,
+		0x7c240068401f0full, 0x7c240068a01f89ull, 0x7c280068a01f8aull, 0x7c2c0068a01f8bull,
+		0x7c300068a01f8cull, 0x7c340068a01f8dull, 0x7c380068a01f8eull, 0x7c3c0068a01f8full,
+		0x7c400060001f12ull, 0x7c400060201f14ull, 0x7c440060001f13ull, 0x7c440060201f15ull,
+		0x7c600060001f1aull, 0x7c600060201f1cull, 0x7c640060001f1bull, 0x7c640060201f1dull,
+		0x7c800060001f22ull, 0x7c800060201f24ull, 0x7c800068401f26ull, 0x7c800068a01f90ull,
+		0x7c840060001f23ull, 0x7c840060201f25ull, 0x7c840068401f27ull, 0x7c840068a01f91ull,
+		0x7c880068a01f92ull, 0x7c8c0068a01f93ull, 0x7c900068a01f94ull, 0x7c940068a01f95ull,
+		0x7c980068a01f96ull, 0x7c9c0068a01f97ull, 0x7ca00060001f2aull, 0x7ca00060201f2cull,
+		0x7ca00068401f2eull, 0x7ca00068a01f98ull, 0x7ca40060001f2bull, 0x7ca40060201f2dull,
+		0x7ca40068401f2full, 0x7ca40068a01f99ull, 0x7ca80068a01f9aull, 0x7cac0068a01f9bull,
+		0x7cb00068a01f9cull, 0x7cb40068a01f9dull, 0x7cb80068a01f9eull, 0x7cbc0068a01f9full,
+		0x7cc00060001f32ull, 0x7cc00060201f34ull, 0x7cc00068401f36ull, 0x7cc40060001f33ull,
+		0x7cc40060201f35ull, 0x7cc40068401f37ull, 0x7ce00060001f3aull, 0x7ce00060201f3cull,
+		0x7ce00068401f3eull, 0x7ce40060001f3bull, 0x7ce40060201f3dull, 0x7ce40068401f3full,
+		0x7d000060001f42ull, 0x7d000060201f44ull, 0x7d040060001f43ull, 0x7d040060201f45ull,
+		0x7d200060001f4aull, 0x7d200060201f4cull, 0x7d240060001f4bull, 0x7d240060201f4dull,
+		0x7d400060001f52ull, 0x7d400060201f54ull, 0x7d400068401f56ull, 0x7d440060001f53ull,
+		0x7d440060201f55ull, 0x7d440068401f57ull, 0x7d640060001f5bull, 0x7d640060201f5dull,
+		0x7d640068401f5full, 0x7d800060001f62ull, 0x7d800060201f64ull, 0x7d800068401f66ull,
+		0x7d800068a01fa0ull, 0x7d840060001f63ull, 0x7d840060201f65ull, 0x7d840068401f67ull,
+		0x7d840068a01fa1ull, 0x7d880068a01fa2ull, 0x7d8c0068a01fa3ull, 0x7d900068a01fa4ull,
+		0x7d940068a01fa5ull, 0x7d980068a01fa6ull, 0x7d9c0068a01fa7ull, 0x7da00060001f6aull,
+		0x7da00060201f6cull, 0x7da00068401f6eull, 0x7da00068a01fa8ull, 0x7da40060001f6bull,
+		0x7da40060201f6dull, 0x7da40068401f6full, 0x7da40068a01fa9ull, 0x7da80068a01faaull,
+		0x7dac0068a01fabull, 0x7db00068a01facull, 0x7db40068a01fadull, 0x7db80068a01faeull,
+		0x7dbc0068a01fafull, 0x7dc00068a01fb2ull, 0x7dd00068a01fc2ull, 0x7df00068a01ff2ull,
+		0x7ed80068a01fb7ull, 0x7efc0060001fcdull, 0x7efc0060201fceull, 0x7efc0068401fcfull,
+		0x7f180068a01fc7ull, 0x7fd80068a01ff7ull, 0x7ff80060001fddull, 0x7ff80060201fdeull,
+		0x7ff80068401fdfull, 0x8640006700219aull, 0x8648006700219bull, 0x865000670021aeull,
+		0x874000670021cdull, 0x874800670021cfull, 0x875000670021ceull, 0x880c0067002204ull,
+		0x88200067002209ull, 0x882c006700220cull, 0x888c0067002224ull, 0x88940067002226ull,
+		0x88f00067002241ull, 0x890c0067002244ull, 0x89140067002247ull, 0x89200067002249ull,
+		0x8934006700226dull, 0x89840067002262ull, 0x89900067002270ull, 0x89940067002271ull,
+		0x89c80067002274ull, 0x89cc0067002275ull, 0x89d80067002278ull, 0x89dc0067002279ull,
+		0x89e80067002280ull, 0x89ec0067002281ull, 0x89f000670022e0ull, 0x89f400670022e1ull,
+		0x8a080067002284ull, 0x8a0c0067002285ull, 0x8a180067002288ull, 0x8a1c0067002289ull,
+		0x8a4400670022e2ull, 0x8a4800670022e3ull, 0x8a8800670022acull, 0x8aa000670022adull,
+		0x8aa400670022aeull, 0x8aac00670022afull, 0x8ac800670022eaull, 0x8acc00670022ebull,
+		0x8ad000670022ecull, 0x8ad400670022edull, 0xc1180613203094ull, 0xc12c061320304cull,
+		0xc134061320304eull, 0xc13c0613203050ull, 0xc1440613203052ull, 0xc14c0613203054ull,
+		0xc1540613203056ull, 0xc15c0613203058ull, 0xc164061320305aull, 0xc16c061320305cull,
+		0xc174061320305eull, 0xc17c0613203060ull, 0xc1840613203062ull, 0xc1900613203065ull,
+		0xc1980613203067ull, 0xc1a00613203069ull, 0xc1bc0613203070ull, 0xc1bc0613403071ull,
+		0xc1c80613203073ull, 0xc1c80613403074ull, 0xc1d40613203076ull, 0xc1d40613403077ull,
+		0xc1e00613203079ull, 0xc1e0061340307aull, 0xc1ec061320307cull, 0xc1ec061340307dull,
+		0xc274061320309eull, 0xc29806132030f4ull, 0xc2ac06132030acull, 0xc2b406132030aeull,
+		0xc2bc06132030b0ull, 0xc2c406132030b2ull, 0xc2cc06132030b4ull, 0xc2d406132030b6ull,
+		0xc2dc06132030b8ull, 0xc2e406132030baull, 0xc2ec06132030bcull, 0xc2f406132030beull,
+		0xc2fc06132030c0ull, 0xc30406132030c2ull, 0xc31006132030c5ull, 0xc31806132030c7ull,
+		0xc32006132030c9ull, 0xc33c06132030d0ull, 0xc33c06134030d1ull, 0xc34806132030d3ull,
+		0xc34806134030d4ull, 0xc35406132030d6ull, 0xc35406134030d7ull, 0xc36006132030d9ull,
+		0xc36006134030daull, 0xc36c06132030dcull, 0xc36c06134030ddull, 0xc3bc06132030f7ull,
+		0xc3c006132030f8ull, 0xc3c406132030f9ull, 0xc3c806132030faull, 0xc3f406132030feull,
+		0x44264221741109aull, 0x4426c221741109cull, 0x4429422174110abull, 0x444c42224e1112eull,
+		0x444c82224e1112full, 0x44d1c2267c1134bull, 0x44d1c226ae1134cull, 0x452e422960114bcull,
+		0x452e422974114bbull, 0x452e42297a114beull, 0x456e022b5e115baull, 0x456e422b5e115bbull,
+		0x464d42326011938ull,
+	};
+}
+}
+/// \endcond
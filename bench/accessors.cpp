@@ -0,0 +1,30 @@
+// Compares the cost of getting at the characters of a sequence through each of the accessors.
+// Requires C++17 for to_string_view().
+
+#include <CTStr/CTStr.hpp>
+
+#include "bench.hpp"
+
+using short_string = string_to_type("Hello!");
+using long_string = string_to_type("Please enter your name, or press escape to go back to the previous screen.");
+
+template <typename String>
+void run_all(const char* label)
+{
+	const std::size_t iterations = 10000000;
+	std::printf("%s (%zu characters)\n", label, ctstr::size<String>);
+
+	bench::run("  to_string", iterations, [] { bench::do_not_optimize(ctstr::to_string<String>()); });
+	bench::run("  to_c_string", iterations, [] { bench::do_not_optimize(ctstr::to_c_string<String>()); });
+	bench::run("  to_string_view", iterations, [] { bench::do_not_optimize(ctstr::to_string_view<String>()); });
+	bench::run("  data + size", iterations, [] {
+		bench::do_not_optimize(ctstr::data<String>);
+		bench::do_not_optimize(ctstr::size<String>);
+	});
+}
+
+int main()
+{
+	run_all<short_string>("short");
+	run_all<long_string>("long");
+}
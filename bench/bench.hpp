@@ -0,0 +1,42 @@
+// Minimal timing helpers shared by the runtime benchmarks in this directory.
+// Each benchmark is a single .cpp file; build it with something like
+//     g++ -std=c++17 -O2 -I<directory containing CTStr> bench/accessors.cpp
+// and run it.  Results are printed as "name: ns/op".
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench
+{
+	// Keeps the optimizer from throwing away a value we computed only to measure how long it took.
+	template <typename T>
+	inline void do_not_optimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &value;
+#endif
+	}
+
+	// Calls f() iterations times and prints the average time per call.  Returns that average in nanoseconds.
+	template <typename F>
+	double run(const char* name, std::size_t iterations, F&& f)
+	{
+		for (std::size_t i = 0; i < iterations / 10 + 1; ++i)
+			f();
+
+		auto start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < iterations; ++i)
+			f();
+		auto end = std::chrono::steady_clock::now();
+
+		double ns = std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+		std::printf("%-48s %10.2f ns/op\n", name, ns);
+		return ns;
+	}
+}
@@ -0,0 +1,47 @@
+// ctstr::build against std::string operator+ and std::ostringstream, making metric names like "svc.<name>.latency.p<n>".
+// Requires C++17.
+
+#include <CTStr/Build.hpp>
+
+#include "bench.hpp"
+
+#include <sstream>
+#include <string>
+
+int main()
+{
+	const std::size_t iterations = 5000000;
+	std::string name = "checkout";
+	int percentile = 99;
+
+	bench::run("ctstr::build", iterations, [&] {
+		bench::do_not_optimize(ctstr::build(string_to_type("svc."){}, name, string_to_type(".latency.p"){}, percentile));
+	});
+	bench::run("ctstr::build_to (caller buffer)", iterations, [&] {
+		char buffer[256];
+		bench::do_not_optimize(ctstr::build_to(buffer, string_to_type("svc."){}, name, string_to_type(".latency.p"){}, percentile));
+		bench::do_not_optimize(buffer);
+	});
+	bench::run("std::string operator+", iterations, [&] {
+		bench::do_not_optimize("svc." + name + ".latency.p" + std::to_string(percentile));
+	});
+	bench::run("std::ostringstream", iterations, [&] {
+		std::ostringstream stream;
+		stream << "svc." << name << ".latency.p" << percentile;
+		bench::do_not_optimize(stream.str());
+	});
+
+	// Long enough that none of them fit in the small string buffer.
+	std::string long_name = "payments-authorization-gateway";
+	bench::run("ctstr::build (long)", iterations, [&] {
+		bench::do_not_optimize(ctstr::build(string_to_type("service."){}, long_name, string_to_type(".latency.p"){}, percentile, string_to_type(".seconds"){}));
+	});
+	bench::run("std::string operator+ (long)", iterations, [&] {
+		bench::do_not_optimize("service." + long_name + ".latency.p" + std::to_string(percentile) + ".seconds");
+	});
+	bench::run("std::ostringstream (long)", iterations, [&] {
+		std::ostringstream stream;
+		stream << "service." << long_name << ".latency.p" << percentile << ".seconds";
+		bench::do_not_optimize(stream.str());
+	});
+}
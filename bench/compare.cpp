@@ -0,0 +1,61 @@
+// ctstr::equals / starts_with against std::string::compare, operator== and memcmp, on HTTP-style header names.
+// Requires C++17.  Try it with and without -mavx2.
+
+#include <CTStr/Compare.hpp>
+#include <CTStr/Paged.hpp>
+
+#include "bench.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+// 20,000 characters, far too many to unroll, so equals hands them to memcmp.
+#define TIMES_10(s) s s s s s s s s s s
+static constexpr char long_text[] = TIMES_10(TIMES_10(TIMES_10("The quick brown fox ")));
+using long_string = ctstr::paged_t<long_text>;
+
+int main()
+{
+	const std::size_t iterations = 50000000;
+	const std::vector<std::string> names = { "Content-Length", "Content-Type", "Host", "Transfer-Encoding", "content-length", "Accept-Encoding", "Connection", "Content-Lengths" };
+	const std::string expected = "Content-Length";
+	std::size_t next = 0;
+
+	bench::run("ctstr::equals (14 chars)", iterations, [&] {
+		const std::string& name = names[next++ & 7];
+		bench::do_not_optimize(ctstr::equals<string_to_type("Content-Length")>(name.data(), name.size()));
+	});
+	bench::run("std::string::compare (14 chars)", iterations, [&] {
+		const std::string& name = names[next++ & 7];
+		bench::do_not_optimize(name.compare("Content-Length") == 0);
+	});
+	bench::run("std::string operator== (14 chars)", iterations, [&] {
+		const std::string& name = names[next++ & 7];
+		bench::do_not_optimize(name == expected);
+	});
+	bench::run("length + memcmp (14 chars)", iterations, [&] {
+		const std::string& name = names[next++ & 7];
+		bench::do_not_optimize(name.size() == 14 && std::memcmp(name.data(), "Content-Length", 14) == 0);
+	});
+
+	const std::string line = "Transfer-Encoding: chunked, gzip, and a few other things to make this longer than 32 bytes";
+	bench::run("ctstr::starts_with (41 chars)", iterations, [&] {
+		bench::do_not_optimize(ctstr::starts_with<string_to_type("Transfer-Encoding: chunked, gzip, and a f")>(line.data(), line.size()));
+	});
+	bench::run("std::string::compare (41 chars)", iterations, [&] {
+		bench::do_not_optimize(line.compare(0, 41, "Transfer-Encoding: chunked, gzip, and a f") == 0);
+	});
+
+	// The same text, and the same with its last character changed, so both have to be read to the end.
+	const std::string texts[2] = { long_text, std::string(long_text, sizeof(long_text) - 2) + '!' };
+	const std::string& expected_text = texts[0];
+	bench::run("ctstr::equals (20000 chars, paged)", iterations / 1000, [&] {
+		const std::string& text = texts[next++ & 1];
+		bench::do_not_optimize(ctstr::equals<long_string>(text.data(), text.size()));
+	});
+	bench::run("std::string operator== (20000 chars)", iterations / 1000, [&] {
+		const std::string& text = texts[next++ & 1];
+		bench::do_not_optimize(text == expected_text);
+	});
+}
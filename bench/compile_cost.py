@@ -0,0 +1,421 @@
+#!/usr/bin/env python3
+"""Measures how much it costs to compile code that uses string_to_type.
+
+For every combination of compiler, CTSTR_MAX_STRING_SIZE and string count this
+generates a translation unit with that many distinct strings, each used as the
+parameter type of its own function (the same way get_translation is overloaded
+in example.cpp), compiles it once and records:
+
+    wall_s        wall-clock time of the compiler invocation
+    peak_rss_kb   peak resident set size of the compiler
+    obj_bytes     size of the resulting object file
+    symbol_bytes  total length of all the (mangled) symbol names in the object
+    link_s        wall-clock time to link the object into an executable
+
+Results are written as CSV to stdout (or --output).  Runs that exceed --timeout
+are recorded with status "timeout" instead of stopping the whole suite, because
+the large corners of the default matrix can easily take hours.
+
+Examples:
+    bench/compile_cost.py                                # full matrix, GCC and Clang
+    bench/compile_cost.py --sizes 0x100 --counts 100     # a single quick data point
+    bench/compile_cost.py --nttp --std c++20             # the CTSTR_USE_NTTP engine
+    bench/compile_cost.py --packed --length 200          # Packed.hpp's packed_string_to_type
+    bench/compile_cost.py --algorithms --sizes 0x10000   # Algorithms.hpp on a 64K string
+    bench/compile_cost.py --unicode --sizes 0x1000       # Unicode.hpp's transcoding and normalization
+    bench/compile_cost.py --paged --sizes 0x10000 0x100000   # Paged.hpp against string_to_type on long text
+    bench/compile_cost.py --pregenerated --files 50 --counts 1000   # tools/pregenerate.py on a 50k-string project
+
+With --algorithms it instead compiles, for every size, one string of exactly that
+many characters put through each of the operations in Algorithms.hpp in turn
+(plus "none", which only builds the string, as a baseline).  --unicode does the
+same for the conversions in Unicode.hpp, on a UTF-32 string where half the code
+points decompose or combine.
+
+With --paged it compiles, for every size, one string of that length, made both
+with string_to_type (with CTSTR_MAX_STRING_SIZE just big enough, as long as that's
+no more than 0x10000) and with Paged.hpp's paged_t from a constexpr array, and
+searches each for a substring that isn't there.
+
+With --pregenerated it builds a project of --files translation units, each with
+--counts distinct strings, with string_to_type as usual, then through
+tools/pregenerate.py and CTSTR_PREGENERATED_HEADER with one header for the whole
+project, then with its --split header for each file.  Each is timed building from
+scratch, rebuilding after an edit to one file that doesn't add a string, and
+rebuilding after one that does (which rewrites a header, and so rebuilds every
+file that includes it).  Files are compiled --jobs at a time, and the time the
+tool takes is included in the pregenerated builds and also shown by itself.
+
+Linux only (uses wait4() for the RSS measurement and nm for the symbol sizes).
+"""
+
+import argparse
+import concurrent.futures
+import csv
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+DEFAULT_COMPILERS = ["g++", "clang++"]
+DEFAULT_SIZES = [0x10, 0x20, 0x40, 0x80, 0x100, 0x200, 0x400, 0x800, 0x1000]
+DEFAULT_COUNTS = [10, 100, 1000, 10000]
+
+# Each is a declaration that makes the compiler work out the result for the string S.
+ALGORITHMS = {
+    "none":     "static_assert(ctstr::size<S> > 0, \"\");",
+    "substr":   "static_assert(ctstr::size<ctstr::substr_t<S, N / 4, N / 2>> == N / 2, \"\");",
+    "find":     "static_assert(ctstr::find_v<S, string_to_type(\"zz\")> == ctstr::npos, \"\");",
+    "rfind":    "static_assert(ctstr::rfind_v<S, string_to_type(\",\")> != ctstr::npos, \"\");",
+    "split":    "static_assert(std::tuple_size<ctstr::split_t<S, string_to_type(\",\")>>::value > 1, \"\");",
+    "replace":  "static_assert(ctstr::size<ctstr::replace_t<S, string_to_type(\",\"), string_to_type(\";;\")>> > N, \"\");",
+    "trim":     "static_assert(ctstr::size<ctstr::trim_t<S>> == N - 8, \"\");",
+    "to_upper": "static_assert(ctstr::size<ctstr::to_upper_t<S>> == N, \"\");",
+    "concat":   "static_assert(ctstr::size<ctstr::concat_t<S, S, S>> == 3 * N, \"\");",
+}
+
+# The same for Unicode.hpp.
+UNICODE = {
+    "none":     "static_assert(ctstr::size<S> > 0, \"\");",
+    "to_utf8":  "static_assert(ctstr::size<ctstr::to_utf8_t<S>> > N, \"\");",
+    "to_utf16": "static_assert(ctstr::size<ctstr::to_utf16_t<S>> == N, \"\");",
+    "nfd":      "static_assert(ctstr::size<ctstr::nfd_t<S>> > N, \"\");",
+    "nfc":      "static_assert(ctstr::size<ctstr::nfc_t<S>> < N, \"\");",
+}
+
+PREGENERATED_FIELDS = ["compiler", "engine", "max_string_size", "step", "files", "strings", "status",
+                       "wall_s", "tool_s", "peak_rss_kb"]
+
+PAGED_FIELDS = ["compiler", "engine", "string_length", "status", "wall_s", "peak_rss_kb"]
+
+ALGORITHM_FIELDS = ["compiler", "algorithm", "string_length", "status", "wall_s", "peak_rss_kb"]
+
+FIELDS = ["compiler", "engine", "max_string_size", "strings", "string_length",
+          "status", "wall_s", "peak_rss_kb", "obj_bytes", "symbol_bytes", "link_s"]
+
+
+def make_string(index, length):
+    """Returns a distinct string of exactly `length` characters (at least as long as the index needs)."""
+    key = "k%d_" % index
+    return (key * (length // len(key) + 1))[:max(length, len(key))]
+
+
+def write_source(path, count, length, packed):
+    with open(path, "w") as f:
+        f.write("#include <CTStr/Packed.hpp>\n\n" if packed else "#include <CTStr/CTStr.hpp>\n\n")
+        macro = "packed_string_to_type" if packed else "string_to_type"
+        for i in range(count):
+            f.write('int use(%s("%s")) { return %d; }\n' % (macro, make_string(i, length), i))
+        f.write("\nint main() { return 0; }\n")
+
+
+def write_algorithm_source(path, length, algorithm):
+    # The string is built straight from an index_sequence rather than with string_to_type,
+    # so that only the algorithm is being measured: four spaces at each end for trim, and a comma every 16 characters.
+    with open(path, "w") as f:
+        f.write("#include <CTStr/Algorithms.hpp>\n\n")
+        f.write("constexpr std::size_t N = %d;\n" % length)
+        f.write("template <std::size_t...I>\n"
+                "auto make(std::index_sequence<I...>) -> std::integer_sequence<char,\n"
+                "    (I < 4 || I >= N - 4? ' ' : I % 16 == 15? ',' : static_cast<char>('a' + I % 26))...>;\n")
+        f.write("using S = decltype(make(std::make_index_sequence<N>{}));\n\n")
+        f.write(ALGORITHMS[algorithm] + "\n")
+
+
+def write_unicode_source(path, length, conversion):
+    # Every fourth code point is a combining acute accent, after an 'a'-'z' (which composes with it), a precomposed 'é'
+    # (which it has to be reordered and composed against) or a Hangul syllable (which decomposes arithmetically).
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("#include <CTStr/Unicode.hpp>\n\n")
+        f.write("constexpr std::size_t N = %d;\n" % length)
+        f.write("template <std::size_t...I>\n"
+                "auto make(std::index_sequence<I...>) -> std::integer_sequence<char32_t,\n"
+                "    (I % 4 == 3? 0x301 : I % 8 == 1? 0xAC01 : I % 8 == 2? 0xE9 : static_cast<char32_t>('a' + I % 26))...>;\n")
+        f.write("using S = decltype(make(std::make_index_sequence<N>{}));\n\n")
+        f.write(UNICODE[conversion] + "\n")
+
+
+def write_paged_source(path, length, engine):
+    text = make_string(0, length)
+    with open(path, "w") as f:
+        f.write("#include <CTStr/Algorithms.hpp>\n\n")
+        if engine == "paged":
+            f.write('constexpr char text[] = "%s";\nusing S = ctstr::paged_t<text>;\n' % text)
+        else:
+            f.write('using S = string_to_type("%s");\n' % text)
+        f.write('static_assert(ctstr::find_v<S, string_to_type("zz")> == ctstr::npos, "");\n')
+
+
+def run_paged(args, compilers, out, scratch, inc):
+    writer = csv.DictWriter(out, fieldnames=PAGED_FIELDS)
+    writer.writeheader()
+    for size in args.sizes:
+        max_size = 1
+        while max_size <= size:
+            max_size *= 2
+        for engine in ("macro", "paged"):
+            src = os.path.join(scratch, "paged.cpp")
+            write_paged_source(src, size, engine)
+            for compiler in compilers:
+                row = {"compiler": compiler, "engine": engine, "string_length": size}
+                if engine == "macro" and max_size > 0x10000:
+                    row["status"] = "too_long"
+                    writer.writerow(row)
+                    continue
+                obj = os.path.join(scratch, "paged.o")
+                # The paged string doesn't go through string_to_type, so only the needle needs to fit.
+                macro_size = max_size if engine == "macro" else 0x10
+                cmd = [compiler, "-std=" + args.std, "-I" + inc, "-DCTSTR_MAX_STRING_SIZE=%#x" % macro_size,
+                       "-c", src, "-o", obj] + args.flags.split()
+                code, wall, rss, err = run_compiler(cmd, args.timeout)
+                row["wall_s"] = "%.3f" % wall
+                if code is None:
+                    row["status"] = "timeout"
+                elif code != 0:
+                    row["status"] = "error"
+                    print(err, file=sys.stderr)
+                else:
+                    row.update(status="ok", peak_rss_kb=rss)
+                writer.writerow(row)
+                out.flush()
+                if os.path.exists(obj):
+                    os.remove(obj)
+
+
+def write_project_file(path, index, count, length, extra):
+    with open(path, "w") as f:
+        f.write("#include <CTStr/CTStr.hpp>\n\n")
+        for i in range(count):
+            f.write('int use(string_to_type("%s")) { return %d; }\n' % (make_string(index * count + i, length), i))
+        f.write(extra)
+
+
+def run_pregenerated(args, compilers, out, scratch, inc):
+    writer = csv.DictWriter(out, fieldnames=PREGENERATED_FIELDS)
+    writer.writeheader()
+    count = args.counts[0]
+    src_dir = os.path.join(scratch, "src")
+    gen_dir = os.path.join(scratch, "gen")
+    os.makedirs(src_dir, exist_ok=True)
+    sources = [os.path.join(src_dir, "strings_%03d.cpp" % i) for i in range(args.files)]
+    tool = [sys.executable, os.path.join(REPO_ROOT, "tools", "pregenerate.py")]
+
+    # The generated headers each source depends on, and the one it's compiled with.
+    def headers(engine, src):
+        if engine == "pregenerated":
+            return ["ctstr_literals.hpp"]
+        return [os.path.basename(src).replace(".", "_") + ".hpp", "ctstr_common.hpp"]
+
+    def build(compiler, size, engine, files):
+        cmd = [compiler, "-std=" + args.std, "-I" + inc, "-I" + gen_dir, "-DCTSTR_MAX_STRING_SIZE=%#x" % size] + args.flags.split()
+        def compile_one(src):
+            defines = [] if engine == "macro" else ["-DCTSTR_PREGENERATED_HEADER=\"%s\"" % headers(engine, src)[0]]
+            return run_compiler(cmd + defines + ["-c", src, "-o", src + ".o"], args.timeout)
+        start = time.monotonic()
+        with concurrent.futures.ThreadPoolExecutor(args.jobs) as pool:
+            results = list(pool.map(compile_one, files))
+        wall = time.monotonic() - start
+        for code, _, _, err in results:
+            if code:
+                print(err, file=sys.stderr)
+        status = "timeout" if any(r[0] is None for r in results) else "error" if any(r[0] for r in results) else "ok"
+        return status, wall, max(r[2] for r in results)
+
+    def mtime(path):
+        return os.path.getmtime(path) if os.path.exists(path) else None
+
+    for compiler in compilers:
+        for size in args.sizes:
+            for engine in ("macro", "pregenerated", "split"):
+                for i, src in enumerate(sources):
+                    write_project_file(src, i, count, args.length, "")
+                shutil.rmtree(gen_dir, ignore_errors=True)
+
+                for step in ("full", "touch", "new_string"):
+                    if step == "touch":
+                        write_project_file(sources[0], 0, count, args.length, "int edited() { return 1; }\n")
+                    elif step == "new_string":
+                        write_project_file(sources[0], 0, count, args.length, 'int use(string_to_type("new")) { return -1; }\n')
+
+                    row = {"compiler": compiler, "engine": engine, "max_string_size": hex(size), "step": step,
+                           "files": args.files, "strings": args.files * count}
+                    tool_s = 0.0
+                    rebuild = sources if step == "full" else sources[:1]
+                    if engine != "macro":
+                        before = {src: [mtime(os.path.join(gen_dir, h)) for h in headers(engine, src)] for src in sources}
+                        output = ["-o", os.path.join(gen_dir, "ctstr_literals.hpp")] if engine == "pregenerated" else ["--split", gen_dir]
+                        start = time.monotonic()
+                        subprocess.run(tool + output + [src_dir], check=True, stderr=subprocess.DEVNULL)
+                        tool_s = time.monotonic() - start
+                        # Like make, also rebuild whatever includes a header that was rewritten.
+                        rebuild = [src for src in sources if src in rebuild
+                                   or [mtime(os.path.join(gen_dir, h)) for h in headers(engine, src)] != before[src]]
+                    status, wall, rss = build(compiler, size, engine, rebuild)
+                    row.update(status=status, wall_s="%.3f" % (wall + tool_s), tool_s="%.3f" % tool_s, peak_rss_kb=rss)
+                    writer.writerow(row)
+                    out.flush()
+
+
+def run_algorithms(args, compilers, out, scratch, inc):
+    writer = csv.DictWriter(out, fieldnames=ALGORITHM_FIELDS)
+    writer.writeheader()
+    operations, write = (UNICODE, write_unicode_source) if args.unicode else (ALGORITHMS, write_algorithm_source)
+    for size in args.sizes:
+        for algorithm in operations:
+            src = os.path.join(scratch, "algorithm.cpp")
+            write(src, size, algorithm)
+            for compiler in compilers:
+                row = {"compiler": compiler, "algorithm": algorithm, "string_length": size}
+                obj = os.path.join(scratch, "algorithm.o")
+                cmd = [compiler, "-std=" + args.std, "-I" + inc, "-c", src, "-o", obj] + args.flags.split()
+                code, wall, rss, err = run_compiler(cmd, args.timeout)
+                row["wall_s"] = "%.3f" % wall
+                if code is None:
+                    row["status"] = "timeout"
+                elif code != 0:
+                    row["status"] = "error"
+                    print(err, file=sys.stderr)
+                else:
+                    row.update(status="ok", peak_rss_kb=rss)
+                writer.writerow(row)
+                out.flush()
+                if os.path.exists(obj):
+                    os.remove(obj)
+
+
+def include_dir(scratch):
+    # Sources include <CTStr/CTStr.hpp>, so make the repository reachable under that name.
+    link = os.path.join(scratch, "include")
+    os.makedirs(link, exist_ok=True)
+    target = os.path.join(link, "CTStr")
+    if not os.path.exists(target):
+        os.symlink(REPO_ROOT, target)
+    return link
+
+
+def run_compiler(cmd, timeout):
+    # stderr goes to a file rather than a pipe so a chatty compiler can't block while we poll it.
+    with tempfile.TemporaryFile() as err:
+        start = time.monotonic()
+        proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=err)
+        deadline = start + timeout if timeout else None
+        while True:
+            pid, status, usage = os.wait4(proc.pid, os.WNOHANG)
+            if pid:
+                wall = time.monotonic() - start
+                proc.returncode = os.waitstatus_to_exitcode(status)
+                err.seek(0)
+                return proc.returncode, wall, usage.ru_maxrss, err.read().decode(errors="replace")
+            if deadline and time.monotonic() > deadline:
+                proc.kill()
+                os.wait4(proc.pid, 0)
+                proc.returncode = -1
+                return None, time.monotonic() - start, 0, ""
+            time.sleep(0.01)
+
+
+def symbol_bytes(nm, obj):
+    out = subprocess.run([nm, "-P", obj], stdout=subprocess.PIPE, check=True).stdout.decode(errors="replace")
+    return sum(len(line.split(" ", 1)[0]) for line in out.splitlines() if line)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compilers", nargs="+", default=DEFAULT_COMPILERS)
+    parser.add_argument("--sizes", nargs="+", type=lambda s: int(s, 0), default=DEFAULT_SIZES,
+                        help="values of CTSTR_MAX_STRING_SIZE to test")
+    parser.add_argument("--counts", nargs="+", type=int, default=DEFAULT_COUNTS,
+                        help="numbers of distinct strings per translation unit")
+    parser.add_argument("--length", type=int, default=8, help="length of each generated string")
+    parser.add_argument("--std", default="c++14")
+    parser.add_argument("--nttp", action="store_true", help="compile with CTSTR_USE_NTTP=1")
+    parser.add_argument("--packed", action="store_true",
+                        help="overload on packed_string_to_type instead, to compare symbol, object and link sizes")
+    parser.add_argument("--algorithms", action="store_true",
+                        help="measure Algorithms.hpp on one string of each size instead (implies at least --std c++17)")
+    parser.add_argument("--unicode", action="store_true",
+                        help="the same as --algorithms, but for Unicode.hpp's conversions")
+    parser.add_argument("--paged", action="store_true",
+                        help="compare Paged.hpp with string_to_type on one string of each size (implies at least --std c++17)")
+    parser.add_argument("--pregenerated", action="store_true",
+                        help="compare builds of a whole project with and without tools/pregenerate.py, using --files and the first of --counts")
+    parser.add_argument("--files", type=int, default=50, help="translation units in the --pregenerated project")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count(), help="files compiled at once with --pregenerated")
+    parser.add_argument("--flags", default="-O0", help="extra compiler flags")
+    parser.add_argument("--timeout", type=float, default=600, help="seconds per compile; 0 for no limit")
+    parser.add_argument("--nm", default="nm")
+    parser.add_argument("--output", help="CSV file to write instead of stdout")
+    args = parser.parse_args()
+
+    compilers = [c for c in args.compilers if shutil.which(c)]
+    for missing in set(args.compilers) - set(compilers):
+        print("skipping %s: not found" % missing, file=sys.stderr)
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    if args.pregenerated:
+        # A whole project at every size would take all day; default to just the library's own default.
+        if args.sizes == DEFAULT_SIZES:
+            args.sizes = [0x100]
+        with tempfile.TemporaryDirectory(prefix="ctstr_bench_") as scratch:
+            run_pregenerated(args, compilers, out, scratch, include_dir(scratch))
+        return
+    if args.algorithms or args.unicode or args.paged:
+        if args.std in ("c++11", "c++14"):
+            args.std = "c++17"
+        with tempfile.TemporaryDirectory(prefix="ctstr_bench_") as scratch:
+            (run_paged if args.paged else run_algorithms)(args, compilers, out, scratch, include_dir(scratch))
+        return
+
+    writer = csv.DictWriter(out, fieldnames=FIELDS)
+    writer.writeheader()
+
+    with tempfile.TemporaryDirectory(prefix="ctstr_bench_") as scratch:
+        inc = include_dir(scratch)
+        for count in args.counts:
+            src = os.path.join(scratch, "strings_%d.cpp" % count)
+            write_source(src, count, args.length, args.packed)
+            for compiler in compilers:
+                # The NTTP engine ignores CTSTR_MAX_STRING_SIZE, so there's no point sweeping it.
+                sizes = args.sizes[:1] if args.nttp else args.sizes
+                for size in sizes:
+                    engine = ("nttp" if args.nttp else "macro") + ("+packed" if args.packed else "")
+                    row = {"compiler": compiler, "engine": engine,
+                           "max_string_size": "-" if args.nttp else hex(size), "strings": count, "string_length": args.length}
+                    if not args.nttp and args.length >= size:
+                        row["status"] = "too_long"
+                        writer.writerow(row)
+                        continue
+
+                    obj = os.path.join(scratch, "strings.o")
+                    cmd = [compiler, "-std=" + args.std, "-I" + inc, "-DCTSTR_MAX_STRING_SIZE=%#x" % size,
+                           "-DCTSTR_USE_NTTP=%d" % args.nttp, "-c", src, "-o", obj] + args.flags.split()
+                    code, wall, rss, err = run_compiler(cmd, args.timeout)
+                    row["wall_s"] = "%.3f" % wall
+                    if code is None:
+                        row["status"] = "timeout"
+                    elif code != 0:
+                        row["status"] = "error"
+                        print(err, file=sys.stderr)
+                    else:
+                        row.update(status="ok", peak_rss_kb=rss, obj_bytes=os.path.getsize(obj),
+                                   symbol_bytes=symbol_bytes(args.nm, obj))
+                        exe = os.path.join(scratch, "strings")
+                        code, wall, _, err = run_compiler([compiler, obj, "-o", exe] + args.flags.split(), args.timeout)
+                        if code == 0:
+                            row["link_s"] = "%.3f" % wall
+                        else:
+                            print(err, file=sys.stderr)
+                        if os.path.exists(exe):
+                            os.remove(exe)
+                    writer.writerow(row)
+                    out.flush()
+                    if os.path.exists(obj):
+                        os.remove(obj)
+
+
+if __name__ == "__main__":
+    main()
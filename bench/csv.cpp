@@ -0,0 +1,170 @@
+// ctstr::csv_schema reading a 256 MB CSV file on 1, 2, 4, ... threads, against a generic reader that looks the columns
+// up by name in the header and splits each row into fields before converting them.  Requires C++17.
+// Results are in GB/s of CSV text.
+
+#include <CTStr/Csv.hpp>
+#include <CTStr/Serialize.hpp>
+
+#include "bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct event
+{
+	std::int64_t ts;
+	std::string user;
+	std::string action;
+	double amount;
+	std::int32_t count;
+};
+
+template <>
+struct ctstr::fields_of<event> : ctstr::fields<
+	ctstr::field<string_to_type("ts"), &event::ts>,
+	ctstr::field<string_to_type("user"), &event::user>,
+	ctstr::field<string_to_type("action"), &event::action>,
+	ctstr::field<string_to_type("amount"), &event::amount>,
+	ctstr::field<string_to_type("count"), &event::count>> {};
+
+using events = ctstr::csv_schema<
+	ctstr::col<string_to_type("ts"), std::int64_t>,
+	ctstr::col<string_to_type("user"), std::string_view>,
+	ctstr::col<string_to_type("action"), std::string_view>,
+	ctstr::col<string_to_type("amount"), double>,
+	ctstr::col<string_to_type("count"), std::int32_t>>;
+
+// What we're replacing: find each column by name, split every row into fields, then convert the ones we want.
+struct generic_columns
+{
+	std::vector<std::int64_t> ts;
+	std::vector<std::string_view> user, action;
+	std::vector<double> amount;
+	std::vector<std::int32_t> count;
+};
+
+static std::size_t split_row(std::string_view text, std::size_t pos, std::vector<std::string_view>& fields)
+{
+	fields.clear();
+	std::size_t start = pos;
+	bool quoted = false;
+	for (; pos < text.size(); ++pos)
+	{
+		char c = text[pos];
+		if (c == '"')
+			quoted = !quoted;
+		else if (!quoted && (c == ',' || c == '\n'))
+		{
+			std::string_view f = text.substr(start, pos - start);
+			if (f.size() >= 2 && f.front() == '"')
+				f = f.substr(1, f.size() - 2);
+			fields.push_back(f);
+			start = pos + 1;
+			if (c == '\n')
+				return pos + 1;
+		}
+	}
+	fields.push_back(text.substr(start));
+	return pos;
+}
+
+static generic_columns generic_read(std::string_view text)
+{
+	std::vector<std::string_view> fields;
+	std::size_t pos = split_row(text, 0, fields);
+	std::unordered_map<std::string, std::size_t> index;
+	for (std::size_t i = 0; i < fields.size(); ++i)
+		index[std::string(fields[i])] = i;
+	std::size_t ts = index.at("ts"), user = index.at("user"), action = index.at("action"), amount = index.at("amount"), count = index.at("count");
+
+	generic_columns out;
+	while (pos < text.size())
+	{
+		pos = split_row(text, pos, fields);
+		std::int64_t t = 0;
+		double a = 0;
+		std::int32_t c = 0;
+		std::from_chars(fields[ts].data(), fields[ts].data() + fields[ts].size(), t);
+		std::from_chars(fields[amount].data(), fields[amount].data() + fields[amount].size(), a);
+		std::from_chars(fields[count].data(), fields[count].data() + fields[count].size(), c);
+		out.ts.push_back(t);
+		out.user.push_back(fields[user]);
+		out.action.push_back(fields[action]);
+		out.amount.push_back(a);
+		out.count.push_back(c);
+	}
+	return out;
+}
+
+// f() returns how many rows it read.  Prints the best of three runs, since the page faults make the first few noisy.
+template <typename F>
+static double throughput(const char* name, std::size_t bytes, F&& f)
+{
+	double best = 0;
+	std::size_t rows = 0;
+	for (int run = 0; run < 3; ++run)
+	{
+		auto start = std::chrono::steady_clock::now();
+		rows = f();
+		auto end = std::chrono::steady_clock::now();
+		best = std::max(best, static_cast<double>(bytes) / std::chrono::duration<double>(end - start).count() / 1e9);
+	}
+	std::printf("%-40s %8.3f GB/s  (%zu rows)\n", name, best, rows);
+	return best;
+}
+
+int main()
+{
+	const char* users[] = { "alice", "bob", "carol", "dave", "erin", "frank" };
+	const char* actions[] = { "login", "logout", "purchase", "refund, partial", "checkout" };
+	std::string csv;
+	csv.reserve(270u << 20);
+	ctstr::write_csv_header<event>(csv);
+	for (std::size_t i = 0; csv.size() < (256u << 20); ++i)
+	{
+		ctstr::write_csv(csv, event{ 1700000000000 + static_cast<std::int64_t>(i) * 37, users[i % 6] + std::to_string(i % 1000),
+		                             actions[i % 5], static_cast<double>(i % 100000) / 100.0, static_cast<std::int32_t>(i % 50) });
+	}
+
+	const char* path = "ctstr_bench.csv";
+	std::FILE* file = std::fopen(path, "wb");
+	if (!file || std::fwrite(csv.data(), 1, csv.size(), file) != csv.size() || std::fclose(file) != 0)
+	{
+		std::printf("can't write %s\n", path);
+		return 1;
+	}
+
+	generic_columns expected = generic_read(csv);
+	events::table check = events::parse(csv);
+	auto same = [](const auto& a, const auto& b) { return std::equal(a.begin(), a.end(), b.begin(), b.end()); };
+	if (!same(ctstr::get<string_to_type("ts")>(check), expected.ts) || !same(ctstr::get<string_to_type("user")>(check), expected.user)
+	    || !same(ctstr::get<string_to_type("action")>(check), expected.action) || !same(ctstr::get<string_to_type("amount")>(check), expected.amount)
+	    || !same(ctstr::get<string_to_type("count")>(check), expected.count))
+	{
+		std::printf("readers disagree\n");
+		return 1;
+	}
+	std::printf("%zu MB, %zu rows\n", csv.size() >> 20, check.size());
+
+	throughput("generic reader, 1 thread", csv.size(), [&] { return generic_read(csv).ts.size(); });
+	unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+	double one = 0;
+	for (unsigned threads = 1;; threads = threads * 2 > cores && threads < cores? cores : threads * 2)
+	{
+		char name[64];
+		std::snprintf(name, sizeof(name), "ctstr::csv_schema, %u thread%s", threads, threads == 1? "" : "s");
+		double gbps = throughput(name, csv.size(), [&] { return events::parse_file(path, ',', threads).size(); });
+		if (threads == 1)
+			one = gbps;
+		else
+			std::printf("%-40s %8.2fx\n", "  speedup over 1 thread", gbps / one);
+		if (threads >= cores)
+			break;
+	}
+	std::remove(path);
+}
@@ -0,0 +1,59 @@
+// Matching a runtime string against n compile-time strings: ctstr::dispatch vs. an if/else chain vs. std::unordered_map.
+// Requires C++17.
+
+#include <CTStr/Dispatch.hpp>
+
+#include "bench.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// "key_0000", "key_0001", ... built directly as sequences so we can have thousands of them without thousands of literals.
+template <std::size_t I>
+using key = std::integer_sequence<char, 'k', 'e', 'y', '_', '0' + I / 1000 % 10, '0' + I / 100 % 10, '0' + I / 10 % 10, '0' + I % 10>;
+
+template <std::size_t...I>
+void run_all(std::index_sequence<I...>)
+{
+	constexpr std::size_t n = sizeof...(I);
+	const std::size_t iterations = 2000000;
+
+	// Half hits, half misses, visited in a scrambled order so the branch predictor can't just learn the sequence.
+	std::vector<std::string> inputs;
+	for (std::size_t i = 0; i < 1024; ++i)
+	{
+		char buffer[16];
+		std::snprintf(buffer, sizeof(buffer), "%s_%04zu", i % 2? "key" : "bad", (i * 2654435761u) % n);
+		inputs.push_back(buffer);
+	}
+
+	std::unordered_map<std::string_view, std::size_t> map{ { ctstr::to_string_view<key<I>>(), I }... };
+
+	std::printf("n = %zu\n", n);
+	std::size_t next = 0;
+	bench::run("  ctstr::dispatch", iterations, [&] {
+		std::string_view str = inputs[next++ & 1023];
+		bench::do_not_optimize(ctstr::dispatch<key<I>...>(str, [](auto tag) { return ctstr::size<decltype(tag)>; }, [] { return std::size_t(0); }));
+	});
+	bench::run("  if/else chain", iterations, [&] {
+		std::string_view str = inputs[next++ & 1023];
+		std::size_t result = 0;
+		static_cast<void>(((str == ctstr::to_string_view<key<I>>()? (result = I + 1, true) : false) || ...));
+		bench::do_not_optimize(result);
+	});
+	bench::run("  std::unordered_map", iterations, [&] {
+		std::string_view str = inputs[next++ & 1023];
+		auto it = map.find(str);
+		bench::do_not_optimize(it == map.end()? 0 : it->second);
+	});
+}
+
+int main()
+{
+	run_all(std::make_index_sequence<8>{});
+	run_all(std::make_index_sequence<64>{});
+	run_all(std::make_index_sequence<512>{});
+	run_all(std::make_index_sequence<4096>{});
+}
@@ -0,0 +1,109 @@
+// ctstr::fixed_string against std::string for building a short message out of constant parts and a name of up to 32
+// characters, then copying it around.  Requires C++17.
+// Every global allocation is counted, and each case prints how many it made per operation.
+
+#include <CTStr/FixedString.hpp>
+
+#include "bench.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t size)
+{
+	++allocations;
+	if (void* p = std::malloc(size? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using greeting = string_to_type("Hello, ");
+using message_type = decltype(greeting{} + ctstr::fixed_string<32>() + string_to_type("!"){});
+static_assert(message_type::capacity() == 7 + 32 + 1, "The capacity comes from the parts' lengths.");
+
+// Runs f() through bench::run and prints how many allocations each call made.
+template <typename F>
+static void measure(const char* name, std::size_t iterations, F&& f)
+{
+	std::size_t before = allocations;
+	bench::run(name, iterations, f);
+	std::printf("%-48s %10.2f allocations/op\n", "", static_cast<double>(allocations - before) / static_cast<double>(iterations + iterations / 10 + 1));
+}
+
+int main()
+{
+	// Names from 3 to 32 characters, so most of the messages are too long for std::string's small buffer.
+	std::vector<std::string> names;
+	for (std::size_t i = 0; i < 256; ++i)
+		names.push_back(std::string(3 + i * 7919 % 30, static_cast<char>('a' + i % 26)));
+
+	std::vector<std::string> std_messages;
+	std::vector<message_type> fixed_messages;
+	for (const std::string& name : names)
+	{
+		std_messages.push_back("Hello, " + name + "!");
+		fixed_messages.push_back(greeting{} + ctstr::fixed_string<32>(name) + string_to_type("!"){});
+		if (std_messages.back() != fixed_messages.back())
+		{
+			std::printf("messages disagree\n");
+			return 1;
+		}
+	}
+
+	const std::size_t iterations = 10000000;
+	std::size_t i = 0;
+
+	measure("build: std::string", iterations, [&] {
+		std::string message = "Hello, " + names[++i & 255] + "!";
+		bench::do_not_optimize(message);
+	});
+	measure("build: ctstr::fixed_string<40>", iterations, [&] {
+		auto message = greeting{} + ctstr::fixed_string<32>(names[++i & 255]) + string_to_type("!"){};
+		bench::do_not_optimize(message);
+	});
+
+	// Each copy is made in a slot of a preallocated array rather than in a local: handing a 42 byte local straight to
+	// do_not_optimize spills it to the stack and reads it back, and on some machines that store forwarding stall was most
+	// of what got measured.  The std::string in the slot is destroyed first, so every copy is a new string, as a local is.
+	std::vector<std::string> string_slots(1024);
+	std::vector<message_type> fixed_slots(1024);
+	std::size_t slot = 0;
+	measure("copy: std::string", iterations, [&] {
+		slot = (slot + 1) & 1023;
+		std::destroy_at(&string_slots[slot]);
+		new (&string_slots[slot]) std::string(std_messages[++i & 255]);
+		bench::do_not_optimize(string_slots[slot].data());
+	});
+	measure("copy: ctstr::fixed_string<40>", iterations, [&] {
+		slot = (slot + 1) & 1023;
+		new (&fixed_slots[slot]) message_type(fixed_messages[++i & 255]);
+		bench::do_not_optimize(fixed_slots[slot].data());
+	});
+
+	// Handing messages to another thread through a queue: a std::string has to be copied into a fresh node (or
+	// serialized), while a fixed_string can be memcpy'd straight into a slot of a preallocated ring.
+	std::vector<std::string> string_ring;
+	string_ring.reserve(1024);
+	measure("queue: std::vector<std::string>", iterations, [&] {
+		if (string_ring.size() == 1024)
+			string_ring.clear();
+		string_ring.push_back(std_messages[++i & 255]);
+		bench::do_not_optimize(string_ring.back());
+	});
+	std::vector<unsigned char> byte_ring(1024 * sizeof(message_type));
+	measure("queue: memcpy of ctstr::fixed_string<40>", iterations, [&] {
+		slot = (slot + 1) & 1023;
+		std::memcpy(byte_ring.data() + slot * sizeof(message_type), &fixed_messages[++i & 255], sizeof(message_type));
+		bench::do_not_optimize(byte_ring[slot * sizeof(message_type)]);
+	});
+}
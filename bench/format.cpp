@@ -0,0 +1,52 @@
+// ctstr::format against substituting %N placeholders at runtime (what a catalog of translated strings would otherwise do) and snprintf.
+// Requires C++17.
+
+#include <CTStr/Format.hpp>
+
+#include "bench.hpp"
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+// A straightforward runtime version: scan for %N every time and append to a std::string.
+static std::string runtime_format(std::string_view format, const std::string* args, std::size_t count)
+{
+	std::string result;
+	for (std::size_t i = 0; i < format.size(); ++i)
+	{
+		if (format[i] == '%' && i + 1 < format.size() && format[i + 1] >= '0' && format[i + 1] <= '9')
+		{
+			std::size_t index = static_cast<std::size_t>(format[++i] - '0');
+			if (index < count)
+				result += args[index];
+		}
+		else
+			result += format[i];
+	}
+	return result;
+}
+
+int main()
+{
+	const std::size_t iterations = 5000000;
+	int count = 5, month = 12, day = 25, year = 2016;
+
+	bench::run("ctstr::format", iterations, [&] {
+		bench::do_not_optimize(ctstr::format<string_to_type("It happened %0 times on %1/%2/%3")>(count, month, day, year));
+	});
+	bench::run("ctstr::format_to (caller buffer)", iterations, [&] {
+		char buffer[256];
+		bench::do_not_optimize(ctstr::format_to<string_to_type("It happened %0 times on %1/%2/%3")>(buffer, count, month, day, year));
+		bench::do_not_optimize(buffer);
+	});
+	bench::run("runtime %N substitution", iterations, [&] {
+		const std::string args[] = { std::to_string(count), std::to_string(month), std::to_string(day), std::to_string(year) };
+		bench::do_not_optimize(runtime_format("It happened %0 times on %1/%2/%3", args, 4));
+	});
+	bench::run("snprintf", iterations, [&] {
+		char buffer[256];
+		bench::do_not_optimize(std::snprintf(buffer, sizeof(buffer), "It happened %d times on %d/%d/%d", count, month, day, year));
+		bench::do_not_optimize(buffer);
+	});
+}
@@ -0,0 +1,74 @@
+// Checks that ctstr::fnv1a/xxh64/crc32c at runtime give exactly the fnv1a_v/xxh64_v/crc32c_v computed at compile time,
+// for every length from 0 to 100 characters of char, char16_t and char32_t strings, read from every alignment.
+// Exits non-zero if any of them differ, then times the runtime hashes.  Requires C++17.
+
+#include <CTStr/Algorithms.hpp>
+#include <CTStr/Hash.hpp>
+
+#include "bench.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+
+using text = string_to_type("The quick brown fox jumps over the lazy dog, then naps; pack my box with five dozen liquor jugs; 0123456789 ABCDEFGHIJ klmnopqrst \x7F\x80\xFF!");
+using text16 = string_to_type(u"The quick brown fox jumps over the lazy dog, then naps; pack my box with five dozen liquor jugs; 0123456789 é中￿ ABCDEFGHIJKLMNOPQRSTUVWXYZ!");
+using text32 = string_to_type(U"The quick brown fox jumps over the lazy dog, then naps; pack my box with five dozen liquor jugs; 0123456789 é\U0001F600\U0010FFFF ABCDEFGHIJKLMNOPQRSTUVWXYZ!");
+
+static_assert(ctstr::size<text> >= 100 && ctstr::size<text16> >= 100 && ctstr::size<text32> >= 100, "The texts have to cover every length checked.");
+
+// Hashes the first Length characters of SeqType from a buffer at each of 8 byte offsets; returns how many disagreed.
+template <typename SeqType, std::size_t Length>
+static int check_prefix()
+{
+	using prefix = ctstr::substr_t<SeqType, 0, Length>;
+	using char_type = typename ctstr::sequence_type<prefix>::type;
+
+	int wrong = 0;
+	alignas(64) unsigned char buffer[8 + sizeof(char_type) * (Length + 1)];
+	for (std::size_t offset = 0; offset < 8; ++offset)
+	{
+		std::memcpy(buffer + offset, ctstr::data<prefix>, sizeof(char_type) * Length);
+		const char_type* str = reinterpret_cast<const char_type*>(buffer + offset);
+		bool same = ctstr::fnv1a(str, Length) == ctstr::fnv1a_v<prefix> && ctstr::xxh64(str, Length) == ctstr::xxh64_v<prefix>
+		         && ctstr::crc32c(str, Length) == ctstr::crc32c_v<prefix>;
+		if (!same)
+		{
+			std::printf("mismatch: %zu-byte characters, length %zu, offset %zu\n", sizeof(char_type), Length, offset);
+			++wrong;
+		}
+	}
+	return wrong;
+}
+
+template <typename SeqType, std::size_t...Lengths>
+static int check_prefixes(std::index_sequence<Lengths...>)
+{
+	return (check_prefix<SeqType, Lengths>() + ...);
+}
+
+int main()
+{
+	int wrong = check_prefixes<text>(std::make_index_sequence<101>()) + check_prefixes<text16>(std::make_index_sequence<101>())
+	          + check_prefixes<text32>(std::make_index_sequence<101>());
+	if (wrong != 0)
+	{
+		std::printf("%d runtime hashes differ from the compile-time ones\n", wrong);
+		return 1;
+	}
+	std::printf("runtime and compile-time hashes agree\n");
+
+	const std::size_t iterations = 20000000;
+	const std::string keys[4] = { "Host", "Content-Length", "application/x-www-form-urlencoded", std::string(ctstr::to_string_view<text>()) };
+	for (const std::string& key : keys)
+	{
+		char name[64];
+		std::snprintf(name, sizeof(name), "ctstr::fnv1a (%zu chars)", key.size());
+		bench::run(name, iterations, [&] { bench::do_not_optimize(ctstr::fnv1a(key.data(), key.size())); });
+		std::snprintf(name, sizeof(name), "ctstr::xxh64 (%zu chars)", key.size());
+		bench::run(name, iterations, [&] { bench::do_not_optimize(ctstr::xxh64(key.data(), key.size())); });
+		std::snprintf(name, sizeof(name), "ctstr::crc32c (%zu chars)", key.size());
+		bench::run(name, iterations, [&] { bench::do_not_optimize(ctstr::crc32c(key.data(), key.size())); });
+	}
+}
@@ -0,0 +1,68 @@
+// Latency percentiles of CTSTR_LOG on the calling thread, against formatting synchronously with fprintf.
+// Requires C++17 and threads (-pthread).  Writes bench_log.txt, bench_log.ctlog and bench_fprintf.txt.
+//
+// Every call is timed on its own, so the numbers include the cost of reading the clock twice.
+// Messages are logged in bursts with pauses in between, so that the writer keeps up and nothing is dropped.
+
+#include <CTStr/Log.hpp>
+
+#include "bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename F>
+void percentiles(const char* name, F&& f)
+{
+	const std::size_t bursts = 200, burst = 1000;
+	std::vector<double> ns;
+	ns.reserve(bursts * burst);
+	int request = 0;
+	for (std::size_t b = 0; b < bursts; ++b)
+	{
+		for (std::size_t i = 0; i < burst; ++i)
+		{
+			auto start = std::chrono::steady_clock::now();
+			f(++request);
+			auto end = std::chrono::steady_clock::now();
+			ns.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(2));
+	}
+	std::sort(ns.begin(), ns.end());
+	auto at = [&](double p) { return ns[static_cast<std::size_t>(p * static_cast<double>(ns.size() - 1))]; };
+	std::printf("%-36s p50 %8.1f ns   p99 %8.1f ns   p99.9 %8.1f ns   max %10.1f ns\n", name, at(0.5), at(0.99), at(0.999), ns.back());
+}
+
+int main()
+{
+	std::string user = "alice@example.com";
+	double elapsed = 12.75;
+
+	{
+		ctstr::log_writer writer("bench_log.txt");
+		percentiles("CTSTR_LOG (text writer)", [&](int request) {
+			CTSTR_LOG("Request %0 from %1 took %2 ms", request, user, elapsed);
+		});
+	}
+	{
+		ctstr::log_writer writer("bench_log.ctlog", ctstr::log_output::binary);
+		percentiles("CTSTR_LOG (binary writer)", [&](int request) {
+			CTSTR_LOG("Request %0 from %1 took %2 ms", request, user, elapsed);
+		});
+	}
+	{
+		std::FILE* file = std::fopen("bench_fprintf.txt", "w");
+		percentiles("fprintf", [&](int request) {
+			auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+			std::fprintf(file, "%lld.%09lld Request %d from %s took %g ms\n", static_cast<long long>(now / 1000000000), static_cast<long long>(now % 1000000000), request, user.c_str(), elapsed);
+		});
+		std::fclose(file);
+	}
+
+	std::printf("dropped messages: %llu\n", static_cast<unsigned long long>(ctstr::log_writer::dropped()));
+}
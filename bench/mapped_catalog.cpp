@@ -0,0 +1,101 @@
+// ctstr::mapped_catalog with a million translations, against std::unordered_map<std::string, std::string>.
+// Requires C++17 and threads.
+//
+// Writes the catalog to the path given as the first argument (mapped_catalog.ctc by default), checks that every
+// entry reads back, times lookups, and then reloads the file over and over while other threads keep reading it.
+
+#include <CTStr/MappedCatalog.hpp>
+
+#include "bench.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+static std::string source(std::size_t i)      { return "string " + std::to_string(i); }
+static std::string translation(std::size_t i) { return "translation of string " + std::to_string(i); }
+
+int main(int argc, char** argv)
+{
+	const std::size_t count = 1000000;
+	const std::string path = argc > 1? argv[1] : "mapped_catalog.ctc";
+
+	{
+		ctstr::mapped_catalog_writer writer;
+		for (std::size_t i = 0; i < count; ++i)
+			if (!writer.add(source(i), translation(i)))
+				return std::printf("duplicate key for %s\n", source(i).c_str()), 1;
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		writer.write(out);
+	}
+
+	ctstr::mapped_catalog catalog(path);
+	std::size_t wrong = catalog.size() != count;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		std::string s = source(i);
+		auto text = catalog.find(ctstr::xxh64(s.data(), s.size()));
+		wrong += !text || *text != translation(i);
+	}
+	wrong += catalog.find(ctstr::xxh64("not in the catalog", 18)).has_value();
+	wrong += catalog.lookup<string_to_type("string 123456")>() != "translation of string 123456";
+	wrong += catalog.lookup<string_to_type("not in the catalog")>() != "not in the catalog";
+	std::printf("%zu entries checked, %zu wrong\n", count, wrong);
+
+	std::unordered_map<std::string, std::string> map;
+	for (std::size_t i = 0; i < count; ++i)
+		map.emplace(source(i), translation(i));
+
+	// Random keys, so both tables are mostly out of cache like a real catalog would be.
+	std::vector<std::string> sources;
+	std::vector<std::uint64_t> keys;
+	std::mt19937_64 random(1);
+	for (std::size_t i = 0; i < 4096; ++i)
+	{
+		sources.push_back(source(random() % count));
+		keys.push_back(ctstr::xxh64(sources.back().data(), sources.back().size()));
+	}
+
+	const std::size_t iterations = 10000000;
+	std::size_t next = 0;
+	bench::run("mapped_catalog::lookup<S> (compile-time key)", iterations, [&] {
+		bench::do_not_optimize(catalog.lookup<string_to_type("string 123456")>());
+	});
+	bench::run("mapped_catalog::find (precomputed key, random)", iterations, [&] {
+		bench::do_not_optimize(catalog.find(keys[next++ & 4095]));
+	});
+	bench::run("unordered_map<string, string>::find (random)", iterations, [&] {
+		bench::do_not_optimize(map.find(sources[next++ & 4095]));
+	});
+
+	// Hot-swap: readers take a snapshot per "frame" while the main thread keeps replacing the catalog.
+	ctstr::live_catalog live(path);
+	std::atomic<bool> done{ false };
+	std::atomic<std::size_t> frames{ 0 }, mismatches{ 0 };
+	std::vector<std::thread> readers;
+	for (int t = 0; t < 4; ++t)
+		readers.emplace_back([&] {
+			while (!done.load(std::memory_order_relaxed))
+			{
+				auto snapshot = live.current();
+				for (int i = 0; i < 100; ++i)
+					mismatches += snapshot->lookup<string_to_type("string 123456")>() != "translation of string 123456";
+				++frames;
+			}
+		});
+	const int reloads = 200;
+	for (int i = 0; i < reloads; ++i)
+		live.reload(path);
+	done = true;
+	for (std::thread& reader : readers)
+		reader.join();
+	std::printf("%d reloads under %zu reader frames, %zu wrong\n", reloads, frames.load(), mismatches.load());
+
+	std::remove(path.c_str());
+	return wrong || mismatches? 1 : 0;
+}
@@ -0,0 +1,51 @@
+// ctstr::record against the std::map / std::unordered_map of std::any it replaces, reading one setting by name.
+// Requires C++17.
+
+#include <CTStr/Record.hpp>
+
+#include "bench.hpp"
+
+#include <any>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using config = ctstr::record<
+	ctstr::named<string_to_type("host"), std::string_view>,
+	ctstr::named<string_to_type("port"), int>,
+	ctstr::named<string_to_type("verbose"), bool>,
+	ctstr::named<string_to_type("timeout_ms"), int>,
+	ctstr::named<string_to_type("retries"), int>,
+	ctstr::named<string_to_type("ratio"), double>,
+	ctstr::named<string_to_type("user"), std::string_view>,
+	ctstr::named<string_to_type("compress"), bool>>;
+
+int main()
+{
+	const std::size_t iterations = 20000000;
+	config c("localhost", 8080, false, 250, 3, 0.75, "svc", true);
+
+	std::map<std::string, std::any, std::less<>> ordered;
+	std::unordered_map<std::string, std::any> unordered;
+	ordered["host"] = std::string_view("localhost"); ordered["port"] = 8080; ordered["verbose"] = false; ordered["timeout_ms"] = 250;
+	ordered["retries"] = 3; ordered["ratio"] = 0.75; ordered["user"] = std::string_view("svc"); ordered["compress"] = true;
+	unordered.insert(ordered.begin(), ordered.end());
+
+	// Read through a volatile pointer so the name isn't a constant the compiler can fold away in the runtime lookups.
+	const char* volatile name = "timeout_ms";
+
+	bench::run("ctstr::get<Key> (compile-time name)", iterations, [&] {
+		bench::do_not_optimize(c);
+		bench::do_not_optimize(ctstr::get<string_to_type("timeout_ms")>(c));
+	});
+	bench::run("ctstr::get_if<int> (runtime name)", iterations, [&] {
+		bench::do_not_optimize(*ctstr::get_if<int>(c, name));
+	});
+	bench::run("std::map<std::string, std::any>", iterations, [&] {
+		bench::do_not_optimize(std::any_cast<int>(ordered.find(std::string_view(name))->second));
+	});
+	bench::run("std::unordered_map<std::string, std::any>", iterations, [&] {
+		bench::do_not_optimize(std::any_cast<int>(unordered.find(name)->second));
+	});
+}
@@ -0,0 +1,101 @@
+// ctstr::regex against std::regex and a hand-written matcher, on IDs like "abc-12345".
+// Requires C++17.
+
+#include <CTStr/Regex.hpp>
+
+#include "bench.hpp"
+
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+using order_id = ctstr::regex<string_to_type("[a-z]{3}-[0-9]+")>;
+// Every 'a' could start a match that only fails at the very end of a run of them.
+using almost = ctstr::regex<string_to_type("[a-z]+X")>;
+
+static bool hand_written(std::string_view s)
+{
+	if (s.size() < 5)
+		return false;
+	for (std::size_t i = 0; i < 3; ++i)
+		if (s[i] < 'a' || s[i] > 'z')
+			return false;
+	if (s[3] != '-')
+		return false;
+	for (std::size_t i = 4; i < s.size(); ++i)
+		if (s[i] < '0' || s[i] > '9')
+			return false;
+	return true;
+}
+
+int main()
+{
+	// Half valid IDs, half with one character broken somewhere.
+	std::mt19937 rng(12345);
+	std::vector<std::string> ids;
+	for (std::size_t i = 0; i < 1024; ++i)
+	{
+		std::string id;
+		for (std::size_t j = 0; j < 3; ++j)
+			id += static_cast<char>('a' + rng() % 26);
+		id += '-';
+		for (std::size_t j = 0, n = 1 + rng() % 10; j < n; ++j)
+			id += static_cast<char>('0' + rng() % 10);
+		if (i % 2)
+			id[rng() % id.size()] = '!';
+		ids.push_back(id);
+	}
+
+	// A log with an ID every few words, for search and find_all.
+	std::string text;
+	while (text.size() < (1u << 20))
+	{
+		text += rng() % 4? "request served in 12 ms " : "";
+		text += ids[rng() % ids.size()];
+		text += ' ';
+	}
+
+	std::size_t i = 0;
+	const std::regex std_regex("[a-z]{3}-[0-9]+");
+
+	std::printf("match, per ID:\n");
+	bench::run("ctstr::regex::match", 10000000, [&] { bench::do_not_optimize(order_id::match(ids[i++ & 1023])); });
+	bench::run("hand-written", 10000000, [&] { bench::do_not_optimize(hand_written(ids[i++ & 1023])); });
+	bench::run("std::regex_match", 1000000, [&] { bench::do_not_optimize(std::regex_match(ids[i & 1023].begin(), ids[i & 1023].end(), std_regex)); ++i; });
+
+	std::printf("\nfind_all, per 1 MB of text:\n");
+	bench::run("ctstr::regex::find_all", 20, [&] {
+		bench::do_not_optimize(order_id::find_all(text, [](std::string_view m) { bench::do_not_optimize(m); }));
+	});
+	bench::run("std::sregex_iterator", 2, [&] {
+		std::size_t count = 0;
+		for (std::sregex_iterator it(text.begin(), text.end(), std_regex), end; it != end; ++it)
+			++count;
+		bench::do_not_optimize(count);
+	});
+
+	// Searching should take time linear in the length of the text, however many places a match nearly starts.  Doubling
+	// the text twice would make a quadratic search take 4 times as long per byte.
+	std::printf("\nfind_all with no match, \"[a-z]+X\" in 'aaa...':\n");
+	double per_byte[3] = {};
+	for (std::size_t k = 0; k < 3; ++k)
+	{
+		const std::string as((100000u << k), 'a');
+		char name[64];
+		std::snprintf(name, sizeof(name), "ctstr::regex::find_all (%zu KB)", as.size() / 1000);
+		std::size_t matches = 0;
+		per_byte[k] = bench::run(name, 20, [&] { matches += almost::find_all(as, [](std::string_view) {}); }) / static_cast<double>(as.size());
+		if (matches != 0)
+		{
+			std::printf("found a match that isn't there\n");
+			return 1;
+		}
+	}
+	std::printf("%-48s %10.2fx\n", "  time per byte, 400 KB over 100 KB", per_byte[2] / per_byte[0]);
+	if (per_byte[2] > per_byte[0] * 2.5)
+	{
+		std::printf("search isn't linear\n");
+		return 1;
+	}
+}
@@ -0,0 +1,151 @@
+// ctstr::router against a matcher that loops over runtime-registered patterns, the way most embedded HTTP servers do it.
+// Requires C++17.
+
+#include <CTStr/Algorithms.hpp>
+#include <CTStr/Router.hpp>
+
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Ten routes for each of "/api/r00", "/api/r01", ..., in the order a first-match router needs them in (fixed segments
+// before parameters), so that both routers pick the same route for every path.
+using shapes = std::tuple<string_to_type(""), string_to_type("/new"), string_to_type("/search"), string_to_type("/:id"),
+                          string_to_type("/:id/edit"), string_to_type("/:id/history"), string_to_type("/:id/comments"),
+                          string_to_type("/:id/comments/:comment"), string_to_type("/:id/tags"), string_to_type("/:id/tags/:tag")>;
+
+template <std::size_t R>
+using resource = std::integer_sequence<char, '/', 'a', 'p', 'i', '/', 'r', '0' + R / 10 % 10, '0' + R % 10>;
+
+template <std::size_t I>
+using pattern = ctstr::concat_t<resource<I / 10>, std::tuple_element_t<I % 10, shapes>>;
+
+struct count_parameters
+{
+	template <typename Params>
+	std::size_t operator()(const Params& params) const { return Params::size() == 0? 0 : params[0].size(); }
+};
+
+class linear_router
+{
+	struct entry
+	{
+		std::vector<std::string> segments;
+		std::vector<bool> is_parameter;
+	};
+	std::vector<entry> routes;
+
+	static std::size_t split(std::string_view path, std::string_view* out, std::size_t max)
+	{
+		std::size_t n = 0;
+		for (std::size_t pos = 1;; ++pos)
+		{
+			if (n == max)
+				return max + 1;
+			std::size_t end = path.find('/', pos);
+			if (end == std::string_view::npos)
+				end = path.size();
+			out[n++] = path.substr(pos, end - pos);
+			if ((pos = end) == path.size())
+				return n;
+		}
+	}
+
+public:
+	static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+	void add(std::string_view pattern)
+	{
+		std::string_view segments[16];
+		entry e;
+		for (std::size_t i = 0, n = split(pattern, segments, 16); i < n; ++i)
+		{
+			e.segments.emplace_back(segments[i]);
+			e.is_parameter.push_back(!segments[i].empty() && segments[i][0] == ':');
+		}
+		routes.push_back(std::move(e));
+	}
+
+	std::size_t match(std::string_view path, std::string_view* params) const
+	{
+		std::string_view segments[16];
+		if (path.empty() || path[0] != '/')
+			return npos;
+		std::size_t n = split(path, segments, 16);
+		for (std::size_t i = 0; i < routes.size(); ++i)
+		{
+			const entry& e = routes[i];
+			if (e.segments.size() != n)
+				continue;
+			std::size_t k = 0, d = 0;
+			for (; d < n; ++d)
+			{
+				if (e.is_parameter[d] && !segments[d].empty())
+					params[k++] = segments[d];
+				else if (e.is_parameter[d] || e.segments[d] != segments[d])
+					break;
+			}
+			if (d == n)
+				return i;
+		}
+		return npos;
+	}
+};
+
+template <std::size_t...I>
+void run_all(std::index_sequence<I...>)
+{
+	using routes = ctstr::router<ctstr::route<pattern<I>, count_parameters>...>;
+	constexpr std::size_t n = sizeof...(I);
+
+	linear_router linear;
+	(linear.add(ctstr::to_string_view<pattern<I>>()), ...);
+
+	// A path for a random route of a random resource, with about one in ten not matching anything.
+	static const char* const shape_paths[] = { "", "/new", "/search", "/%u", "/%u/edit", "/%u/history", "/%u/comments", "/%u/comments/%u", "/%u/tags", "/%u/tags/%u" };
+	std::mt19937 rng(12345);
+	std::vector<std::string> paths;
+	for (std::size_t i = 0; i < 1024; ++i)
+	{
+		char buffer[64];
+		unsigned resource = rng() % (n / 10), id = rng() % 100000, other = rng() % 1000;
+		int used = std::snprintf(buffer, sizeof(buffer), "/api/%c%02u", rng() % 10? 'r' : 'x', resource);
+		std::snprintf(buffer + used, sizeof(buffer) - used, shape_paths[rng() % 10], id, other);
+		paths.push_back(buffer);
+	}
+
+	// Both have to agree before their timings mean anything.
+	for (const std::string& path : paths)
+	{
+		std::string_view params[4];
+		auto found = routes::match(path);
+		std::size_t expected = linear.match(path, params);
+		if ((found? found.route : linear_router::npos) != expected || (found && found.parameters[0] != params[0]))
+		{
+			std::printf("routers disagree on %s\n", path.c_str());
+			std::exit(1);
+		}
+	}
+
+	std::printf("%zu routes (%zu tree nodes):\n", n, routes::node_count);
+	std::size_t next = 0;
+	bench::run("  ctstr::router::match", 5000000, [&] { bench::do_not_optimize(routes::match(paths[next++ & 1023])); });
+	bench::run("  ctstr::router::dispatch", 5000000, [&] {
+		bench::do_not_optimize(routes::dispatch(paths[next++ & 1023], [] { return std::size_t(0); }));
+	});
+	bench::run("  linear matcher", n > 100? 200000 : 2000000, [&] {
+		std::string_view params[4];
+		bench::do_not_optimize(linear.match(paths[next++ & 1023], params));
+		bench::do_not_optimize(params);
+	});
+}
+
+int main()
+{
+	run_all(std::make_index_sequence<50>{});
+	run_all(std::make_index_sequence<500>{});
+}
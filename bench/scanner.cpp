@@ -0,0 +1,74 @@
+// Throughput of ctstr::scanner looking for several markers at once, against running memmem once per marker.
+// Requires C++17 and glibc (for memmem).
+
+#include <CTStr/Scanner.hpp>
+
+#include "bench.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using markers = ctstr::scanner<
+	string_to_type("ERROR"), string_to_type("FATAL"), string_to_type("panic:"), string_to_type("Traceback"),
+	string_to_type("OutOfMemory"), string_to_type("segfault"), string_to_type("timed out"), string_to_type("refused")>;
+
+static const char* const marker_strings[] = { "ERROR", "FATAL", "panic:", "Traceback", "OutOfMemory", "segfault", "timed out", "refused" };
+
+template <typename F>
+void time_it(const char* name, const std::string& text, F&& f)
+{
+	auto start = std::chrono::steady_clock::now();
+	std::size_t matches = f();
+	auto end = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>(end - start).count();
+	std::printf("%-40s %8.3f GB/s  (%zu matches)\n", name, static_cast<double>(text.size()) / seconds / 1e9, matches);
+}
+
+int main()
+{
+	// 256 MB of log-like text with a marker every few KB.
+	const char* const words[] = { "INFO", "request", "served", "in", "ms", "user", "id=42", "GET", "/index.html", "200", "cache", "hit" };
+	std::mt19937 rng(12345);
+	std::string text;
+	text.reserve(256u << 20);
+	while (text.size() < (256u << 20))
+	{
+		text += words[rng() % 12];
+		text += rng() % 1000? ' ' : '\n';
+		if (rng() % 1000 == 0)
+			text += marker_strings[rng() % 8];
+	}
+
+	time_it("ctstr::scanner (one pass)", text, [&] {
+		std::size_t count = 0;
+		markers::scan(text.data(), text.size(), [&](std::size_t, std::uint64_t) { ++count; });
+		return count;
+	});
+
+	time_it("ctstr::scanner (64 KB chunks)", text, [&] {
+		std::size_t count = 0;
+		markers scanner;
+		for (std::size_t offset = 0; offset < text.size(); offset += 65536)
+			scanner.feed(text.data() + offset, std::min<std::size_t>(65536, text.size() - offset), [&](std::size_t, std::uint64_t) { ++count; });
+		return count;
+	});
+
+	time_it("memmem, once per marker", text, [&] {
+		std::size_t count = 0;
+		for (const char* marker : marker_strings)
+		{
+			std::size_t length = std::strlen(marker);
+			const char* p = text.data();
+			const char* end = text.data() + text.size();
+			while (const void* found = memmem(p, static_cast<std::size_t>(end - p), marker, length))
+			{
+				++count;
+				p = static_cast<const char*>(found) + 1;
+			}
+		}
+		return count;
+	});
+}
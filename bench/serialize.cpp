@@ -0,0 +1,123 @@
+// ctstr::write_json / write_csv / read_json on a million records, against a field-at-a-time serializer that escapes
+// each key as it writes it.  Requires C++17.  Results are in MB/s of JSON or CSV text.
+
+#include <CTStr/Serialize.hpp>
+
+#include "bench.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+struct trade
+{
+	std::int64_t id;
+	std::string symbol;
+	double price;
+	std::int32_t quantity;
+	bool buy;
+	std::string account;
+};
+
+template <>
+struct ctstr::fields_of<trade> : ctstr::fields<
+	ctstr::field<string_to_type("id"), &trade::id>,
+	ctstr::field<string_to_type("symbol"), &trade::symbol>,
+	ctstr::field<string_to_type("price"), &trade::price>,
+	ctstr::field<string_to_type("quantity"), &trade::quantity>,
+	ctstr::field<string_to_type("buy"), &trade::buy>,
+	ctstr::field<string_to_type("account"), &trade::account>> {};
+
+// What we're replacing: every key is escaped character by character on every call.
+static void escape_into(std::string& out, const char* str)
+{
+	out += '"';
+	for (; *str; ++str)
+	{
+		if (*str == '"' || *str == '\\')
+			out += '\\';
+		out += *str;
+	}
+	out += '"';
+}
+
+static void naive_json(std::string& out, const trade& t)
+{
+	out += '{';
+	escape_into(out, "id"); out += ':'; out += std::to_string(t.id); out += ',';
+	escape_into(out, "symbol"); out += ':'; escape_into(out, t.symbol.c_str()); out += ',';
+	escape_into(out, "price"); out += ':'; out += std::to_string(t.price); out += ',';
+	escape_into(out, "quantity"); out += ':'; out += std::to_string(t.quantity); out += ',';
+	escape_into(out, "buy"); out += ':'; out += t.buy? "true" : "false"; out += ',';
+	escape_into(out, "account"); out += ':'; escape_into(out, t.account.c_str());
+	out += '}';
+}
+
+// f() returns how many bytes it wrote or read.
+template <typename F>
+static void throughput(const char* name, F&& f)
+{
+	auto start = std::chrono::steady_clock::now();
+	std::size_t bytes = f();
+	auto end = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>(end - start).count();
+	std::printf("%-48s %10.1f MB/s\n", name, static_cast<double>(bytes) / seconds / 1e6);
+}
+
+int main()
+{
+	const std::size_t count = 1000000;
+	const char* symbols[] = { "AAPL", "MSFT", "GOOG", "AMZN", "NVDA" };
+	std::vector<trade> trades(count);
+	for (std::size_t i = 0; i < count; ++i)
+		trades[i] = trade{ static_cast<std::int64_t>(i) * 7919, symbols[i % 5], 100.0 + static_cast<double>(i % 1000) / 8.0,
+		                   static_cast<std::int32_t>(i % 500), i % 3 == 0, "acct-" + std::to_string(i % 10000) };
+
+	std::string json, naive, csv;
+	json.reserve(count * 128);
+	naive.reserve(count * 128);
+	csv.reserve(count * 64);
+
+	// Newline-separated objects, one per record.
+	throughput("ctstr::write_json", [&] {
+		for (const trade& t : trades)
+		{
+			ctstr::write_json(json, t);
+			json += '\n';
+		}
+		return json.size();
+	});
+	throughput("field-at-a-time JSON", [&] {
+		for (const trade& t : trades)
+		{
+			naive_json(naive, t);
+			naive += '\n';
+		}
+		return naive.size();
+	});
+	bench::do_not_optimize(naive);
+
+	throughput("ctstr::write_csv", [&] {
+		ctstr::write_csv_header<trade>(csv);
+		for (const trade& t : trades)
+			ctstr::write_csv(csv, t);
+		return csv.size();
+	});
+
+	std::size_t read = 0;
+	trade t;
+	throughput("ctstr::read_json", [&] {
+		std::string_view in = json;
+		while (!in.empty())
+		{
+			std::size_t n = ctstr::read_json(in, t);
+			if (n == 0)
+				break;
+			in.remove_prefix(n);
+			++read;
+		}
+		return json.size() - in.size();
+	});
+	std::printf("records read back: %zu of %zu\n", read, count);
+}
@@ -0,0 +1,86 @@
+// ctstr::id against using the string itself as a key, plus a check that 100,000 strings get 100,000 distinct ids.
+// Requires C++17.  Build together with symbols_other.cpp, which looks up some of the same ids from another translation unit:
+//
+//     g++ -std=c++17 -O2 -I<dir containing CTStr> symbols.cpp symbols_other.cpp
+//
+// Expect that to take a while: every one of the hundred thousand strings is its own set of templates.
+// Lower key_count in symbols_key.hpp for a quicker run.
+
+#include "symbols_key.hpp"
+
+#include "bench.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+std::uint32_t other_translation_unit_id(std::size_t i);
+
+// The ids and names of one block of keys, so no single pack expansion has to be a hundred thousand long.
+template <std::size_t First, std::size_t...I>
+void collect_block(std::vector<std::uint32_t>& ids, std::vector<std::string_view>& names, std::index_sequence<I...>)
+{
+	for (std::uint32_t id : { ctstr::id<key<First + I>>()... })
+		ids.push_back(id);
+	for (std::string_view name : { ctstr::to_string_view<key<First + I>>()... })
+		names.push_back(name);
+}
+
+template <std::size_t...Block>
+std::size_t check_all(std::index_sequence<Block...>)
+{
+	constexpr std::size_t block_size = key_count / sizeof...(Block);
+	static_assert(block_size * sizeof...(Block) == key_count, "key_count must divide evenly into blocks.");
+
+	std::vector<std::uint32_t> ids;
+	std::vector<std::string_view> names;
+	(collect_block<Block * block_size>(ids, names, std::make_index_sequence<block_size>{}), ...);
+
+	const std::size_t n = ids.size();
+	std::size_t wrong = ctstr::symbols::count() < n;
+
+	// Every id is a distinct number below count(), and maps back to its own name.
+	std::vector<bool> seen(ctstr::symbols::count());
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		std::uint32_t id = ids[i];
+		wrong += id >= seen.size() || seen[id];
+		if (id < seen.size())
+			seen[id] = true;
+		wrong += ctstr::symbols::name(id) != names[i];
+		wrong += ctstr::symbols::find(names[i]) != id;
+	}
+	wrong += ctstr::symbols::find("not a symbol").has_value();
+	for (std::size_t i : { std::size_t(0), std::size_t(1), n / 2, n - 1 })
+		wrong += other_translation_unit_id(i) != ids[i];
+	std::printf("%zu symbols (%zu registered in total), %zu wrong\n", n, ctstr::symbols::count(), wrong);
+	return wrong;
+}
+
+int main()
+{
+	std::size_t wrong = check_all(std::make_index_sequence<100>{});
+
+	const std::size_t iterations = 20000000;
+	std::vector<std::size_t> counters(ctstr::symbols::count());
+	std::unordered_map<std::string, std::size_t> named_counters;
+
+	bench::run("counters[ctstr::id<S>()]++", iterations, [&] {
+		bench::do_not_optimize(++counters[ctstr::id<string_to_type("frame.rendered")>()]);
+	});
+	bench::run("named_counters[\"...\"]++ (unordered_map)", iterations, [&] {
+		bench::do_not_optimize(++named_counters["frame.rendered"]);
+	});
+
+	std::uint32_t a = ctstr::id<string_to_type("frame.rendered")>(), b = ctstr::id<string_to_type("frame.dropped")>();
+	std::string sa = "frame.rendered", sb = "frame.dropped";
+	bench::run("id == id", iterations, [&] {
+		bench::do_not_optimize(a);
+		bench::do_not_optimize(a == b);
+	});
+	bench::run("std::string == std::string", iterations, [&] {
+		bench::do_not_optimize(sa);
+		bench::do_not_optimize(sa == sb);
+	});
+	return wrong? 1 : 0;
+}
@@ -0,0 +1,14 @@
+// The strings used by symbols.cpp and symbols_other.cpp.
+
+#pragma once
+
+#include <CTStr/Symbols.hpp>
+
+#include <cstddef>
+#include <utility>
+
+// "sym_00000", "sym_00001", ... built directly as sequences so we can have a hundred thousand of them without that many literals.
+template <std::size_t I>
+using key = std::integer_sequence<char, 's', 'y', 'm', '_', '0' + I / 10000 % 10, '0' + I / 1000 % 10, '0' + I / 100 % 10, '0' + I / 10 % 10, '0' + I % 10>;
+
+constexpr std::size_t key_count = 100000;
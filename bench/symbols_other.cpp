@@ -0,0 +1,15 @@
+// Part of symbols.cpp: the ids of some of the same strings, as seen from a second translation unit.
+
+#include "symbols_key.hpp"
+
+std::uint32_t other_translation_unit_id(std::size_t i)
+{
+	switch (i)
+	{
+	case 0:             return ctstr::id<key<0>>();
+	case 1:             return ctstr::id<key<1>>();
+	case key_count / 2: return ctstr::id<key<key_count / 2>>();
+	case key_count - 1: return ctstr::id<key<key_count - 1>>();
+	}
+	return 0xFFFFFFFFu;
+}
@@ -0,0 +1,56 @@
+// The cost of CTSTR_TRACE_ZONE and CTSTR_COUNTER on the thread being traced, per event.
+// Requires C++17 and threads (-pthread).  Tracing is on unless you build with -DCTSTR_TRACING=0,
+// which is worth doing once to see that the same loops then cost nothing.  Writes bench_trace.json.
+
+#ifndef CTSTR_TRACING
+#define CTSTR_TRACING 1
+#endif
+
+// Big enough for a whole run, so nothing is dropped while we're measuring.
+#define CTSTR_TRACE_BUFFER_SIZE 0x40000
+
+#include <CTStr/Trace.hpp>
+
+#include "bench.hpp"
+
+#include <thread>
+#include <vector>
+
+int main()
+{
+	const std::size_t iterations = 100000;
+	ctstr::trace_collector collector("bench_trace.json");
+	int value = 0;
+
+	bench::run("empty loop", iterations, [&] {
+		bench::do_not_optimize(++value);
+	});
+	collector.flush();
+	// A zone is two events, one at each end.
+	bench::run("CTSTR_TRACE_ZONE (2 events)", iterations, [&] {
+		CTSTR_TRACE_ZONE("bench.zone");
+		bench::do_not_optimize(++value);
+	});
+	collector.flush();
+	bench::run("CTSTR_COUNTER", iterations, [&] {
+		CTSTR_COUNTER("bench.counter");
+		bench::do_not_optimize(++value);
+	});
+	collector.flush();
+
+	// The same with four threads recording at once, to show they don't get in each other's way.
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t)
+		threads.emplace_back([&] {
+			int local = 0;
+			bench::run("CTSTR_TRACE_ZONE, 4 threads (2 events)", iterations, [&] {
+				CTSTR_TRACE_ZONE("bench.threaded_zone");
+				bench::do_not_optimize(++local);
+			});
+		});
+	for (std::thread& thread : threads)
+		thread.join();
+	collector.flush();
+
+	std::printf("dropped events: %llu\n", static_cast<unsigned long long>(ctstr::trace_collector::dropped()));
+}
@@ -0,0 +1,130 @@
+// Builds a catalog file for ctstr::mapped_catalog out of a text file of translations.
+// Requires C++17.
+//
+//     catalog_gen <translations.txt> <catalog.ctc>
+//
+// Each line of the input is an original string and its translation, separated by a tab:
+//
+//     Hello!<TAB>こんにちは！
+//     Please enter your name: \0 POLITE<TAB>お名前をご入力して頂ければ幸いに存じます
+//
+// Both halves can use the escapes \\ \t \n \r and \0, so the original string can be written exactly as it is
+// in the string_to_type literal.  Empty lines and lines starting with # are skipped.
+//
+// The catalog is written next to the output file first and then renamed over it, so a program
+// that's reloading the file never sees it half-written.
+
+#include <CTStr/MappedCatalog.hpp>
+
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <string>
+
+// Undoes the escapes in place.  Returns false if there's one it doesn't know.
+static bool unescape(std::string& str)
+{
+	std::size_t out = 0;
+	for (std::size_t i = 0; i < str.size(); ++i)
+	{
+		char c = str[i];
+		if (c == '\\')
+		{
+			if (++i == str.size())
+				return false;
+			switch (str[i])
+			{
+			case '\\': c = '\\'; break;
+			case 't':  c = '\t'; break;
+			case 'n':  c = '\n'; break;
+			case 'r':  c = '\r'; break;
+			case '0':  c = '\0'; break;
+			default:   return false;
+			}
+		}
+		str[out++] = c;
+	}
+	str.resize(out);
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 3)
+	{
+		std::fprintf(stderr, "usage: %s <translations.txt> <catalog.ctc>\n", argv[0]);
+		return 2;
+	}
+
+	std::ifstream in(argv[1], std::ios::binary);
+	if (!in)
+	{
+		std::fprintf(stderr, "%s: can't open\n", argv[1]);
+		return 1;
+	}
+
+	ctstr::mapped_catalog_writer writer;
+	std::string line;
+	std::size_t number = 0;
+	bool ok = true;
+	while (std::getline(in, line))
+	{
+		++number;
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		std::size_t tab = line.find('\t');
+		std::string source = line.substr(0, tab);
+		std::string translation = tab == std::string::npos? std::string() : line.substr(tab + 1);
+		if (tab == std::string::npos || !unescape(source) || !unescape(translation))
+		{
+			std::fprintf(stderr, "%s:%zu: expected <original><TAB><translation>, with only \\\\ \\t \\n \\r \\0 escapes\n", argv[1], number);
+			ok = false;
+			continue;
+		}
+
+		try
+		{
+			if (!writer.add(source, translation))
+			{
+				std::fprintf(stderr, "%s:%zu: \"%s\" is already translated (or has the same hash as a string that is)\n", argv[1], number, source.c_str());
+				ok = false;
+			}
+		}
+		catch (const std::exception& e)
+		{
+			std::fprintf(stderr, "%s:%zu: %s\n", argv[1], number, e.what());
+			return 1;
+		}
+	}
+	if (!ok)
+		return 1;
+
+	std::string temporary = std::string(argv[2]) + ".tmp";
+	{
+		std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+		writer.write(out);
+		out.close();
+		if (!out)
+		{
+			std::fprintf(stderr, "%s: can't write\n", temporary.c_str());
+			std::remove(temporary.c_str());
+			return 1;
+		}
+	}
+#if defined(_WIN32)
+	// rename() won't replace an existing file on Windows.
+	std::remove(argv[2]);
+#endif
+	if (std::rename(temporary.c_str(), argv[2]) != 0)
+	{
+		std::fprintf(stderr, "%s: can't replace\n", argv[2]);
+		std::remove(temporary.c_str());
+		return 1;
+	}
+
+	std::printf("%s: %zu translations\n", argv[2], writer.size());
+	return 0;
+}
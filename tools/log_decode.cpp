@@ -0,0 +1,185 @@
+// Formats a binary log written by ctstr::log_writer (with log_output::binary) as text.
+// Requires C++17.
+//
+//     log_decode <app.ctlog>
+//
+// The output is the same as log_output::text would have written: one message per line, after the time in
+// seconds since the epoch.  The log has to be decoded on a machine with the same byte order as the one that wrote it.
+
+#include <CTStr/Log.hpp>
+
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct site
+{
+	std::string format;
+	std::string signature;
+};
+
+// Reads a T from data at offset, moving offset past it.  Returns false if the data ends first.
+template <typename T>
+static bool read(const std::vector<char>& data, std::size_t& offset, T& value)
+{
+	if (data.size() - offset < sizeof(T))
+		return false;
+	std::memcpy(&value, data.data() + offset, sizeof(T));
+	offset += sizeof(T);
+	return true;
+}
+
+static bool read_string(const std::vector<char>& data, std::size_t& offset, std::string& str)
+{
+	std::uint32_t length;
+	if (!read(data, offset, length) || data.size() - offset < length)
+		return false;
+	str.assign(data.data() + offset, length);
+	offset += length;
+	return true;
+}
+
+template <typename T>
+static void append_number(std::string& out, T value)
+{
+	char buffer[48];
+	out.append(buffer, static_cast<std::size_t>(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr - buffer));
+}
+
+// Turns one argument back into the text ctstr::format would have made of it.  Returns false if the record is too short.
+static bool decode_argument(char tag, const char*& in, const char* end, std::string& out)
+{
+	auto take = [&](auto& value) {
+		if (static_cast<std::size_t>(end - in) < sizeof(value))
+			return false;
+		std::memcpy(&value, in, sizeof(value));
+		in += sizeof(value);
+		return true;
+	};
+
+	switch (tag)
+	{
+	case 'b': { bool v; if (!take(v)) return false; out += v? "true" : "false"; return true; }
+	case 'c': { char v; if (!take(v)) return false; out += v; return true; }
+	case 'f': { float v; if (!take(v)) return false; append_number(out, v); return true; }
+	case 'd': { double v; if (!take(v)) return false; append_number(out, v); return true; }
+	case 'i': { std::int64_t v; if (!take(v)) return false; append_number(out, v); return true; }
+	case 'u': { std::uint64_t v; if (!take(v)) return false; append_number(out, v); return true; }
+	case 's':
+	{
+		std::uint32_t length;
+		if (!take(length) || static_cast<std::size_t>(end - in) < length)
+			return false;
+		out.append(in, length);
+		in += length;
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+// Substitutes %N and %% at runtime, the same way ctstr::format does at compile time.
+static bool format(const site& s, const char* in, const char* end, std::string& out)
+{
+	std::vector<std::string> arguments(s.signature.size());
+	for (std::size_t i = 0; i < s.signature.size(); ++i)
+		if (!decode_argument(s.signature[i], in, end, arguments[i]))
+			return false;
+
+	const std::string& f = s.format;
+	for (std::size_t i = 0; i < f.size(); ++i)
+	{
+		if (f[i] != '%' || i + 1 == f.size())
+			out += f[i];
+		else if (f[i + 1] == '%')
+			out += f[++i];
+		else
+		{
+			std::size_t argument = 0;
+			std::size_t j = i + 1;
+			for (; j < f.size() && f[j] >= '0' && f[j] <= '9'; ++j)
+				argument = argument * 10 + static_cast<std::size_t>(f[j] - '0');
+			if (argument < arguments.size())
+				out += arguments[argument];
+			i = j - 1;
+		}
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 2)
+	{
+		std::fprintf(stderr, "usage: %s <app.ctlog>\n", argv[0]);
+		return 2;
+	}
+
+	std::ifstream in(argv[1], std::ios::binary);
+	if (!in)
+	{
+		std::fprintf(stderr, "%s: can't open\n", argv[1]);
+		return 1;
+	}
+	std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+	std::size_t offset = 0;
+	std::uint32_t magic = 0, version = 0;
+	if (!read(data, offset, magic) || !read(data, offset, version) || magic != ctstr::detail::log_magic)
+	{
+		std::fprintf(stderr, "%s: not a binary log (or written on a machine with the other byte order)\n", argv[1]);
+		return 1;
+	}
+	if (version != ctstr::detail::log_version)
+	{
+		std::fprintf(stderr, "%s: log from an incompatible version\n", argv[1]);
+		return 1;
+	}
+
+	std::unordered_map<std::uint32_t, site> sites;
+	std::string line;
+	while (offset < data.size())
+	{
+		char kind = data[offset++];
+		bool ok = false;
+		if (kind == 'F')
+		{
+			std::uint32_t id;
+			site s;
+			ok = read(data, offset, id) && read_string(data, offset, s.format) && read_string(data, offset, s.signature);
+			if (ok)
+				sites[id] = std::move(s);
+		}
+		else if (kind == 'R')
+		{
+			std::uint32_t size;
+			std::uint64_t time;
+			std::uint32_t id;
+			std::size_t start = offset + sizeof(size);
+			ok = read(data, offset, size) && data.size() - start >= size && read(data, offset, time) && read(data, offset, id) && sites.count(id);
+			if (ok)
+			{
+				char stamp[32];
+				int length = std::snprintf(stamp, sizeof(stamp), "%llu.%09llu ", static_cast<unsigned long long>(time / 1000000000), static_cast<unsigned long long>(time % 1000000000));
+				line.assign(stamp, static_cast<std::size_t>(length));
+				ok = format(sites[id], data.data() + offset, data.data() + start + size, line);
+				line += '\n';
+				std::fwrite(line.data(), 1, line.size(), stdout);
+				offset = start + size;
+			}
+		}
+		if (!ok)
+		{
+			std::fprintf(stderr, "%s: corrupt record at byte %zu\n", argv[1], offset);
+			return 1;
+		}
+	}
+	return 0;
+}
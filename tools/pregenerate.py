@@ -0,0 +1,462 @@
+#!/usr/bin/env python3
+"""Writes headers of ready-made string_to_type sequences, for CTSTR_PREGENERATED_HEADER.
+
+    tools/pregenerate.py [--output ctstr_literals.hpp | --split DIRECTORY] [--macro NAME]... [--check] path...
+
+Every file under the given paths with a C++ extension is scanned for string
+literals passed to string_to_type, or to one of the library's macros that pass
+their argument on to it (packed_string_to_type, paged_string_to_type, CTSTR_LOG,
+CTSTR_TRACE_ZONE and CTSTR_COUNTER).  Add your own wrappers with --macro.  Only
+arguments that are nothing but string literals count; anything else (like the
+macro's own parameter in a #define) is left alone.
+
+Each distinct string becomes one specialization of ctstr::detail::pregenerated,
+keyed by its character type, two 64-bit hashes of its characters and its length,
+and holding the string as a literal again, with every escape spelled out.  Only
+the strings a translation unit actually uses get turned into sequences.  Compile
+with -DCTSTR_PREGENERATED_HEADER='"ctstr_literals.hpp"' and string_to_type looks
+its strings up there instead of building them.
+
+Headers are only rewritten when their set of strings changes, so edits that don't
+add or remove a string leave their timestamps (and so everything that includes
+them) alone.  That makes it safe to run before every build:
+
+    add_custom_target(ctstr_literals ALL
+        COMMAND python3 tools/pregenerate.py -o ${CMAKE_BINARY_DIR}/ctstr_literals.hpp ${CMAKE_SOURCE_DIR}/src
+        BYPRODUCTS ${CMAKE_BINARY_DIR}/ctstr_literals.hpp)
+
+One header for everything is simplest, but every translation unit has to parse
+all of it (about 2s each with 50,000 strings), and a new string anywhere rebuilds
+everything.  --split DIRECTORY instead writes a header for each source file,
+named after its path relative to the argument it was found under, the way CMake's
+string(MAKE_C_IDENTIFIER) would (src/net/http.cpp under src becomes
+net_http_cpp.hpp), holding just that file's strings.  Strings found in headers go
+into ctstr_common.hpp, which the others all include.  Each translation unit then
+needs CTSTR_PREGENERATED_HEADER to name its own header:
+
+    foreach(source IN LISTS sources)
+        file(RELATIVE_PATH name ${CMAKE_SOURCE_DIR}/src ${source})
+        string(MAKE_C_IDENTIFIER ${name} name)
+        set_property(SOURCE ${source} APPEND PROPERTY COMPILE_DEFINITIONS CTSTR_PREGENERATED_HEADER="${name}.hpp")
+    endforeach()
+
+with ${CMAKE_BINARY_DIR}/ctstr (or wherever --split writes to) on the include path.
+Headers there that this tool wrote for sources that have since gone are deleted.
+
+--check writes nothing and exits with status 1 if any header is out of date.
+
+Literals are taken to be UTF-8 in the source and in the execution character set.
+L"" strings are written out both ways, for a 16-bit and a 32-bit wchar_t, and u8""
+strings both as char8_t and, for C++17 where u8"" is a char string, merged in with
+the plain ones.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+DEFAULT_MACROS = ["string_to_type", "packed_string_to_type", "paged_string_to_type",
+                  "CTSTR_LOG", "CTSTR_TRACE_ZONE", "CTSTR_COUNTER"]
+
+SOURCE_EXTENSIONS = {".cpp", ".cc", ".cxx", ".c++"}
+EXTENSIONS = SOURCE_EXTENSIONS | {".h", ".hh", ".hpp", ".hxx", ".inl", ".ipp", ".tpp"}
+
+# Holds the strings from headers, for --split.
+COMMON = "ctstr_common.hpp"
+
+MASK = (1 << 64) - 1
+
+# Must match CTSTR_PREGENERATED_KEY in CTStr.hpp.
+HASHES = [(0xcbf29ce484222325, 0x100000001b3), (0x84222325cbf29ce4, 0x9e3779b97f4a7c15)]
+
+CHAR_TYPES = {"": "char", "u8": "char8_t", "u": "char16_t", "U": "char32_t", "L": "wchar_t"}
+PREFIXES = {t: p for p, t in CHAR_TYPES.items()}
+
+IDENTIFIER = re.compile(r"[A-Za-z_][A-Za-z_0-9]*")
+NUMBER = re.compile(r"\.?[0-9](?:[eEpP][+-]|[0-9A-Za-z_.'])*")
+STRING_PREFIX = re.compile(r"(u8|u|U|L)?(R)?\"")
+SIMPLE_ESCAPES = {"n": 10, "t": 9, "v": 11, "b": 8, "r": 13, "f": 12, "a": 7,
+                  "\\": 92, "?": 63, "'": 39, "\"": 34}
+
+
+class ScanError(Exception):
+    pass
+
+
+def decode(body):
+    """The characters of a literal's body, as ("cp", code point) or ("unit", code unit) for \\x and octal escapes."""
+    out = []
+    i = 0
+    while i < len(body):
+        c = body[i]
+        i += 1
+        if c != "\\":
+            out.append(("cp", ord(c)))
+            continue
+        if i == len(body):
+            raise ScanError("backslash at the end of a string")
+        c = body[i]
+        i += 1
+        if c in SIMPLE_ESCAPES:
+            out.append(("cp", SIMPLE_ESCAPES[c]))
+        elif c in "01234567":
+            digits = c
+            while len(digits) < 3 and i < len(body) and body[i] in "01234567":
+                digits += body[i]
+                i += 1
+            out.append(("unit", int(digits, 8)))
+        elif c == "x":
+            m = re.match(r"[0-9A-Fa-f]+", body[i:])
+            if not m:
+                raise ScanError("\\x with no digits")
+            i += m.end()
+            out.append(("unit", int(m.group(), 16)))
+        elif c in "uU":
+            n = 4 if c == "u" else 8
+            digits = body[i:i + n]
+            if len(digits) != n or not re.fullmatch(r"[0-9A-Fa-f]+", digits):
+                raise ScanError("malformed \\%s escape" % c)
+            i += n
+            out.append(("cp", int(digits, 16)))
+        else:
+            raise ScanError("unknown escape \\%s" % c)
+    return out
+
+
+def encode(chars, width):
+    """Code units for a character type of width 8, 16 or 32 bits."""
+    units = []
+    for kind, value in chars:
+        if kind == "unit":
+            if value >= 1 << width:
+                raise ScanError("escape out of range for the character type")
+            units.append(value)
+        elif width == 8:
+            units.extend(chr(value).encode("utf-8", "surrogatepass"))
+        elif width == 16 and value > 0xFFFF:
+            value -= 0x10000
+            units.extend([0xD800 + (value >> 10), 0xDC00 + (value & 0x3FF)])
+        else:
+            units.append(value)
+    return units
+
+
+def key(units):
+    keys = []
+    for basis, prime in HASHES:
+        h = basis
+        for u in units:
+            h = ((h ^ u) * prime) & MASK
+        keys.append(h)
+    return keys
+
+
+class Scanner:
+    def __init__(self, text, macros):
+        self.text = text
+        self.macros = macros
+        self.pos = 0
+
+    def skip_space(self):
+        """Skips whitespace and comments."""
+        text = self.text
+        while self.pos < len(text):
+            if text[self.pos].isspace():
+                self.pos += 1
+            elif text.startswith("//", self.pos):
+                end = text.find("\n", self.pos)
+                self.pos = len(text) if end < 0 else end
+            elif text.startswith("/*", self.pos):
+                end = text.find("*/", self.pos + 2)
+                self.pos = len(text) if end < 0 else end + 2
+            elif text.startswith("\\\n", self.pos):
+                self.pos += 2
+            else:
+                break
+
+    def string(self):
+        """A string literal starting at pos, as (prefix, decoded characters), or None if there isn't one."""
+        m = STRING_PREFIX.match(self.text, self.pos)
+        if not m:
+            return None
+        prefix = m.group(1) or ""
+        self.pos = m.end()
+        if m.group(2):
+            delimiter = re.match(r"[^()\\\s]{0,16}\(", self.text[self.pos:])
+            if not delimiter:
+                raise ScanError("malformed raw string")
+            close = ")" + delimiter.group()[:-1] + "\""
+            end = self.text.find(close, self.pos + delimiter.end())
+            if end < 0:
+                raise ScanError("unterminated raw string")
+            body = self.text[self.pos + delimiter.end():end]
+            self.pos = end + len(close)
+            return prefix, [("cp", ord(c)) for c in body]
+        start = self.pos
+        while self.pos < len(self.text) and self.text[self.pos] != "\"":
+            if self.text[self.pos] == "\n":
+                raise ScanError("newline in a string")
+            self.pos += 2 if self.text[self.pos] == "\\" else 1
+        body = self.text[start:self.pos]
+        self.pos += 1
+        return prefix, decode(body)
+
+    def skip_char(self):
+        self.pos += 1
+        while self.pos < len(self.text) and self.text[self.pos] not in "'\n":
+            self.pos += 2 if self.text[self.pos] == "\\" else 1
+        self.pos += 1
+
+    def argument(self):
+        """After a macro name: the first argument, if it's nothing but string literals."""
+        self.skip_space()
+        if not self.text.startswith("(", self.pos):
+            return None
+        self.pos += 1
+        pieces = []
+        while True:
+            self.skip_space()
+            piece = self.string()
+            if piece is None:
+                break
+            pieces.append(piece)
+        self.skip_space()
+        if not pieces or self.pos >= len(self.text) or self.text[self.pos] not in ",)":
+            return None
+
+        # Adjacent literals are joined, and take on whichever prefix any of them has.
+        prefixes = {p for p, _ in pieces if p}
+        if len(prefixes) > 1:
+            raise ScanError("strings with different prefixes joined together")
+        prefix = prefixes.pop() if prefixes else ""
+        return prefix, [c for _, chars in pieces for c in chars]
+
+    def literals(self):
+        text = self.text
+        while True:
+            self.skip_space()
+            if self.pos >= len(text):
+                return
+            c = text[self.pos]
+            if STRING_PREFIX.match(text, self.pos):
+                self.string()
+            elif c == "'":
+                self.skip_char()
+            elif c.isdigit() or (c == "." and text[self.pos + 1:self.pos + 2].isdigit()):
+                self.pos = NUMBER.match(text, self.pos).end()
+            elif c.isalpha() or c == "_":
+                name = IDENTIFIER.match(text, self.pos).group()
+                self.pos += len(name)
+                if name in self.macros:
+                    found = self.argument()
+                    if found is not None:
+                        yield found
+            else:
+                self.pos += 1
+
+
+def spell(char_type, units, width):
+    """units as a literal of char_type, with anything but printable ASCII escaped."""
+    prefix = PREFIXES[char_type]
+    out, after_hex = [prefix + "\""], False
+    for u in units:
+        c = chr(u)
+        if 0x20 <= u < 0x7F and c not in "\"\\?":
+            # A hex escape would carry on into a following hex digit, so end the literal there and start another.
+            if after_hex and c in "0123456789abcdefABCDEF":
+                out.append("\" " + prefix + "\"")
+            out.append(c)
+            after_hex = False
+        elif width == 8:
+            out.append("\\%03o" % u)
+            after_hex = False
+        else:
+            out.append("\\x%x" % u)
+            after_hex = True
+    out.append("\"")
+    return "".join(out)
+
+
+def entry(char_type, units):
+    h1, h2 = key(units)
+    width = 8 if char_type in ("char", "char8_t") else 16 if char_type == "char16_t" else 32
+    return ("template <> struct pregenerated<%s, 0x%016xull, 0x%016xull, %d> : pregenerated_entry "
+            "{ static constexpr const %s* str() { return %s; } };\n") % (
+        char_type, h1, h2, len(units), char_type, spell(char_type, units, width))
+
+
+def find_sources(paths):
+    """Every file to scan, and its path relative to the argument it was found under."""
+    for path in paths:
+        if os.path.isfile(path):
+            yield path, os.path.basename(path)
+            continue
+        for root, dirs, files in os.walk(path):
+            dirs.sort()
+            for name in sorted(files):
+                if os.path.splitext(name)[1].lower() in EXTENSIONS:
+                    full = os.path.join(root, name)
+                    yield full, os.path.relpath(full, path)
+
+
+def is_source(path):
+    return os.path.splitext(path)[1].lower() in SOURCE_EXTENSIONS
+
+
+def header_name(name):
+    """The --split header for a source file: its relative path made into an identifier, as CMake's
+    string(MAKE_C_IDENTIFIER) does it, with .hpp on the end."""
+    name = re.sub(r"[^A-Za-z0-9_]", "_", name.replace(os.sep, "/"))
+    return ("_" + name if name[:1].isdigit() else name) + ".hpp"
+
+
+def scan(paths, macros):
+    """Every file found, with the set of strings in it as (table, character type, code units)."""
+    found = []
+    for path, name in find_sources(paths):
+        with open(path, encoding="utf-8", errors="surrogateescape") as f:
+            text = f.read()
+        strings = set()
+        scanner = Scanner(text, macros)
+        try:
+            for prefix, chars in scanner.literals():
+                char_type = CHAR_TYPES[prefix]
+                if prefix == "L":
+                    strings.add(("wide16", char_type, tuple(encode(chars, 16))))
+                    strings.add(("wide32", char_type, tuple(encode(chars, 32))))
+                elif prefix == "u8":
+                    strings.add(("u8", char_type, tuple(encode(chars, 8))))
+                else:
+                    strings.add(("narrow", char_type, tuple(encode(chars, 8 if prefix in ("", "u8") else 16 if prefix == "u" else 32))))
+        except ScanError as e:
+            line = text.count("\n", 0, scanner.pos) + 1
+            print("%s:%d: %s; skipping the rest of the file" % (path, line, e), file=sys.stderr)
+        found.append((path, name, strings))
+
+    # Two different strings with the same key would silently become the same type, so that's an error here.
+    seen = {}
+    for path, _, strings in found:
+        for table, char_type, units in strings:
+            k = (table, char_type, len(units), *key(units))
+            if seen.setdefault(k, (path, units))[1] != units:
+                raise SystemExit("%s and %s: two strings hash to the same key" % (seen[k][0], path))
+    return found
+
+
+def header(strings, source, include=None, included=frozenset()):
+    """The text of a header holding strings, less the ones in the header it includes, which holds included."""
+    strings = strings - included
+    narrow = sorted((t, u) for table, t, u in strings if table == "narrow")
+    wide16 = sorted((t, u) for table, t, u in strings if table == "wide16")
+    wide32 = sorted((t, u) for table, t, u in strings if table == "wide32")
+
+    # Before C++20 a u8"" string is a char string, so it and a plain string with the same bytes are the same
+    # specialization, which mustn't be written twice, in this header or between it and the one it includes.
+    chars = {u for table, t, u in strings if table == "narrow" and t == "char"}
+    u8 = {u for table, _, u in strings if table == "u8"}
+    included_chars = {u for table, t, u in included if table == "narrow" and t == "char"}
+    included_u8 = {u for table, _, u in included if table == "u8"}
+    char8 = sorted(u8)
+    char20 = sorted(chars & included_u8)
+    char17 = sorted(u8 - chars - included_chars)
+
+    out = ["// Generated by tools/pregenerate.py from %s.  Don't edit; run it again instead.\n" % source,
+           "// %d strings.\n\n" % (len(narrow) + len(char8) + len(wide32)),
+           "#pragma once\n\n"]
+    if include:
+        out.append("#include \"%s\"\n\n" % include)
+    out.append("namespace ctstr\n{\nnamespace detail\n{\n")
+    out += [entry(t, u) for t, u in narrow if t != "char" or u not in included_u8]
+    if char8 or char20:
+        out.append("\n#if defined(__cpp_char8_t)\n")
+        out += [entry("char8_t", u) for u in char8]
+        out += [entry("char", u) for u in char20]
+        out.append("#else\n")
+        out += [entry("char", u) for u in char17]
+        out.append("#endif\n")
+    if wide32:
+        out.append("\n#if WCHAR_MAX > 0xFFFF\n")
+        out += [entry(t, u) for t, u in wide32]
+        out.append("#else\n")
+        out += [entry(t, u) for t, u in wide16]
+        out.append("#endif\n")
+    out.append("}\n}\n")
+    return "".join(out)
+
+
+def generate(found, output, split):
+    """{path: text} for every header to write."""
+    if not split:
+        strings = set().union(*(s for _, _, s in found))
+        return {output: header(strings, "%d files" % len(found))}
+
+    # Strings from headers could end up in any translation unit, so they all go in one header that the rest include.
+    common = set().union(*(s for path, _, s in found if not is_source(path)))
+    headers = {os.path.join(output, COMMON): header(common, "every header")}
+    for path, name, strings in found:
+        if is_source(path):
+            headers[os.path.join(output, header_name(name))] = header(strings, path, COMMON, common)
+    return headers
+
+
+def write(path, text, check):
+    """Writes text to path unless it's already there.  Returns whether it wasn't."""
+    try:
+        with open(path, encoding="utf-8") as f:
+            if f.read() == text:
+                return False
+    except OSError:
+        pass
+    if check:
+        return True
+
+    # Written next to the header and renamed over it, so a build running alongside never sees half of it.
+    if os.path.dirname(path):
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+    temp = path + ".tmp"
+    with open(temp, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    os.replace(temp, path)
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("paths", nargs="+", help="source files, or directories to search")
+    parser.add_argument("-o", "--output", default="ctstr_literals.hpp")
+    parser.add_argument("--split", metavar="DIRECTORY", help="write a header for each source file into DIRECTORY instead of one header")
+    parser.add_argument("--macro", action="append", default=[], help="another macro whose first argument is passed to string_to_type")
+    parser.add_argument("--check", action="store_true", help="exit with status 1 if any header is out of date, and write nothing")
+    args = parser.parse_args()
+
+    found = scan(args.paths, set(DEFAULT_MACROS + args.macro))
+    headers = generate(found, args.split or args.output, args.split is not None)
+    changed = [path for path, text in sorted(headers.items()) if write(path, text, args.check)]
+
+    # Headers left over from sources that have gone would otherwise sit there forever.
+    stale = []
+    if args.split and os.path.isdir(args.split):
+        for name in os.listdir(args.split):
+            path = os.path.join(args.split, name)
+            if path not in headers and name.endswith(".hpp"):
+                with open(path, encoding="utf-8", errors="replace") as f:
+                    if f.readline().startswith("// Generated by tools/pregenerate.py"):
+                        stale.append(path)
+    if not args.check:
+        for path in stale:
+            os.remove(path)
+
+    strings = len([s for s in set().union(*(s for _, _, s in found)) if s[0] != "wide16"])
+    if args.check:
+        for path in changed + stale:
+            print("%s: out of date" % path, file=sys.stderr)
+        return 1 if changed or stale else 0
+    print("%s: %d strings from %d files; %d of %d headers rewritten%s" % (
+        args.split or args.output, strings, len(found), len(changed), len(headers),
+        ", %d removed" % len(stale) if stale else ""), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
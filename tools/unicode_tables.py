@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Generates UnicodeTables.hpp, the canonical normalization data used by Unicode.hpp.
+
+    tools/unicode_tables.py [output]
+
+The data comes from Python's own unicodedata module, so the tables follow the
+Unicode version that Python was built with (recorded in the header as
+CTSTR_UNICODE_VERSION).  Re-run this with a newer Python to update them.
+
+Three sorted tables are written, each one a flat array of integers so that a
+constant expression can binary search it without touching anything else:
+
+    unicode_combining_classes     (code point << 8) | canonical combining class,
+                                  for every code point whose class isn't 0
+    unicode_decompositions        (code point << 42) | (first << 21) | second,
+                                  the single-level canonical decomposition of
+                                  every code point that has one; second is 0
+                                  for singletons
+    unicode_compositions          (first << 42) | (second << 21) | composite,
+                                  every pair that canonical composition joins,
+                                  with the composition exclusions left out
+
+Hangul syllables aren't in the tables; Unicode.hpp works them out arithmetically.
+"""
+
+import os
+import sys
+import unicodedata
+
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+LICENSE = """\
+////////////////////////////////////////////////////////////
+// MIT License
+//
+// Copyright (c) 2016 Matthew Szekely
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////
+"""
+
+
+def code_points():
+    for cp in range(0x110000):
+        if 0xD800 <= cp <= 0xDFFF or HANGUL_FIRST <= cp <= HANGUL_LAST:
+            continue
+        yield cp
+
+
+def canonical_decomposition(cp):
+    mapping = unicodedata.decomposition(chr(cp))
+    if not mapping or mapping.startswith("<"):
+        return None
+    return [int(part, 16) for part in mapping.split()]
+
+
+def build_tables():
+    classes = []
+    decompositions = []
+    compositions = []
+    for cp in code_points():
+        ccc = unicodedata.combining(chr(cp))
+        if ccc:
+            classes.append(cp << 8 | ccc)
+        parts = canonical_decomposition(cp)
+        if parts is None:
+            continue
+        assert len(parts) <= 2
+        first, second = parts[0], parts[1] if len(parts) == 2 else 0
+        decompositions.append(cp << 42 | first << 21 | second)
+        # A primary composite is one that composition gives back: that rules out singletons,
+        # decompositions starting with a non-starter and everything in CompositionExclusions.txt.
+        if second and unicodedata.normalize("NFC", unicodedata.normalize("NFD", chr(cp))) == chr(cp):
+            compositions.append(first << 42 | second << 21 | cp)
+    compositions.sort()
+    return classes, decompositions, compositions
+
+
+def write_array(f, name, ctype, suffix, values, per_line):
+    f.write("\tinline constexpr %s %s[] =\n\t{\n" % (ctype, name))
+    for i in range(0, len(values), per_line):
+        f.write("\t\t" + " ".join("0x%x%s," % (v, suffix) for v in values[i:i + per_line]) + "\n")
+    f.write("\t};\n")
+
+
+def main():
+    output = sys.argv[1] if len(sys.argv) > 1 else os.path.join(REPO_ROOT, "UnicodeTables.hpp")
+    classes, decompositions, compositions = build_tables()
+    with open(output, "w", newline="\n") as f:
+        f.write(LICENSE)
+        f.write("\n// Generated by tools/unicode_tables.py from the Unicode %s data.  Don't edit it by hand.\n\n"
+                % unicodedata.unidata_version)
+        f.write("#pragma once\n\n#include <cstdint>\n\n")
+        f.write("#define CTSTR_UNICODE_VERSION \"%s\"\n\n" % unicodedata.unidata_version)
+        f.write("/// \\cond INTERNAL\n")
+        f.write("namespace ctstr\n{\nnamespace detail\n{\n")
+        f.write("\t// (code point << 8) | canonical combining class, for every code point whose class isn't 0.\n")
+        write_array(f, "unicode_combining_classes", "std::uint32_t", "", classes, 8)
+        f.write("\n\t// (code point << 42) | (first << 21) | second: single-level canonical decompositions, second is 0 for singletons.\n")
+        write_array(f, "unicode_decompositions", "std::uint64_t", "ull", decompositions, 4)
+        f.write("\n\t// (first << 42) | (second << 21) | composite: the pairs canonical composition joins.\n")
+        write_array(f, "unicode_compositions", "std::uint64_t", "ull", compositions, 4)
+        f.write("}\n}\n/// \\endcond\n")
+
+
+if __name__ == "__main__":
+    main()